@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "App/Logging/AppLogger.h"
 #include "ConfigContainer.h"
+#include "Utils/Json/JsonLoader.h"
 #include <fstream>
 
 using namespace PCL_CPP::Core::Logging;
@@ -21,11 +22,8 @@ namespace PCL_CPP::Core::Config {
 		}
 
 		try {
-			std::ifstream file(path);
-			if (file.is_open()) {
-				file >> m_data;
-				LOG_TRACE("Config loaded successfully: {}", path.string());
-			}
+			m_data = Utils::JsonLoader::ParseFile(path);
+			LOG_TRACE("Config loaded successfully: {}", path.string());
 		} catch (const std::exception &e) {
 			LOG_ERROR("Failed to parse config file {}: {}", path.string(), e.what());
 			m_data = nlohmann::json::object(); // 解析失败重置为空
@@ -0,0 +1,351 @@
+#include "pch.h"
+#include "App/Logging/AppLogger.h"
+#include "CdsArchiveCache.h"
+#include "Utils/Hashing/HashUtils.h"
+#include "Utils/IO/BinaryIO.h"
+#include "Utils/IO/FileStamp.h"
+#include <algorithm>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <string_view>
+
+using namespace PCL_CPP::Core::Logging;
+using namespace PCL_CPP::Core::Utils;
+
+namespace PCL_CPP::Core::Launcher::Launch {
+
+	static constexpr uint64_t CacheMagic = 0x52415344434C4350ull; ///< 文件头魔数，小端序下为 "PCLCDSAR"
+
+	/**
+	 * @brief 解析 JAVA_VERSION 的主版本号
+	 * @param version 版本字符串，例如 "1.8.0_302"、"17.0.8"、"21"
+	 * @return 主版本号，无法解析时返回 0
+	 */
+	static int ParseJavaMajor(std::string_view version) {
+		// JDK 8 及更早版本使用 "1.x" 格式
+		if (version.starts_with("1.")) version.remove_prefix(2);
+
+		int major = 0;
+		for (char c : version) {
+			if (c < '0' || c > '9') break;
+			major = major * 10 + (c - '0');
+		}
+		return major;
+	}
+
+	/**
+	 * @brief 构造函数
+	 * @param root 归档目录
+	 * @param budgetBytes 归档总大小预算（字节）
+	 */
+	CdsArchiveCache::CdsArchiveCache(std::filesystem::path root, uint64_t budgetBytes)
+		: m_root(std::move(root)), m_budget(budgetBytes) { }
+
+	/**
+	 * @brief 探测 Java 运行时
+	 * @param javaPath Java 可执行文件路径
+	 * @return 运行时信息，无法探测时返回 std::nullopt
+	 */
+	std::optional<JavaRuntimeInfo> CdsArchiveCache::ProbeRuntime(const std::filesystem::path &javaPath) {
+		auto home = javaPath.parent_path().parent_path();
+		if (home.empty()) return std::nullopt;
+
+		std::ifstream file(home / "release", std::ios::binary);
+		if (!file.is_open()) return std::nullopt;
+		std::string release((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+		// 只接受位于行首的 JAVA_VERSION，避免匹配到 IMPLEMENTOR_VERSION 等字段
+		constexpr std::string_view tag = "JAVA_VERSION=\"";
+		size_t pos = release.find(tag);
+		while (pos != std::string::npos && pos != 0 && release[pos - 1] != '\n') pos = release.find(tag, pos + 1);
+		if (pos == std::string::npos) return std::nullopt;
+		size_t start = pos + tag.size();
+		size_t end = release.find('"', start);
+		if (end == std::string::npos) return std::nullopt;
+
+		JavaRuntimeInfo info;
+		info.Version = release.substr(start, end - start);
+		info.Major = ParseJavaMajor(info.Version);
+		if (info.Major == 0) return std::nullopt;
+
+		// 同版本号的不同构建或原地更新的 JDK 通过模块镜像的签名区分
+		info.Hash = HashUtils::Fnv1a64(home.lexically_normal().generic_string());
+		info.Hash = HashUtils::Combine(info.Hash, HashUtils::Fnv1a64(release));
+		if (auto modules = FileStamp::Read(home / "lib" / "modules")) {
+			info.Hash = HashUtils::Combine(info.Hash, modules->Size);
+			info.Hash = HashUtils::Combine(info.Hash, static_cast<uint64_t>(modules->ModifiedTime));
+		}
+		return info;
+	}
+
+	/**
+	 * @brief 获取 Java 运行时信息
+	 * @param javaPath Java 可执行文件路径
+	 * @return 运行时信息，无法探测时返回 std::nullopt
+	 */
+	std::optional<JavaRuntimeInfo> CdsArchiveCache::GetRuntime(const std::filesystem::path &javaPath) {
+		auto release = FileStamp::Read(javaPath.parent_path().parent_path() / "release");
+		if (!release) return std::nullopt;
+
+		auto key = javaPath.lexically_normal().generic_string();
+		{
+			std::lock_guard lock(m_mutex);
+			auto it = m_runtimes.find(key);
+			if (it != m_runtimes.end() && it->second.Release == *release) return it->second.Info;
+		}
+
+		// 探测在锁外进行，并发探测同一路径时结果相同，后写入者覆盖即可
+		auto info = ProbeRuntime(javaPath);
+		std::lock_guard lock(m_mutex);
+		m_runtimes[key] = { *release, info };
+		return info;
+	}
+
+	/**
+	 * @brief 从磁盘加载记录
+	 * @return 是否成功读取到有效记录
+	 */
+	bool CdsArchiveCache::Load() {
+		std::lock_guard lock(m_mutex);
+		m_entries.clear();
+		m_clock = 0;
+		m_dirty = false;
+
+		auto cachePath = m_root / "archives.bin";
+		std::ifstream file(cachePath, std::ios::binary);
+		if (!file.is_open()) return false;
+
+		std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		BinaryReader reader(data);
+
+		if (reader.Read<uint64_t>() != CacheMagic || reader.Read<uint32_t>() != FormatVersion) {
+			LOG_INFO("CDS archive index {} is outdated or invalid, rebuilding.", cachePath.string());
+			m_dirty = true;
+			return false;
+		}
+
+		uint64_t clock = reader.Read<uint64_t>();
+		uint32_t count = reader.Read<uint32_t>();
+		std::vector<Entry> entries;
+		entries.reserve(count);
+		for (uint32_t i = 0; i < count && reader.IsOk(); i++) {
+			Entry entry;
+			entry.Key.VersionHash = reader.Read<uint64_t>();
+			entry.Key.RuntimeHash = reader.Read<uint64_t>();
+			entry.Key.ClasspathHash = reader.Read<uint64_t>();
+			entry.Size = reader.Read<uint64_t>();
+			entry.LastUsed = reader.Read<uint64_t>();
+			entry.DumpAttempts = reader.Read<uint32_t>();
+			entry.PendingDelete = reader.Read<uint8_t>() != 0;
+			entries.push_back(entry);
+		}
+
+		if (!reader.IsOk()) {
+			LOG_WARNING("CDS archive index {} is truncated, rebuilding.", cachePath.string());
+			m_dirty = true;
+			return false;
+		}
+
+		m_entries = std::move(entries);
+		m_clock = clock;
+		RetryPendingLocked();
+		LOG_DEBUG("Loaded CDS archive index with {} entries.", m_entries.size());
+		return true;
+	}
+
+	/**
+	 * @brief 如有修改则将记录保存到磁盘
+	 * @return 无需保存或保存成功时返回 true
+	 */
+	bool CdsArchiveCache::Save() {
+		std::lock_guard lock(m_mutex);
+		if (!m_dirty) return true;
+
+		BinaryWriter writer;
+		writer.Write<uint64_t>(CacheMagic);
+		writer.Write<uint32_t>(FormatVersion);
+		writer.Write<uint64_t>(m_clock);
+		writer.Write<uint32_t>(static_cast<uint32_t>(m_entries.size()));
+		for (const auto &entry : m_entries) {
+			writer.Write<uint64_t>(entry.Key.VersionHash);
+			writer.Write<uint64_t>(entry.Key.RuntimeHash);
+			writer.Write<uint64_t>(entry.Key.ClasspathHash);
+			writer.Write<uint64_t>(entry.Size);
+			writer.Write<uint64_t>(entry.LastUsed);
+			writer.Write<uint32_t>(entry.DumpAttempts);
+			writer.Write<uint8_t>(entry.PendingDelete ? 1 : 0);
+		}
+
+		std::error_code ec;
+		std::filesystem::create_directories(m_root, ec);
+		if (!writer.SaveAtomically(m_root / "archives.bin")) return false;
+		m_dirty = false;
+		return true;
+	}
+
+	/**
+	 * @brief 为一次启动决定 CDS 的使用方式
+	 * @param key 归档键
+	 * @return CDS 决策
+	 */
+	CdsDecision CdsArchiveCache::Acquire(const CdsArchiveKey &key) {
+		std::lock_guard lock(m_mutex);
+
+		// 同一版本与运行时的 Classpath 已变化，旧归档不会再被使用
+		for (size_t i = m_entries.size(); i-- > 0;) {
+			const auto &other = m_entries[i].Key;
+			if (m_entries[i].PendingDelete) continue;
+			if (other.VersionHash == key.VersionHash && other.RuntimeHash == key.RuntimeHash && other.ClasspathHash != key.ClasspathHash) {
+				LOG_INFO("Classpath changed, discarding CDS archive {}", GetArchivePath(other).string());
+				RemoveLocked(i);
+			}
+		}
+
+		auto it = std::find_if(m_entries.begin(), m_entries.end(), [&](const Entry &entry) { return entry.Key == key; });
+		if (it == m_entries.end()) {
+			m_entries.push_back({ key });
+			it = std::prev(m_entries.end());
+			it->LastUsed = m_clock;
+			m_dirty = true;
+		} else if (it->PendingDelete) {
+			// 尚未删除成功的归档又被用到，撤销删除
+			it->PendingDelete = false;
+			m_dirty = true;
+		}
+
+		CdsDecision decision;
+		decision.Key = key;
+		auto archivePath = GetArchivePath(key);
+		auto stamp = FileStamp::Read(archivePath);
+		if (stamp && stamp->Size > 0) {
+			if (it->Size != stamp->Size || it->DumpAttempts != 0) m_dirty = true;
+			it->Size = stamp->Size;
+			it->DumpAttempts = 0;
+			decision.Mode = CdsMode::Use;
+			decision.Argument = "-XX:SharedArchiveFile=" + archivePath.string();
+		} else if (it->DumpAttempts < MaxDumpAttempts) {
+			if (it->Size != 0) m_dirty = true;
+			it->Size = 0;
+			decision.Mode = CdsMode::Dump;
+			decision.Argument = "-XX:ArchiveClassesAtExit=" + archivePath.string();
+
+			// JVM 不会创建归档所在的目录
+			std::error_code ec;
+			std::filesystem::create_directories(m_root, ec);
+		} else {
+			return decision;
+		}
+		decision.ArchivePath = std::move(archivePath);
+
+		TrimLocked(&key);
+		return decision;
+	}
+
+	/**
+	 * @brief 记录按决策实际启动了一次游戏
+	 * @param decision `Acquire` 返回的决策
+	 */
+	void CdsArchiveCache::CommitLaunch(const CdsDecision &decision) {
+		if (decision.Mode == CdsMode::Disabled) return;
+
+		std::lock_guard lock(m_mutex);
+		auto it = std::find_if(m_entries.begin(), m_entries.end(), [&](const Entry &entry) { return entry.Key == decision.Key; });
+		if (it == m_entries.end()) return;
+
+		it->LastUsed = ++m_clock;
+		if (decision.Mode == CdsMode::Dump) it->DumpAttempts++;
+		m_dirty = true;
+	}
+
+	/**
+	 * @brief 按预算淘汰最久未使用的归档
+	 * @return 淘汰的归档数量
+	 */
+	size_t CdsArchiveCache::Trim() {
+		std::lock_guard lock(m_mutex);
+		return TrimLocked(nullptr);
+	}
+
+	/**
+	 * @brief 按预算淘汰，调用方需持有锁
+	 * @param keep 不参与淘汰的键
+	 * @return 淘汰的归档数量
+	 */
+	size_t CdsArchiveCache::TrimLocked(const CdsArchiveKey *keep) {
+		RetryPendingLocked();
+
+		uint64_t total = 0;
+		for (const auto &entry : m_entries) total += entry.Size;
+
+		size_t evicted = 0;
+		while (total > m_budget) {
+			std::optional<size_t> victim;
+			for (size_t i = 0; i < m_entries.size(); i++) {
+				const auto &entry = m_entries[i];
+				if (entry.Size == 0 || entry.PendingDelete || (keep && entry.Key == *keep)) continue;
+				if (!victim || entry.LastUsed < m_entries[*victim].LastUsed) victim = i;
+			}
+			if (!victim) break;
+
+			// 删除失败的归档仍占用磁盘空间，不从总量中扣除
+			uint64_t size = m_entries[*victim].Size;
+			if (RemoveLocked(*victim)) total -= size;
+			evicted++;
+		}
+		if (evicted > 0) m_dirty = true;
+		return evicted;
+	}
+
+	/**
+	 * @brief 删除记录及其归档文件，调用方需持有锁
+	 * @param index 记录下标
+	 */
+	bool CdsArchiveCache::RemoveLocked(size_t index) {
+		auto &entry = m_entries[index];
+		std::error_code ec;
+		std::filesystem::remove(GetArchivePath(entry.Key), ec);
+		if (ec) {
+			// 不能直接丢弃记录，否则归档文件会永远留在磁盘上且不计入预算
+			if (!entry.PendingDelete) {
+				LOG_WARNING("Failed to delete CDS archive, will retry: {}", ec.message());
+				entry.PendingDelete = true;
+				m_dirty = true;
+			}
+			return false;
+		}
+		m_entries.erase(m_entries.begin() + index);
+		m_dirty = true;
+		return true;
+	}
+
+	/**
+	 * @brief 重试删除待删除的归档，调用方需持有锁
+	 */
+	void CdsArchiveCache::RetryPendingLocked() {
+		for (size_t i = m_entries.size(); i-- > 0;) {
+			if (m_entries[i].PendingDelete) RemoveLocked(i);
+		}
+	}
+
+	/**
+	 * @brief 获取归档文件路径
+	 * @param key 归档键
+	 * @return `<root>/<版本>-<运行时>-<Classpath>.jsa`
+	 */
+	std::filesystem::path CdsArchiveCache::GetArchivePath(const CdsArchiveKey &key) const {
+		return m_root / std::format("{:016x}-{:016x}-{:016x}.jsa", key.VersionHash, key.RuntimeHash, key.ClasspathHash);
+	}
+
+	size_t CdsArchiveCache::Size() const {
+		std::lock_guard lock(m_mutex);
+		return m_entries.size();
+	}
+
+	uint64_t CdsArchiveCache::TotalBytes() const {
+		std::lock_guard lock(m_mutex);
+		uint64_t total = 0;
+		for (const auto &entry : m_entries) total += entry.Size;
+		return total;
+	}
+}
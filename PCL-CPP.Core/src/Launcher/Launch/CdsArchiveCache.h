@@ -0,0 +1,193 @@
+#pragma once
+#include "Utils/IO/FileStamp.h"
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace PCL_CPP::Core::Launcher::Launch {
+	/**
+	 * @brief CDS 归档的键
+	 */
+	struct CdsArchiveKey {
+		uint64_t VersionHash = 0;   ///< 编译后版本的 `ResolvedHash`
+		uint64_t RuntimeHash = 0;   ///< Java 运行时标识，见 `JavaRuntimeInfo::Hash`
+		uint64_t ClasspathHash = 0; ///< 传给 JVM 的 Classpath 字符串的哈希
+
+		bool operator==(const CdsArchiveKey &) const = default;
+	};
+
+	/**
+	 * @brief 本次启动对 CDS 归档的使用方式
+	 */
+	enum class CdsMode {
+		Disabled, ///< 不使用 CDS
+		Dump,     ///< 归档尚不存在，退出时由 JVM 生成（`-XX:ArchiveClassesAtExit`）
+		Use       ///< 使用已有归档（`-XX:SharedArchiveFile`）
+	};
+
+	/**
+	 * @brief CDS 决策
+	 */
+	struct CdsDecision {
+		CdsMode Mode = CdsMode::Disabled;  ///< 使用方式
+		std::filesystem::path ArchivePath; ///< 归档文件路径，`Disabled` 时为空
+		std::string Argument;              ///< 需要添加的 JVM 参数，`Disabled` 时为空
+		CdsArchiveKey Key;                 ///< 决策对应的归档键，启动后传给 `CdsArchiveCache::CommitLaunch`
+	};
+
+	/**
+	 * @brief 从 Java 安装目录中探测到的运行时信息
+	 */
+	struct JavaRuntimeInfo {
+		std::string Version; ///< `release` 文件中的 JAVA_VERSION
+		int Major = 0;       ///< 主版本号（1.8 记为 8）
+		uint64_t Hash = 0;   ///< 运行时标识：安装路径、`release` 内容与 `lib/modules` 签名的组合哈希
+	};
+
+	/**
+	 * @brief JVM 动态类数据共享（AppCDS）归档管理
+	 *
+	 * @details
+	 * 以（版本, Java 运行时, Classpath）为键管理 `<root>/<键>.jsa` 归档：
+	 * 1. **生成与复用**：归档不存在时返回 `Dump`，由 JVM 在游戏退出时写出；之后的启动返回 `Use`。
+	 *    只有经 `CommitLaunch` 确认实际启动的 `Dump` 才计入尝试次数，连续 `MaxDumpAttempts` 次启动后仍未能生成归档
+	 *    （例如游戏总是异常退出）时不再尝试，避免每次退出都承担转储开销。
+	 * 2. **自动失效**：JDK 更新会改变运行时标识，依赖库变化会改变 Classpath 哈希，二者都会得到新的键；
+	 *    同一版本与运行时的 Classpath 发生变化时，旧归档立即删除。
+	 * 3. **容量控制**：归档总大小超过预算时按最近启动时间淘汰。归档文件无法删除（例如仍被运行中的 JVM 映射）时，
+	 *    记录保留为待删除状态，在之后的淘汰与 `Load` 时重试。
+	 * 4. **可测试**：运行时信息只读取 Java 安装目录中的 `release` 文件，不启动 JVM。
+	 *
+	 * 仅规划而未启动时，记录只在确有变化（新增、删除或归档状态改变）时才需要保存。
+	 * 记录文件缺失、损坏或格式版本不符时视为空缓存；所有方法均可并发调用。
+	 */
+	class CdsArchiveCache {
+		public:
+		static constexpr uint32_t FormatVersion = 2;                 ///< 记录文件格式版本
+		static constexpr uint64_t DefaultBudgetBytes = 2ull << 30;   ///< 默认容量预算（2 GiB）
+		static constexpr int MinimumJavaMajor = 13;                  ///< `-XX:ArchiveClassesAtExit` 自 JDK 13 起可用
+		static constexpr uint32_t MaxDumpAttempts = 3;               ///< 同一归档的最大生成尝试次数
+
+		/**
+		 * @brief 构造函数
+		 * @param root 归档目录
+		 * @param budgetBytes 归档总大小预算（字节）
+		 */
+		explicit CdsArchiveCache(std::filesystem::path root, uint64_t budgetBytes = DefaultBudgetBytes);
+
+		/**
+		 * @brief 探测 Java 运行时
+		 * @details 从 `<java>/../../release` 读取版本号；找不到 `release` 文件（例如仅给出了 PATH 中的命令名）时无法判断 JDK 是否变化，返回空。
+		 * @param javaPath Java 可执行文件路径
+		 * @return 运行时信息，无法探测时返回 std::nullopt
+		 */
+		static std::optional<JavaRuntimeInfo> ProbeRuntime(const std::filesystem::path &javaPath);
+
+		/**
+		 * @brief 获取 Java 运行时信息
+		 * @details 
+		 * 按 Java 路径缓存 `ProbeRuntime` 的结果，`release` 文件的状态签名未变化时不再读取文件内容与模块镜像签名。
+		 * JDK 原地更新会重写 `release` 文件，因此仍能被发现。
+		 * @param javaPath Java 可执行文件路径
+		 * @return 运行时信息，无法探测时返回 std::nullopt
+		 */
+		std::optional<JavaRuntimeInfo> GetRuntime(const std::filesystem::path &javaPath);
+
+		/**
+		 * @brief 从磁盘加载记录
+		 * @return 是否成功读取到有效记录
+		 */
+		bool Load();
+
+		/**
+		 * @brief 如有修改则将记录保存到磁盘
+		 * @return 无需保存或保存成功时返回 true
+		 */
+		bool Save();
+
+		/**
+		 * @brief 为一次启动决定 CDS 的使用方式
+		 * @details 
+		 * 同时删除同一版本与运行时下 Classpath 已变化的旧归档，并按预算淘汰。
+		 * 规划不一定会启动，因此这里不更新最近使用时间，也不计入生成尝试次数，见 `CommitLaunch`。
+		 * @param key 归档键
+		 * @return CDS 决策
+		 */
+		CdsDecision Acquire(const CdsArchiveKey &key);
+
+		/**
+		 * @brief 记录按决策实际启动了一次游戏
+		 * @details 更新归档的最近使用时间；决策为 `Dump` 时计入一次生成尝试。决策为 `Disabled` 时不做任何操作。
+		 * @param decision `Acquire` 返回的决策
+		 */
+		void CommitLaunch(const CdsDecision &decision);
+
+		/**
+		 * @brief 按预算淘汰最久未使用的归档
+		 * @return 淘汰的归档数量
+		 */
+		size_t Trim();
+
+		/**
+		 * @brief 获取归档目录
+		 */
+		const std::filesystem::path &GetRoot() const { return m_root; }
+
+		size_t Size() const;           ///< 记录数量
+		uint64_t TotalBytes() const;   ///< 已生成归档的总大小
+
+		private:
+		struct Entry {
+			CdsArchiveKey Key;
+			uint64_t Size = 0;          ///< 归档大小，尚未生成时为 0
+			uint64_t LastUsed = 0;      ///< 最近使用的逻辑时间
+			uint32_t DumpAttempts = 0;  ///< 尚未生成时已尝试的次数
+			bool PendingDelete = false; ///< 归档文件删除失败，等待重试
+		};
+
+		/**
+		 * @brief 缓存的运行时信息
+		 */
+		struct RuntimeSlot {
+			Utils::FileStamp Release;           ///< 探测时 `release` 文件的状态签名
+			std::optional<JavaRuntimeInfo> Info; ///< 探测结果
+		};
+
+		/**
+		 * @brief 获取归档文件路径
+		 */
+		std::filesystem::path GetArchivePath(const CdsArchiveKey &key) const;
+
+		/**
+		 * @brief 删除记录及其归档文件，调用方需持有锁
+		 * @details 归档文件删除失败时保留记录并标记为待删除，下标仍然有效。
+		 * @param index 记录下标
+		 * @return 记录是否已被删除
+		 */
+		bool RemoveLocked(size_t index);
+
+		/**
+		 * @brief 重试删除待删除的归档，调用方需持有锁
+		 */
+		void RetryPendingLocked();
+
+		/**
+		 * @brief 按预算淘汰，调用方需持有锁
+		 * @param keep 不参与淘汰的键
+		 * @return 淘汰的归档数量
+		 */
+		size_t TrimLocked(const CdsArchiveKey *keep);
+
+		std::filesystem::path m_root;
+		uint64_t m_budget;
+		mutable std::mutex m_mutex;
+		std::vector<Entry> m_entries;
+		uint64_t m_clock = 0; ///< 逻辑时钟，每次 `CommitLaunch` 递增
+		bool m_dirty = false;
+		std::unordered_map<std::string, RuntimeSlot> m_runtimes; ///< Java 路径 -> 缓存的运行时信息
+	};
+}
@@ -0,0 +1,76 @@
+#include "pch.h"
+#include "App/Logging/AppLogger.h"
+#include "FileVerifier.h"
+#include "Utils/Hashing/Sha1.h"
+#include "Utils/IO/MappedFile.h"
+#include "Utils/Threading/Parallel.h"
+#include <atomic>
+#include <optional>
+
+using namespace PCL_CPP::Core::Logging;
+using namespace PCL_CPP::Core::Utils;
+
+namespace PCL_CPP::Core::Launcher::Launch {
+
+	/**
+	 * @brief 校验文件列表
+	 * @param files 待校验的文件
+	 * @param cache 可选，校验记录
+	 * @param maxWorkers 最大工作线程数（0 表示使用硬件并发数）
+	 * @return 校验结果
+	 */
+	VerifyResult FileVerifier::Verify(const std::vector<LaunchFile> &files, VerifiedFileCache *cache, size_t maxWorkers) {
+		std::vector<std::optional<VerifyFailureReason>> failures(files.size());
+		std::atomic<size_t> cacheHits = 0;
+		std::atomic<size_t> hashed = 0;
+
+		Parallel::For(files.size(), maxWorkers, [&](size_t i) {
+			const auto &file = files[i];
+			auto stamp = FileStamp::Read(file.Path);
+			if (!stamp) {
+				failures[i] = VerifyFailureReason::Missing;
+				return;
+			}
+			if (file.Size != 0 && stamp->Size != file.Size) {
+				failures[i] = VerifyFailureReason::SizeMismatch;
+				return;
+			}
+			if (file.Sha1.empty()) return;
+
+			if (cache && cache->IsVerified(file.Path, *stamp, file.Sha1)) {
+				cacheHits++;
+				return;
+			}
+
+			MappedFile mapped;
+			if (!mapped.Open(file.Path)) {
+				failures[i] = VerifyFailureReason::Unreadable;
+				return;
+			}
+			Sha1 sha;
+			sha.Update(mapped.Bytes());
+			hashed++;
+
+			if (Sha1::Matches(sha.Finish(), file.Sha1)) {
+				if (cache) cache->Record(file.Path, *stamp, file.Sha1);
+			} else {
+				failures[i] = VerifyFailureReason::HashMismatch;
+				if (cache) cache->Forget(file.Path);
+			}
+		});
+
+		VerifyResult result;
+		result.Checked = files.size();
+		result.CacheHits = cacheHits;
+		result.Hashed = hashed;
+		for (size_t i = 0; i < files.size(); i++) {
+			if (!failures[i]) continue;
+			result.Failures.push_back({ files[i].Path, *failures[i] });
+			LOG_WARNING("Integrity check failed for {} ({})", files[i].Path.string(),
+						*failures[i] == VerifyFailureReason::Missing ? "missing" :
+						*failures[i] == VerifyFailureReason::SizeMismatch ? "size mismatch" :
+						*failures[i] == VerifyFailureReason::HashMismatch ? "sha1 mismatch" : "unreadable");
+		}
+		return result;
+	}
+}
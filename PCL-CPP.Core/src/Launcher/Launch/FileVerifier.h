@@ -0,0 +1,64 @@
+#pragma once
+#include "LaunchPlanner.h"
+#include "VerifiedFileCache.h"
+#include <filesystem>
+#include <vector>
+
+namespace PCL_CPP::Core::Launcher::Launch {
+	/**
+	 * @brief 文件校验失败的原因
+	 */
+	enum class VerifyFailureReason {
+		Missing,      ///< 文件不存在
+		SizeMismatch, ///< 大小与声明不一致
+		HashMismatch, ///< SHA-1 与声明不一致
+		Unreadable    ///< 文件无法读取
+	};
+
+	/**
+	 * @brief 校验失败的文件
+	 */
+	struct VerifyFailure {
+		std::filesystem::path Path;  ///< 文件路径
+		VerifyFailureReason Reason;  ///< 失败原因
+	};
+
+	/**
+	 * @brief 一次校验的结果
+	 */
+	struct VerifyResult {
+		size_t Checked = 0;                 ///< 检查的文件数量
+		size_t CacheHits = 0;               ///< 命中校验记录、未读取内容的文件数量
+		size_t Hashed = 0;                  ///< 计算了 SHA-1 的文件数量
+		std::vector<VerifyFailure> Failures; ///< 校验失败的文件，顺序与输入一致
+
+		/**
+		 * @brief 检查是否全部通过
+		 */
+		bool IsOk() const { return Failures.empty(); }
+	};
+
+	/**
+	 * @brief 启动文件完整性校验器
+	 *
+	 * @details
+	 * 在工作线程池上并行校验 Classpath 与 Native 库文件：
+	 * 1. **签名检查**：每个文件只读取一次状态签名，文件缺失或大小与声明不一致时立即判定失败。
+	 * 2. **记录命中**：签名与期望 SHA-1 均与 `VerifiedFileCache` 中的记录一致时跳过内容校验，
+	 *    已校验过的整合包再次启动时每个文件只需一次 stat。
+	 * 3. **内容校验**：其余文件通过内存映射计算 SHA-1，通过后写入记录，失败时删除旧记录。
+	 *
+	 * 未声明 SHA-1 的文件（如游戏核心 Jar）只检查存在性与声明的大小。
+	 */
+	class FileVerifier {
+		public:
+		/**
+		 * @brief 校验文件列表
+		 * @param files 待校验的文件
+		 * @param cache 可选，校验记录
+		 * @param maxWorkers 最大工作线程数（0 表示使用硬件并发数）
+		 * @return 校验结果
+		 */
+		static VerifyResult Verify(const std::vector<LaunchFile> &files, VerifiedFileCache *cache = nullptr, size_t maxWorkers = 0);
+	};
+}
@@ -0,0 +1,122 @@
+#include "pch.h"
+#include "LaunchPipeline.h"
+#include "FileVerifier.h"
+#include "ProcessRunner.h"
+#include "App/Logging/AppLogger.h"
+#include "Utils/Json/JsonLoader.h"
+#include <format>
+#include <system_error>
+
+using namespace PCL_CPP::Core::Logging;
+
+namespace PCL_CPP::Core::Launcher::Launch {
+
+	/**
+	 * @brief 构造函数
+	 * @param version 编译后的版本模型
+	 * @param ctx 启动上下文
+	 * @param options 流水线配置
+	 */
+	LaunchPipeline::LaunchPipeline(std::shared_ptr<const Version::CompiledVersion> version, const LaunchContext &ctx, LaunchPipelineOptions options)
+		: m_version(version), m_ctx(ctx), m_options(std::move(options)), m_planner(std::move(version), ctx) { }
+
+	/**
+	 * @brief 执行流水线
+	 * @return 执行结果
+	 */
+	LaunchPipelineResult LaunchPipeline::Run() {
+		LaunchPipelineResult result;
+		auto spawn = m_options.Spawn;
+		if (!spawn) spawn = &ProcessRunner::Start;
+
+		// 各任务只写入结果中属于自己的字段，彼此之间无需同步
+		Utils::TaskGraph graph;
+		auto natives = graph.Add("ExtractNatives", [&] { return m_planner.ExtractNatives(); });
+		auto libraries = graph.Add("CheckLibraries", [&] { return CheckLibraries(result); });
+		graph.Add("LoadAssetIndex", [&] { return LoadAssetIndex(result); });
+		auto plan = graph.Add("Plan", [&] {
+			result.StartInfo = m_planner.Plan();
+			return true;
+		});
+		auto spawned = graph.Add("Spawn", [&] { return spawn(result.StartInfo); }, { natives, libraries, plan });
+
+		graph.Run(m_options.MaxWorkers);
+
+		using std::chrono::duration_cast;
+		using std::chrono::microseconds;
+		for (size_t id = 0; id < graph.Size(); id++) {
+			const auto &task = graph.GetTask(id);
+			result.Stages.push_back({ task.Name, task.Status, duration_cast<microseconds>(task.Start), duration_cast<microseconds>(task.Duration()) });
+
+			if (task.Error) {
+				try {
+					std::rethrow_exception(task.Error);
+				} catch (const std::exception &e) {
+					LOG_ERROR("Launch stage {} threw: {}", task.Name, e.what());
+				} catch (...) {
+					LOG_ERROR("Launch stage {} threw an unknown exception", task.Name);
+				}
+			}
+		}
+
+		const auto &spawnTask = graph.GetTask(spawned);
+		result.Spawned = spawnTask.Status == Utils::TaskStatus::Succeeded;
+		if (result.Spawned) m_planner.OnLaunched();
+		result.TimeToSpawn = duration_cast<microseconds>(spawnTask.End);
+
+		std::string path;
+		for (auto id : graph.GetCriticalPath(spawned)) {
+			const auto &task = graph.GetTask(id);
+			result.CriticalPath.push_back(task.Name);
+			if (!path.empty()) path += " -> ";
+			path += std::format("{} ({} us)", task.Name, duration_cast<microseconds>(task.Duration()).count());
+		}
+		LOG_INFO("Pre-launch pipeline finished in {} us, critical path: {}", result.TimeToSpawn.count(), path);
+		return result;
+	}
+
+	/**
+	 * @brief 校验启动所需的文件
+	 * @param result 写入缺失与损坏的文件
+	 * @return 所有文件均通过校验时返回 true
+	 */
+	bool LaunchPipeline::CheckLibraries(LaunchPipelineResult &result) const {
+		auto files = m_planner.GetLaunchFiles();
+		if (!m_options.VerifyIntegrity) {
+			for (auto &file : files) {
+				file.Sha1.clear();
+				file.Size = 0;
+			}
+		}
+
+		auto verified = FileVerifier::Verify(files, m_options.VerifyCache.get(), m_options.MaxWorkers);
+		for (const auto &failure : verified.Failures) {
+			auto &target = failure.Reason == VerifyFailureReason::Missing ? result.MissingFiles : result.CorruptFiles;
+			target.push_back(failure.Path);
+		}
+		if (m_options.VerifyCache) m_options.VerifyCache->Save();
+
+		LOG_DEBUG("Verified {} launch files: {} cached, {} hashed, {} failed", verified.Checked, verified.CacheHits, verified.Hashed, verified.Failures.size());
+		return verified.IsOk();
+	}
+
+	/**
+	 * @brief 加载资源索引
+	 * @param result 写入资源对象数量
+	 * @return 加载成功时返回 true
+	 */
+	bool LaunchPipeline::LoadAssetIndex(LaunchPipelineResult &result) const {
+		auto indexPath = m_ctx.GameRoot / "assets" / "indexes" / (m_version->AssetsIndex + ".json");
+		std::error_code ec;
+		if (m_version->AssetsIndex.empty() || !std::filesystem::is_regular_file(indexPath, ec)) {
+			LOG_WARNING("Asset index not found: {}", indexPath.string());
+			return false;
+		}
+
+		auto index = Utils::JsonLoader::ParseFile(indexPath);
+		if (auto objects = index.find("objects"); objects != index.end() && objects->is_object()) {
+			result.AssetObjectCount = objects->size();
+		}
+		return true;
+	}
+}
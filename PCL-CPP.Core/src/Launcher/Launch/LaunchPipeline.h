@@ -0,0 +1,96 @@
+#pragma once
+#include "LaunchPlanner.h"
+#include "VerifiedFileCache.h"
+#include "Utils/Threading/TaskGraph.h"
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace PCL_CPP::Core::Launcher::Launch {
+	/**
+	 * @brief 启动前流水线的配置
+	 */
+	struct LaunchPipelineOptions {
+		size_t MaxWorkers = 0; ///< 最大工作线程数（0 表示使用硬件并发数）
+		std::function<bool(const ProcessStartInfo &)> Spawn; ///< 拉起进程的函数，为空时使用 `ProcessRunner::Start`
+		bool VerifyIntegrity = true; ///< 是否按声明的大小与 SHA-1 校验依赖库，关闭时只检查文件是否存在
+		std::shared_ptr<VerifiedFileCache> VerifyCache; ///< 可选，校验记录，校验结束后自动保存
+	};
+
+	/**
+	 * @brief 流水线中单个阶段的执行记录
+	 */
+	struct LaunchStage {
+		std::string Name;                   ///< 阶段名称
+		Utils::TaskStatus Status = Utils::TaskStatus::Pending; ///< 执行状态
+		std::chrono::microseconds Start {}; ///< 开始时间（相对于流水线开始）
+		std::chrono::microseconds Duration {}; ///< 耗时
+	};
+
+	/**
+	 * @brief 启动前流水线的执行结果
+	 */
+	struct LaunchPipelineResult {
+		bool Spawned = false;                              ///< 进程是否已成功拉起
+		ProcessStartInfo StartInfo;                        ///< 规划得到的进程启动信息
+		std::vector<std::filesystem::path> MissingFiles;   ///< 缺失的依赖库文件
+		std::vector<std::filesystem::path> CorruptFiles;   ///< 大小或 SHA-1 与声明不一致的依赖库文件
+		size_t AssetObjectCount = 0;                       ///< 资源索引中的对象数量
+		std::vector<LaunchStage> Stages;                   ///< 各阶段的执行记录
+		std::vector<std::string> CriticalPath;             ///< 决定进程拉起时间的阶段序列
+		std::chrono::microseconds TimeToSpawn {};          ///< 从流水线开始到拉起进程结束的耗时
+	};
+
+	/**
+	 * @brief 启动前流水线
+	 *
+	 * @details
+	 * 将启动前的各项准备工作建模为任务图，在工作线程池上并发执行：
+	 * 1. **ExtractNatives**：提取 Native 库。
+	 * 2. **CheckLibraries**：并行校验 Classpath 与 Native 库文件的存在性、大小与 SHA-1，任一文件缺失或损坏时不拉起进程。
+	 * 3. **LoadAssetIndex**：加载资源索引。进程不依赖该阶段，失败只记录警告。
+	 * 4. **Plan**：构建 Classpath、JVM 参数与游戏参数。
+	 * 5. **Spawn**：依赖 1、2、4，三者完成后立即拉起进程，不等待资源索引。拉起成功后调用 `LaunchPlanner::OnLaunched` 记录本次启动。
+	 *
+	 * 执行完成后按 `Spawn` 阶段的关键路径报告决定拉起时间的阶段。
+	 */
+	class LaunchPipeline {
+		public:
+		/**
+		 * @brief 构造函数
+		 * @param version 编译后的版本模型
+		 * @param ctx 启动上下文
+		 * @param options 流水线配置
+		 */
+		LaunchPipeline(std::shared_ptr<const Version::CompiledVersion> version, const LaunchContext &ctx, LaunchPipelineOptions options = {});
+
+		/**
+		 * @brief 执行流水线
+		 * @return 执行结果
+		 */
+		LaunchPipelineResult Run();
+
+		private:
+		/**
+		 * @brief 校验启动所需的文件
+		 * @param result 写入缺失与损坏的文件
+		 * @return 所有文件均通过校验时返回 true
+		 */
+		bool CheckLibraries(LaunchPipelineResult &result) const;
+
+		/**
+		 * @brief 加载资源索引
+		 * @param result 写入资源对象数量
+		 * @return 加载成功时返回 true
+		 */
+		bool LoadAssetIndex(LaunchPipelineResult &result) const;
+
+		std::shared_ptr<const Version::CompiledVersion> m_version;
+		LaunchContext m_ctx;
+		LaunchPipelineOptions m_options;
+		LaunchPlanner m_planner;
+	};
+}
@@ -3,7 +3,11 @@
 #include "LaunchPlanner.h"
 #include "Launcher/Version/Arguments.h"
 #include "Launcher/Version/Library.h"
+#include "Launcher/Version/LibraryResolver.h"
 #include "Launcher/Launch/NativesUtils.h"
+#include "Utils/Hashing/HashUtils.h"
+#include <algorithm>
+#include <iterator>
 
 using namespace PCL_CPP::Core::Logging;
 
@@ -15,13 +19,40 @@ namespace PCL_CPP::Core::Launcher::Launch {
 	 * @param ctx 启动上下文
 	 */
 	LaunchPlanner::LaunchPlanner(const Version::VersionInfo &version, const LaunchContext &ctx)
-		: _version(version), _ctx(ctx) {
+		: LaunchPlanner(Version::CompiledVersion::Compile(version), ctx) { }
 
-		// 初始化功能开关
-		_features = _ctx.CustomFeatures;
+	/**
+	 * @brief 构造函数，使用已编译的版本模型初始化启动规划器
+	 * @param version 编译后的版本模型
+	 * @param ctx 启动上下文
+	 */
+	LaunchPlanner::LaunchPlanner(std::shared_ptr<const Version::CompiledVersion> version, const LaunchContext &ctx)
+		: _version(std::move(version)), _ctx(ctx) {
+
+		_target = _ctx.Target.value_or(Version::TargetEnvironment::Current());
+
+		// 初始化功能开关：目标环境自带的开关被上下文中的自定义开关覆盖
+		_features = _target.Features;
+		for (const auto &[key, value] : _ctx.CustomFeatures) _features[key] = value;
 		// 设置默认功能
 		if (_features.find("is_demo_user") == _features.end()) _features["is_demo_user"] = false;
 		if (_features.find("has_custom_resolution") == _features.end()) _features["has_custom_resolution"] = true;
+
+		_target.Features = _features;
+		_environment = Version::RuleEnvironment::From(_target);
+		ResolveLibraries();
+
+		_storage.GameDirectory = _ctx.GameRoot.string();
+		_storage.AssetsRoot = (_ctx.GameRoot / "assets").string();
+		_storage.LibraryDirectory = (_ctx.GameRoot / "libraries").string();
+		_storage.NativesDirectory = _ctx.NativesDir.string();
+		if (_ctx.SharedNatives) {
+			// 组合目录路径只取决于 Jar 的键，提取之前即可用于构建参数
+			_nativeJars = CollectNativeJars();
+			_storage.NativesDirectory = _ctx.SharedNatives->GetSetDirectory(_nativeJars).string();
+		}
+		_storage.ResolutionWidth = std::to_string(_ctx.Width);
+		_storage.ResolutionHeight = std::to_string(_ctx.Height);
 	}
 
 	/**
@@ -29,105 +60,320 @@ namespace PCL_CPP::Core::Launcher::Launch {
 	 * @return 进程启动信息
 	 */
 	ProcessStartInfo LaunchPlanner::Plan() {
-		ProcessStartInfo info;
-		info.Executable = _ctx.JavaPath;
-		info.WorkingDirectory = _ctx.GameRoot; // 游戏通常在 .minecraft 目录下运行
+		auto info = PlanArguments();
+		_cds = {};
+		if (_ctx.CdsArchives) ApplyCds(info);
+		return info;
+	}
+
+	/**
+	 * @brief 生成不含 CDS 参数的启动信息
+	 * @return 进程启动信息
+	 */
+	ProcessStartInfo LaunchPlanner::PlanArguments() {
+		const auto &cache = _ctx.SkeletonCache;
+		if (!cache || _version->ResolvedHash == 0) return Assemble(BuildClasspath());
+
+		uint64_t contextHash = GetContextHash();
+		auto skeleton = cache->Find(_version->ResolvedHash, contextHash);
+		if (skeleton) {
+			_droppedLibraries = skeleton->DroppedLibraries;
+		} else {
+			skeleton = std::make_shared<const PlanSkeleton>(BuildSkeleton(BuildClasspath(), PlanSkeleton::VolatilePlaceholders));
+			cache->Put(_version->ResolvedHash, contextHash, skeleton);
+		}
+		return Render(*skeleton);
+	}
 
-		// 构建 Classpath
-		std::string cp = BuildClasspath();
+	/**
+	 * @brief 为启动信息添加 CDS 参数
+	 * @param info 进程启动信息
+	 */
+	void LaunchPlanner::ApplyCds(ProcessStartInfo &info) {
+		if (_version->ResolvedHash == 0) return;
+		auto runtime = _ctx.CdsArchives->GetRuntime(_ctx.JavaPath);
+		if (!runtime || runtime->Major < CdsArchiveCache::MinimumJavaMajor) return;
+
+		// 归档与 JVM 实际收到的 Classpath 绑定，直接取最终参数中的值
+		auto cp = std::find_if(info.Arguments.begin(), info.Arguments.end(), [](const std::string &arg) {
+			return arg == "-cp" || arg == "-classpath" || arg == "--class-path";
+		});
+		if (cp == info.Arguments.end() || std::next(cp) == info.Arguments.end()) return;
+
+		CdsArchiveKey key { _version->ResolvedHash, runtime->Hash, Utils::HashUtils::Fnv1a64(*std::next(cp)) };
+		_cds = _ctx.CdsArchives->Acquire(key);
+		_ctx.CdsArchives->Save();
+		if (_cds.Mode == CdsMode::Disabled) return;
+
+		// JVM 选项只需位于主类之前，放在最前面即可
+		info.Arguments.insert(info.Arguments.begin(), _cds.Argument);
+	}
 
-		// 构建 JVM 参数
-		auto jvmArgs = BuildJvmArgs(cp);
-		info.Arguments.insert(info.Arguments.end(), jvmArgs.begin(), jvmArgs.end());
+	/**
+	 * @brief 通知规划器已按最近一次规划的结果拉起游戏进程
+	 */
+	void LaunchPlanner::OnLaunched() {
+		if (!_ctx.CdsArchives || _cds.Mode == CdsMode::Disabled) return;
+		_ctx.CdsArchives->CommitLaunch(_cds);
+		_ctx.CdsArchives->Save();
+	}
 
-		// 添加主类
-		info.Arguments.push_back(_version.MainClass);
+	/**
+	 * @brief 为多个目标环境批量规划
+	 * @param version 编译后的版本模型
+	 * @param ctx 启动上下文
+	 * @param targets 目标环境列表
+	 * @return 与目标环境一一对应的进程启动信息
+	 */
+	std::vector<ProcessStartInfo> LaunchPlanner::PlanBatch(std::shared_ptr<const Version::CompiledVersion> version, const LaunchContext &ctx, const std::vector<Version::TargetEnvironment> &targets) {
+		std::vector<LaunchPlanner> planners;
+		planners.reserve(targets.size());
+		for (const auto &target : targets) {
+			LaunchContext targetCtx = ctx;
+			targetCtx.Target = target;
+			planners.emplace_back(version, targetCtx);
+		}
 
-		// 构建游戏参数
-		auto gameArgs = BuildGameArgs();
-		info.Arguments.insert(info.Arguments.end(), gameArgs.begin(), gameArgs.end());
+		// 各目标的依赖库已在构造规划器时筛选并去重
+		std::vector<ProcessStartInfo> results;
+		results.reserve(planners.size());
+		for (auto &planner : planners) {
+			results.push_back(planner.Assemble(planner.BuildClasspath()));
+		}
+		return results;
+	}
 
+	/**
+	 * @brief 以构建好的 Classpath 组装启动信息
+	 * @param cp Classpath 字符串
+	 * @return 进程启动信息
+	 */
+	ProcessStartInfo LaunchPlanner::Assemble(const std::string &cp) {
+		PlanSkeleton skeleton = BuildSkeleton(cp, 0);
+
+		// 不保留任何占位符时骨架全部为字面量，直接移出
+		ProcessStartInfo info;
+		info.Executable = std::move(skeleton.Executable);
+		info.WorkingDirectory = std::move(skeleton.WorkingDirectory);
+		info.Arguments.reserve(skeleton.Arguments.size());
+		for (auto &arg : skeleton.Arguments) {
+			info.Arguments.push_back(std::move(arg).Render({}));
+		}
 		return info;
 	}
 
 	/**
-	 * @brief 构建 Classpath 字符串
-	 * @return 完整的 Classpath 字符串，以分号分隔
+	 * @brief 以构建好的 Classpath 生成规划骨架
+	 * @param cp Classpath 字符串
+	 * @param keep 需保留的内置占位符位图
+	 * @return 规划骨架
 	 */
-	std::string LaunchPlanner::BuildClasspath() {
-		std::string cp;
-		std::string separator = ";"; 
+	PlanSkeleton LaunchPlanner::BuildSkeleton(const std::string &cp, uint32_t keep) {
+		PlanSkeleton skeleton;
+		skeleton.Executable = _ctx.JavaPath;
+		skeleton.WorkingDirectory = _ctx.GameRoot; // 游戏通常在 .minecraft 目录下运行
 
-		auto librariesDir = _ctx.GameRoot / "libraries";
+		// 替换表只构建一次，游戏参数与 JVM 参数共用
+		auto subs = GetSubstitutions();
+		auto gameArgs = BuildGameArgs(subs, keep);
 
-		// 处理依赖库
-		const auto &libsJson = _version.RawData["libraries"];
-		for (const auto &j : libsJson) {
-			auto lib = Version::Library::Parse(j);
+		// 构建 JVM 参数（仅 JVM 参数可引用 ${classpath}，替换表只记录视图，不复制 Classpath）
+		subs.Set(Version::Placeholder::Classpath, cp);
+		auto jvmArgs = BuildJvmArgs(cp, subs, keep);
 
-			// 仅考虑当前环境下激活的库
-			if (!lib.IsActive(_features)) continue;
+		skeleton.Arguments.reserve(jvmArgs.size() + 1 + gameArgs.size());
+		std::move(jvmArgs.begin(), jvmArgs.end(), std::back_inserter(skeleton.Arguments));
 
+		// 添加主类
+		skeleton.Arguments.push_back(Version::ArgumentTemplate::Literal(_version->MainClass));
+
+		// 添加游戏参数
+		std::move(gameArgs.begin(), gameArgs.end(), std::back_inserter(skeleton.Arguments));
+
+		skeleton.DroppedLibraries = _droppedLibraries;
+		return skeleton;
+	}
+
+	/**
+	 * @brief 以当前上下文的认证信息与分辨率渲染规划骨架
+	 * @param skeleton 规划骨架
+	 * @return 进程启动信息
+	 */
+	ProcessStartInfo LaunchPlanner::Render(const PlanSkeleton &skeleton) const {
+		auto subs = GetSubstitutions();
+
+		ProcessStartInfo info;
+		info.Executable = skeleton.Executable;
+		info.WorkingDirectory = skeleton.WorkingDirectory;
+		info.Arguments.reserve(skeleton.Arguments.size());
+		for (const auto &arg : skeleton.Arguments) {
+			info.Arguments.push_back(arg.Render(subs));
+		}
+		return info;
+	}
+
+	/**
+	 * @brief 计算启动上下文哈希
+	 * @return 上下文哈希
+	 */
+	uint64_t LaunchPlanner::GetContextHash() const {
+		using Utils::HashUtils;
+		uint64_t hash = HashUtils::Fnv1aOffset;
+		auto mixText = [&](std::string_view text) { hash = HashUtils::Combine(hash, HashUtils::Fnv1a64(text)); };
+		auto mixValue = [&](uint64_t value) { hash = HashUtils::Combine(hash, value); };
+
+		mixText(_ctx.JavaPath.string());
+		mixValue(static_cast<uint64_t>(_ctx.MaxMemoryMb));
+		mixValue(static_cast<uint64_t>(_ctx.MinMemoryMb));
+		mixValue(_ctx.Fullscreen);
+		mixText(_storage.GameDirectory);
+		mixText(_storage.NativesDirectory);
+		mixValue(static_cast<uint64_t>(_ctx.LibraryPolicy));
+
+		// 目标环境与合并后的功能开关（std::map 有序，遍历顺序稳定）
+		mixText(_target.OsName);
+		mixText(_target.OsVersion);
+		mixText(_target.OsArch);
+		for (const auto &[name, enabled] : _features) {
+			mixText(name);
+			mixValue(enabled);
+		}
+		return hash;
+	}
+
+	/**
+	 * @brief 按目标环境筛选依赖库
+	 */
+	void LaunchPlanner::ResolveLibraries() {
+		// 规则只在此处求值；之后的规划、提取与文件收集只读取结果，彼此之间可以并发
+		_classpathLibraries = Version::LibraryResolver(_ctx.LibraryPolicy);
+		_nativeLibraries = Version::LibraryResolver(_ctx.LibraryPolicy);
+		for (const auto &lib : _version->Libraries) {
+			if (!lib.IsActive(_environment)) continue;
 			// Classpath 中不包含 Native 库（它们由 java.library.path 处理）
-			if (lib.IsNative()) continue;
+			if (lib.IsNative(_target.OsName)) {
+				_nativeLibraries.Add(lib);
+			} else {
+				_classpathLibraries.Add(lib);
+			}
+		}
 
-			// 获取库文件路径
-			auto fileInfo = lib.GetApplicableFile(_features);
-			std::filesystem::path libPath;
+		// 每个规划器只记录一次，规划与骨架缓存命中时不再重复输出
+		for (const auto &dropped : _classpathLibraries.GetDropped()) {
+			LOG_DEBUG("Dropped duplicate library {} in favor of {}", dropped.Name, dropped.KeptName);
+		}
+	}
+
+	/**
+	 * @brief 构建 Classpath 字符串
+	 * @return 完整的 Classpath 字符串，以目标系统的分隔符分隔
+	 */
+	std::string LaunchPlanner::BuildClasspath() {
+		return JoinClasspath(_classpathLibraries);
+	}
 
+	/**
+	 * @brief 以去重后的依赖库拼接 Classpath，并记录被丢弃的库
+	 * @param resolver 已添加完所有 Classpath 库的解析器
+	 * @return 完整的 Classpath 字符串
+	 */
+	std::string LaunchPlanner::JoinClasspath(const Version::LibraryResolver &resolver) {
+		const auto &libraries = resolver.GetLibraries();
+		std::string_view separator = _target.ClasspathSeparator();
+
+		// 所有库路径写入同一块缓冲区，避免逐个构造 std::filesystem::path
+		Version::LibraryPathArena arena(_storage.LibraryDirectory);
+		arena.Reserve(libraries.size(), libraries.size() * 64);
+		for (const auto *lib : libraries) {
+			auto fileInfo = GetLibraryFile(*lib);
 			if (fileInfo && !fileInfo->Path.empty()) {
-				libPath = librariesDir / fileInfo->Path;
+				arena.AddPath(fileInfo->Path);
+			} else if (auto coordinate = Version::MavenCoordinate::Parse(lib->Name)) {
+				arena.AddCoordinate(*coordinate);
 			} else {
-				// 如果没有显式路径，则根据 Maven 坐标构造
-				libPath = librariesDir / MavenUtils::GetPath(lib.Name);
+				arena.AddPath({});
 			}
-
-			if (!cp.empty()) cp += separator;
-			cp += libPath.string();
 		}
 
-		// 添加 Minecraft 核心 Jar 文件
-		std::filesystem::path clientJar;
-		if (!_version.Jar.empty()) {
-			clientJar = _ctx.GameRoot / "versions" / _version.Jar / (_version.Jar + ".jar");
-		} else {
-			clientJar = _version.RootPath / (_version.Jar + ".jar");
+		std::string clientJar = GetClientJarPath().string();
+		std::string cp;
+		cp.reserve(arena.Bytes() + arena.Size() * separator.size() + clientJar.size());
+		for (size_t i = 0; i < arena.Size(); i++) {
+			cp.append(arena[i]).append(separator);
 		}
 
-		if (!cp.empty()) cp += separator;
-		cp += clientJar.string();
+		// 添加 Minecraft 核心 Jar 文件
+		cp += clientJar;
 
+		_droppedLibraries = resolver.GetDropped();
 		return cp;
 	}
 
 	/**
-	 * @brief 获取参数替换映射表
-	 * @return 包含所有预定义变量替换的映射
+	 * @brief 获取已激活依赖库在目标环境下的文件信息
+	 * @param lib 已激活的依赖库
+	 * @return 适用的文件信息
+	 */
+	std::optional<Version::FileInfo> LaunchPlanner::GetLibraryFile(const Version::Library &lib) const {
+		return lib.SelectFile(_target.OsName, _target.OsArch);
+	}
+
+	/**
+	 * @brief 获取依赖库文件的路径
+	 * @param lib 依赖库
+	 * @return 库文件的完整路径
+	 */
+	std::filesystem::path LaunchPlanner::GetLibraryPath(const Version::Library &lib) const {
+		auto librariesDir = _ctx.GameRoot / "libraries";
+		auto fileInfo = GetLibraryFile(lib);
+		if (fileInfo && !fileInfo->Path.empty()) {
+			return librariesDir / fileInfo->Path;
+		}
+		// 如果没有显式路径，则根据 Maven 坐标构造
+		return librariesDir / MavenUtils::GetPath(lib.Name);
+	}
+
+	/**
+	 * @brief 获取游戏核心 Jar 的路径
+	 */
+	std::filesystem::path LaunchPlanner::GetClientJarPath() const {
+		if (!_version->Jar.empty()) {
+			return _ctx.GameRoot / "versions" / _version->Jar / (_version->Jar + ".jar");
+		}
+		return _version->RootPath / (_version->Jar + ".jar");
+	}
+
+	/**
+	 * @brief 获取参数替换表
+	 * @return 包含所有预定义变量替换的替换表
 	 */
-	std::map<std::string, std::string> LaunchPlanner::GetSubstitutions() {
-		std::map<std::string, std::string> subs;
+	Version::SubstitutionTable LaunchPlanner::GetSubstitutions() const {
+		using Version::Placeholder;
+		Version::SubstitutionTable subs;
 
 		// 身份认证信息
-		subs["auth_player_name"] = _ctx.Auth.PlayerName;
-		subs["auth_uuid"] = _ctx.Auth.Uuid;
-		subs["auth_access_token"] = _ctx.Auth.AccessToken;
-		subs["user_type"] = _ctx.Auth.UserType;
+		subs.Set(Placeholder::AuthPlayerName, _ctx.Auth.PlayerName);
+		subs.Set(Placeholder::AuthUuid, _ctx.Auth.Uuid);
+		subs.Set(Placeholder::AuthAccessToken, _ctx.Auth.AccessToken);
+		subs.Set(Placeholder::UserType, _ctx.Auth.UserType);
 
 		// 版本信息
-		subs["version_name"] = _version.Id;
-		subs["version_type"] = _version.Type;
-		subs["assets_index_name"] = _version.AssetsIndex;
+		subs.Set(Placeholder::VersionName, _version->Id);
+		subs.Set(Placeholder::VersionType, _version->Type);
+		subs.Set(Placeholder::AssetsIndexName, _version->AssetsIndex);
 
 		// 路径信息
-		subs["game_directory"] = _ctx.GameRoot.string();
-		subs["assets_root"] = (_ctx.GameRoot / "assets").string();
-		subs["natives_directory"] = _ctx.NativesDir.string();
-		subs["launcher_name"] = "PCL2-CE-CPP";
-		subs["launcher_version"] = "0.0.1";
+		subs.Set(Placeholder::GameDirectory, _storage.GameDirectory);
+		subs.Set(Placeholder::AssetsRoot, _storage.AssetsRoot);
+		subs.Set(Placeholder::NativesDirectory, _storage.NativesDirectory);
+		subs.Set(Placeholder::LibraryDirectory, _storage.LibraryDirectory);
+		subs.Set(Placeholder::ClasspathSeparator, _target.ClasspathSeparator());
+		subs.Set(Placeholder::LauncherName, "PCL2-CE-CPP");
+		subs.Set(Placeholder::LauncherVersion, "0.0.1");
 
 		// 分辨率设置
-		subs["resolution_width"] = std::to_string(_ctx.Width);
-		subs["resolution_height"] = std::to_string(_ctx.Height);
+		subs.Set(Placeholder::ResolutionWidth, _storage.ResolutionWidth);
+		subs.Set(Placeholder::ResolutionHeight, _storage.ResolutionHeight);
 
 		return subs;
 	}
@@ -135,28 +381,29 @@ namespace PCL_CPP::Core::Launcher::Launch {
 	/**
 	 * @brief 构建 JVM 启动参数
 	 * @param classpath 构建好的 Classpath 字符串
-	 * @return JVM 参数列表
+	 * @param subs 参数替换表（已包含 classpath）
+	 * @param keep 需保留的内置占位符位图
+	 * @return 部分渲染后的 JVM 参数
 	 */
-	std::vector<std::string> LaunchPlanner::BuildJvmArgs(const std::string &classpath) {
-		std::vector<std::string> args;
+	std::vector<Version::ArgumentTemplate> LaunchPlanner::BuildJvmArgs(const std::string &classpath, const Version::SubstitutionTable &subs, uint32_t keep) {
+		using Version::ArgumentTemplate;
+		std::vector<ArgumentTemplate> args;
 
 		// 基础 JVM 参数（内存设置）
-		args.push_back("-Xmx" + std::to_string(_ctx.MaxMemoryMb) + "m");
+		args.push_back(ArgumentTemplate::Literal("-Xmx" + std::to_string(_ctx.MaxMemoryMb) + "m"));
 
 		// 处理版本特定的 JVM 参数
-		if (_version.RawData.contains("arguments") && _version.RawData["arguments"].contains("jvm")) {
-			auto argParser = Version::Arguments::Parse(_version.RawData["arguments"]);
-			auto subs = GetSubstitutions();
-			subs["classpath"] = classpath; // 注入 Classpath 变量
-
-			auto dynamicArgs = argParser.GetJvmArgs(subs, _features);
-			args.insert(args.end(), dynamicArgs.begin(), dynamicArgs.end());
+		if (_version->HasJvmArguments) {
+			std::vector<std::string> unknown;
+			auto dynamicArgs = _version->Args.BindJvmArgs(subs, _environment, keep, &unknown);
+			std::move(dynamicArgs.begin(), dynamicArgs.end(), std::back_inserter(args));
+			ReportUnknownPlaceholders(unknown);
 		} else {
 			// 兼容旧版（通常是 1.13 以下版本）
 			// 如果 arguments.jvm 缺失，必须提供默认的旧版参数
-			args.push_back("-Djava.library.path=" + _ctx.NativesDir.string());
-			args.push_back("-cp");
-			args.push_back(classpath);
+			args.push_back(ArgumentTemplate::Literal("-Djava.library.path=" + _storage.NativesDirectory));
+			args.push_back(ArgumentTemplate::Literal("-cp"));
+			args.push_back(ArgumentTemplate::Literal(classpath));
 		}
 
 		return args;
@@ -164,76 +411,108 @@ namespace PCL_CPP::Core::Launcher::Launch {
 
 	/**
 	 * @brief 构建游戏启动参数
-	 * @return 游戏参数列表
+	 * @param subs 参数替换表
+	 * @param keep 需保留的内置占位符位图
+	 * @return 部分渲染后的游戏参数
 	 */
-	std::vector<std::string> LaunchPlanner::BuildGameArgs() {
-		auto subs = GetSubstitutions();
-		std::vector<std::string> args;
+	std::vector<Version::ArgumentTemplate> LaunchPlanner::BuildGameArgs(const Version::SubstitutionTable &subs, uint32_t keep) {
+		std::vector<Version::ArgumentTemplate> args;
+		std::vector<std::string> unknown;
 
-		if (_version.RawData.contains("arguments") && _version.RawData["arguments"].contains("game")) {
+		if (_version->HasGameArguments) {
 			// 现代版本 (1.13+)
-			auto argParser = Version::Arguments::Parse(_version.RawData["arguments"]);
-			args = argParser.GetGameArgs(subs, _features);
-		} else if (_version.RawData.contains("minecraftArguments")) {
+			args = _version->Args.BindGameArgs(subs, _environment, keep, &unknown);
+		} else if (_version->HasLegacyArguments) {
 			// 旧版 (1.7.10 - 1.12.2)
-			// 使用简单的空格分割并手动替换变量
-			std::string raw = _version.RawData["minecraftArguments"].get<std::string>();
-
-			std::stringstream ss(raw);
-			std::string segment;
-			while (std::getline(ss, segment, ' ')) {
-				if (!segment.empty()) {
-					for (const auto &[key, val] : subs) {
-						std::string placeholder = "${" + key + "}";
-						size_t pos = 0;
-						while ((pos = segment.find(placeholder, pos)) != std::string::npos) {
-							segment.replace(pos, placeholder.length(), val);
-							pos += val.length();
-						}
-					}
-					args.push_back(segment);
-				}
+			// 参数已在编译时按空格切分为模板，与现代版共用渲染逻辑
+			args.reserve(_version->LegacyGameArguments.size());
+			for (const auto &segment : _version->LegacyGameArguments) {
+				args.push_back(segment.Bind(subs, keep, &unknown));
 			}
 		}
 
+		ReportUnknownPlaceholders(unknown);
 		return args;
 	}
 
+	/**
+	 * @brief 记录渲染参数时遇到的未知占位符
+	 * @param unknown 未知占位符名称
+	 */
+	void LaunchPlanner::ReportUnknownPlaceholders(const std::vector<std::string> &unknown) const {
+		for (const auto &name : unknown) {
+			LOG_WARNING("Unknown argument placeholder ${{{}}} in version {}", name, _version->Id);
+		}
+	}
+
+	/**
+	 * @brief 获取启动所需的全部文件
+	 * @return 文件列表
+	 */
+	std::vector<LaunchFile> LaunchPlanner::GetLaunchFiles() const {
+		const auto &classpath = _classpathLibraries.GetLibraries();
+		const auto &natives = _nativeLibraries.GetLibraries();
+
+		std::vector<LaunchFile> files;
+		files.reserve(classpath.size() + natives.size() + 1);
+		auto add = [&](const Version::Library &lib, bool isNative) {
+			LaunchFile file;
+			file.Path = GetLibraryPath(lib);
+			file.IsNative = isNative;
+			if (auto fileInfo = GetLibraryFile(lib)) {
+				file.Sha1 = fileInfo->Sha1;
+				file.Size = fileInfo->Size;
+			}
+			files.push_back(std::move(file));
+		};
+
+		for (const auto *lib : classpath) add(*lib, false);
+		files.push_back({ GetClientJarPath() });
+		for (const auto *lib : natives) add(*lib, true);
+		return files;
+	}
+
 	/**
 	 * @brief 提取当前版本所需的 Native 库
 	 * @return 是否全部提取成功
 	 */
     bool LaunchPlanner::ExtractNatives() {
-        const auto& libsJson = _version.RawData["libraries"];
-        auto librariesDir = _ctx.GameRoot / "libraries";
-
-        for (const auto& j : libsJson) {
-            auto lib = Version::Library::Parse(j);
-            
-            if (!lib.IsActive(_features)) continue;
-            if (!lib.IsNative()) continue;
-
-            auto fileInfo = lib.GetApplicableFile(_features);
-            std::filesystem::path jarPath;
-
-            if (fileInfo && !fileInfo->Path.empty()) {
-                jarPath = librariesDir / fileInfo->Path;
-            } else {
-                // 如果 Native 路径缺失，尝试回退到默认路径构造
-                jarPath = librariesDir / MavenUtils::GetPath(lib.Name, "jar", ""); 
-            }
+        if (_ctx.SharedNatives) return _ctx.SharedNatives->Prepare(_nativeJars);
 
-            // 处理提取排除规则
-            std::vector<std::string> excludes;
-            if (lib.Extract.has_value()) {
-                excludes = lib.Extract->Exclude;
-            }
+        // 旧目录中可能残留其他版本的文件；异步清理只需一次重命名，删除在后台进行
+        NativesUtils::CleanAsync(_ctx.NativesDir);
+
+        std::vector<NativesExtractJob> jobs;
+        for (auto& jar : CollectNativeJars()) jobs.push_back({ std::move(jar.Path), _ctx.NativesDir, std::move(jar.Exclude) });
 
-            if (!NativesUtils::Extract(jarPath, _ctx.NativesDir, excludes)) {
-                LOG_WARNING("Failed to extract native library: {}", lib.Name);
+        auto result = NativesUtils::ExtractBatch(jobs);
+        for (size_t i = 0; i < jobs.size(); i++) {
+            if (!result.Succeeded[i]) {
+                LOG_WARNING("Failed to extract native library: {}", jobs[i].JarPath.string());
                 // 这里暂时不中断流程，尝试继续启动
             }
         }
         return true;
     }
+
+	/**
+	 * @brief 收集需要提取的 Native 库 Jar
+	 * @return 按版本配置顺序排列的 Jar 列表
+	 */
+	std::vector<NativesCache::NativeJar> LaunchPlanner::CollectNativeJars() const {
+		// Native 库在构造时同样按坐标去重，避免同一个库的多个版本相互覆盖
+		const auto &natives = _nativeLibraries.GetLibraries();
+
+		std::vector<NativesCache::NativeJar> jars;
+		jars.reserve(natives.size());
+		for (const auto *lib : natives) {
+			NativesCache::NativeJar jar;
+			jar.Path = GetLibraryPath(*lib);
+			if (auto fileInfo = GetLibraryFile(*lib)) jar.Sha1 = fileInfo->Sha1;
+			// 处理提取排除规则
+			if (lib->Extract.has_value()) jar.Exclude = lib->Extract->Exclude;
+			jars.push_back(std::move(jar));
+		}
+		return jars;
+	}
 }
@@ -1,8 +1,15 @@
 #pragma once
+#include "Launcher/Version/CompiledVersion.h"
+#include "Launcher/Version/LibraryResolver.h"
+#include "Launcher/Version/MavenCoordinate.h"
+#include "Launcher/Launch/CdsArchiveCache.h"
+#include "Launcher/Launch/NativesCache.h"
+#include "Launcher/Launch/PlanSkeletonCache.h"
 #include "Launcher/Version/VersionLocator.h"
 #include <filesystem>
 #include <map>
-#include <sstream>
+#include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -38,9 +45,22 @@ namespace PCL_CPP::Core::Launcher::Launch {
 		// 路径配置
 		std::filesystem::path GameRoot; ///< 游戏根目录 (.minecraft 目录)
 		std::filesystem::path NativesDir; ///< Natives 库提取目录
+		std::shared_ptr<NativesCache> SharedNatives; ///< 可选，内容寻址的 Natives 缓存；设置后忽略 `NativesDir`，使用缓存中的组合目录
 
 		// 功能覆盖
 		std::map<std::string, bool> CustomFeatures; ///< 自定义功能开关覆盖
+
+		// 依赖库去重
+		Version::LibraryConflictPolicy LibraryPolicy = Version::LibraryConflictPolicy::ChildWins; ///< 同一 group:artifact 出现多次时的处理策略
+
+		// 目标环境
+		std::optional<Version::TargetEnvironment> Target; ///< 规划目标环境，未设置时为当前系统
+
+		// 规划缓存
+		std::shared_ptr<PlanSkeletonCache> SkeletonCache; ///< 规划骨架缓存，为空时每次规划都从头构建；认证信息与分辨率不影响命中
+
+		// 类数据共享
+		std::shared_ptr<CdsArchiveCache> CdsArchives; ///< 可选，CDS 归档缓存；设置后为 JDK 13+ 运行时生成或复用 AppCDS 归档
 	};
 
 	/**
@@ -69,6 +89,16 @@ namespace PCL_CPP::Core::Launcher::Launch {
 		}
 	};
 
+	/**
+	 * @brief 启动所需的文件
+	 */
+	struct LaunchFile {
+		std::filesystem::path Path; ///< 文件完整路径
+		std::string Sha1;           ///< 版本配置中声明的 SHA-1 校验值，未声明时为空
+		size_t Size = 0;            ///< 版本配置中声明的文件大小，未声明时为 0
+		bool IsNative = false;      ///< 是否为需要提取的 Native 库
+	};
+
 	/**
 	 * @brief Maven 标识符工具类
 	 */
@@ -78,6 +108,7 @@ namespace PCL_CPP::Core::Launcher::Launch {
 		 * @brief 将 Maven 标识符转换为文件路径
 		 * 
 		 * 例如: "com.google.guava:guava:31.0" -> "com/google/guava/guava/31.0/guava-31.0.jar"
+		 * 坐标中的分类器与 @ext 扩展名同样生效，例如 "net.minecraftforge:forge:40.1.0:universal@zip" -> ".../forge-40.1.0-universal.zip"
 		 * 
 		 * @param mavenId Maven 标识符
 		 * @param extension 文件扩展名 (默认为 jar)
@@ -85,28 +116,14 @@ namespace PCL_CPP::Core::Launcher::Launch {
 		 * @return 对应的相对文件路径
 		 */
 		static std::filesystem::path GetPath(const std::string &mavenId, const std::string &extension = "jar", const std::string &classifier = "") {
-			std::vector<std::string> parts;
-			std::stringstream ss(mavenId);
-			std::string item;
-			while (std::getline(ss, item, ':')) {
-				parts.push_back(item);
-			}
-
-			if (parts.size() < 3) return {};
-
-			std::string group = parts[0];
-			std::string artifact = parts[1];
-			std::string version = parts[2];
+			auto coordinate = Version::MavenCoordinate::Parse(mavenId);
+			if (!coordinate) return {};
 
-			std::replace(group.begin(), group.end(), '.', '/');
+			// 参数中的分类器与扩展名优先，扩展名仅在坐标未显式声明时生效
+			if (!classifier.empty()) coordinate->Classifier = classifier;
+			if (extension != "jar" && mavenId.find('@') == std::string::npos) coordinate->Extension = extension;
 
-			std::string filename = artifact + "-" + version;
-			if (!classifier.empty()) {
-				filename += "-" + classifier;
-			}
-			filename += "." + extension;
-
-			return std::filesystem::path(group) / artifact / version / filename;
+			return std::filesystem::path(coordinate->GetPath());
 		}
 	};
 
@@ -115,24 +132,42 @@ namespace PCL_CPP::Core::Launcher::Launch {
 	 * 
 	 * @details 
 	 * 该类的核心逻辑包括：
-	 * 1. **Classpath 构建**：遍历所有依赖库，根据当前系统环境（OS、架构）筛选激活的库，并拼接成完整的 Classpath 字符串。
+	 * 1. **Classpath 构建**：遍历所有依赖库，根据目标环境（OS、架构，默认为当前系统）筛选激活的库，并以目标系统的分隔符拼接成完整的 Classpath 字符串。
 	 * 2. **参数构建**：支持现代（1.13+，基于 Arguments 对象）和旧版（1.12.2-，基于 minecraftArguments 字符串）两种参数解析方式。
-	 * 3. **变量替换**：建立一套占位符映射表（如 `${auth_player_name}`、`${game_directory}`），在生成最终参数时进行全局替换。
+	 * 3. **变量替换**：建立一套占位符替换表（如 `${auth_player_name}`、`${game_directory}`），在生成最终参数时按预编译的参数模板单次渲染。
 	 * 4. **环境准备**：在启动前自动处理 Natives 动态库的提取，确保 Java 能够加载到必要的系统依赖。
+	 * 5. **类数据共享**：可选地为每个（版本, Java 运行时, Classpath）管理 AppCDS 归档，首次启动时生成，之后的启动直接映射已加载的类。
+	 *
+	 * 依赖库的启用规则只在构造时求值一次，筛选结果之后只读；因此构造完成后 `Plan`、`ExtractNatives` 与 `GetLaunchFiles`
+	 * 可以在不同线程中同时调用（`Plan` 与 `ExtractNatives` 各自不应与自身并发调用）。
 	 */
 	class LaunchPlanner {
     public:
 		/**
 		 * @brief 构造函数
+		 * @details 
+		 * 在此处将版本编译为 `CompiledVersion`。如果传入的是 `VersionLocator::ListVersions` 返回的仅含头部字段的版本，
+		 * 会先按需加载完整配置。
 		 * @param version 版本信息
 		 * @param ctx 启动上下文
+		 * @throws std::runtime_error 仅含头部字段的版本无法加载完整配置
 		 */
         LaunchPlanner(const Version::VersionInfo &version, const LaunchContext &ctx);
 
+		/**
+		 * @brief 使用已编译的版本模型构造
+		 * @details 多次规划同一版本时复用同一个编译模型，规划过程不再遍历任何 JSON。
+		 * @param version 编译后的版本模型
+		 * @param ctx 启动上下文
+		 */
+        LaunchPlanner(std::shared_ptr<const Version::CompiledVersion> version, const LaunchContext &ctx);
+
 		/**
 		 * @brief 执行规划，生成启动信息
 		 * @details 
 		 * 按照 Java 启动流程，依次构建工作目录、Classpath、JVM 参数、主类和游戏参数。
+		 * 设置了 `LaunchContext::SkeletonCache` 且版本哈希可确定时，命中缓存的规划只需重新渲染认证信息与分辨率。
+		 * 设置了 `LaunchContext::CdsArchives` 时，在参数最前面添加 CDS 参数，见 `GetCdsDecision`。
 		 * @return 进程启动信息，包含可执行文件路径及完整参数列表。
 		 */
         ProcessStartInfo Plan();
@@ -140,28 +175,187 @@ namespace PCL_CPP::Core::Launcher::Launch {
 		/**
 		 * @brief 提取 Natives 动态链接库
 		 * @details 
-		 * 扫描版本配置中的所有库，筛选出标记为 native 的库，并调用 NativesUtils 将其内部的 .dll 文件提取到指定的临时目录。
-		 * @return 是否提取成功
+		 * 对构造时筛选出的 Native 库，调用 NativesUtils 将其内部的 .dll 文件提取到指定的临时目录。
+		 * 提取前通过 `NativesUtils::CleanAsync` 移走旧目录，旧文件在后台删除。
+		 * 设置了 `LaunchContext::SharedNatives` 时改为准备缓存中的组合目录：已解压过的 Jar 不再解压，组合目录已存在时直接复用。
+		 * @return 是否提取成功（未使用缓存时单个库提取失败只记录警告）
 		 */
         bool ExtractNatives();
 
+		/**
+		 * @brief 为多个目标环境批量规划
+		 * @details 
+		 * 所有目标共享同一个编译模型，版本 JSON 只解析一次；每个目标的依赖库在构造其规划器时按各自的环境快照筛选。
+		 * 结果与对每个目标分别构造 `LaunchPlanner` 并调用 `Plan` 完全一致。
+		 * @param version 编译后的版本模型
+		 * @param ctx 启动上下文（其中的 `Target` 被忽略）
+		 * @param targets 目标环境列表
+		 * @return 与目标环境一一对应的进程启动信息
+		 */
+        static std::vector<ProcessStartInfo> PlanBatch(std::shared_ptr<const Version::CompiledVersion> version, const LaunchContext &ctx, const std::vector<Version::TargetEnvironment> &targets);
+
+		/**
+		 * @brief 获取最近一次规划中因重复而被丢弃的依赖库
+		 * @return 被丢弃的库及其对应的保留条目
+		 */
+        const std::vector<Version::DroppedLibrary> &GetDroppedLibraries() const { return _droppedLibraries; }
+
+		/**
+		 * @brief 获取启动所需的全部文件
+		 * @details 
+		 * 包括去重后的 Classpath 库、Native 库 Jar 与游戏核心 Jar，顺序与 Classpath 一致，Native 库在其后。
+		 * 只读取构造时筛选出的依赖库，不求值规则，也不访问文件系统，可与 `Plan`、`ExtractNatives` 并发调用。
+		 * @return 文件列表
+		 */
+        std::vector<LaunchFile> GetLaunchFiles() const;
+
+		/**
+		 * @brief 获取本次启动使用的 Natives 目录
+		 * @return 未使用 Natives 缓存时为 `LaunchContext::NativesDir`，否则为缓存中的组合目录
+		 */
+        std::filesystem::path GetNativesDirectory() const { return _storage.NativesDirectory; }
+
+		/**
+		 * @brief 获取最近一次规划的 CDS 决策
+		 * @return 未设置 `LaunchContext::CdsArchives`、版本哈希不可确定或 Java 运行时不支持时为 `CdsMode::Disabled`
+		 */
+        const CdsDecision &GetCdsDecision() const { return _cds; }
+
+		/**
+		 * @brief 通知规划器已按最近一次规划的结果拉起游戏进程
+		 * @details 
+		 * 规划本身不代表会启动，只有实际拉起进程后才更新 CDS 归档的最近使用时间并计入生成尝试次数，然后保存归档记录。
+		 * 由 `LaunchPipeline` 在拉起成功后调用；自行拉起进程的调用方也应在成功后调用。
+		 */
+        void OnLaunched();
+
     private:
-        Version::VersionInfo _version; ///< 版本信息
+        std::shared_ptr<const Version::CompiledVersion> _version; ///< 编译后的版本模型
         LaunchContext _ctx; ///< 启动上下文
         std::map<std::string, bool> _features; ///< 生效的功能列表
+        Version::TargetEnvironment _target; ///< 规划目标环境（Features 与 _features 一致）
+        Version::RuleEnvironment _environment; ///< 规则求值所用的环境快照（由 _target 构建）；快照内部缓存匹配结果，构造完成后只由 `Plan` 用于参数规则
+        Version::LibraryResolver _classpathLibraries; ///< 在目标环境下激活、去重后的 Classpath 库（构造时确定，之后只读）
+        Version::LibraryResolver _nativeLibraries; ///< 在目标环境下激活、去重后的 Native 库（构造时确定，之后只读）
+        std::vector<Version::DroppedLibrary> _droppedLibraries; ///< 最近一次规划中被丢弃的重复库
+        std::vector<NativesCache::NativeJar> _nativeJars; ///< 使用 Natives 缓存时需要提取的 Jar（构造时确定）
+        CdsDecision _cds; ///< 最近一次规划的 CDS 决策
+
+		/**
+		 * @brief 替换表所引用的、由规划器持有的字符串
+		 * @details 路径与分辨率在构造时转换为字符串，每次规划构建替换表时只记录视图，不再复制。
+		 */
+        struct SubstitutionStorage {
+            std::string GameDirectory;
+            std::string AssetsRoot;
+            std::string LibraryDirectory;
+            std::string NativesDirectory;
+            std::string ResolutionWidth;
+            std::string ResolutionHeight;
+        } _storage;
+
+		/**
+		 * @brief 按目标环境筛选依赖库
+		 * @details 
+		 * 只在构造时调用一次：
+		 * - 遍历编译模型中已解析的依赖库，使用编译后的规则在环境快照上检查其是否匹配目标系统。
+		 * - 激活的库按是否为目标系统的 Native 库分别加入 `_classpathLibraries` 与 `_nativeLibraries`，
+		 *   并按 `LaunchContext::LibraryPolicy` 对同一 group:artifact[:classifier] 的多个条目去重，保持首次出现的位置。
+		 */
+        void ResolveLibraries();
 
 		/**
 		 * @brief 构建 Classpath 字符串
 		 * @details 
 		 * 实现细节：
-		 * - 优先从版本配置的 `libraries` 数组中解析。
-		 * - 对于每个库，通过 `Library::IsActive` 检查其规则（Rule）是否匹配当前系统。
+		 * - 使用构造时筛选并去重的 Classpath 库。
 		 * - 如果库有 `path` 则直接使用，否则通过 Maven 坐标推导路径。
 		 * - 最后将游戏核心 Jar 包追加到末尾。
-		 * @return 完整的 Classpath 字符串，以分号分隔
+		 * @return 完整的 Classpath 字符串，以目标系统的分隔符分隔
 		 */
         std::string BuildClasspath();
 
+		/**
+		 * @brief 以去重后的依赖库拼接 Classpath，并记录被丢弃的库
+		 * @param resolver 已添加完所有 Classpath 库的解析器
+		 * @return 完整的 Classpath 字符串
+		 */
+        std::string JoinClasspath(const Version::LibraryResolver &resolver);
+
+		/**
+		 * @brief 收集需要提取的 Native 库 Jar
+		 * @details Native 库同样按坐标去重，避免同一个库的多个版本相互覆盖。
+		 * @return 按版本配置顺序排列的 Jar 列表
+		 */
+        std::vector<NativesCache::NativeJar> CollectNativeJars() const;
+
+		/**
+		 * @brief 获取已激活依赖库在目标环境下的文件信息
+		 * @details 只按目标系统选择 Native 分类器或主文件，不求值规则。
+		 * @param lib 已激活的依赖库
+		 * @return 适用的文件信息
+		 */
+        std::optional<Version::FileInfo> GetLibraryFile(const Version::Library &lib) const;
+
+		/**
+		 * @brief 获取依赖库文件的路径
+		 * @details 优先使用下载信息中的 `path`，否则通过 Maven 坐标推导。
+		 * @param lib 依赖库
+		 * @return 库文件的完整路径
+		 */
+        std::filesystem::path GetLibraryPath(const Version::Library &lib) const;
+
+		/**
+		 * @brief 获取游戏核心 Jar 的路径
+		 */
+        std::filesystem::path GetClientJarPath() const;
+
+		/**
+		 * @brief 以构建好的 Classpath 组装启动信息
+		 * @param classpath Classpath 字符串
+		 * @return 进程启动信息
+		 */
+        ProcessStartInfo Assemble(const std::string &classpath);
+
+		/**
+		 * @brief 生成不含 CDS 参数的启动信息
+		 * @details 按 `LaunchContext::SkeletonCache` 的设置从头构建或渲染缓存的骨架。
+		 * @return 进程启动信息
+		 */
+        ProcessStartInfo PlanArguments();
+
+		/**
+		 * @brief 为启动信息添加 CDS 参数
+		 * @details 
+		 * 以（版本哈希, Java 运行时, 参数中 `-cp` 的值）为键向 `LaunchContext::CdsArchives` 请求决策，
+		 * 生成或复用归档时将对应参数插入到参数列表最前面；归档记录有变化时保存。
+		 * @param info 进程启动信息
+		 */
+        void ApplyCds(ProcessStartInfo &info);
+
+		/**
+		 * @brief 以构建好的 Classpath 生成规划骨架
+		 * @details 除 `keep` 中的占位符外，所有参数均渲染为字面量；`keep` 为 0 时结果不含任何占位符。
+		 * @param classpath Classpath 字符串
+		 * @param keep 需保留的内置占位符位图
+		 * @return 规划骨架
+		 */
+        PlanSkeleton BuildSkeleton(const std::string &classpath, uint32_t keep);
+
+		/**
+		 * @brief 以当前上下文的认证信息与分辨率渲染规划骨架
+		 * @param skeleton 规划骨架
+		 * @return 进程启动信息
+		 */
+        ProcessStartInfo Render(const PlanSkeleton &skeleton) const;
+
+		/**
+		 * @brief 计算启动上下文哈希
+		 * @details 覆盖影响规划骨架的所有字段（Java、内存、路径、功能开关、目标环境、去重策略），不包含认证信息与分辨率。
+		 * @return 上下文哈希
+		 */
+        uint64_t GetContextHash() const;
+
 		/**
 		 * @brief 构建 JVM 启动参数
 		 * @details 
@@ -170,9 +364,11 @@ namespace PCL_CPP::Core::Launcher::Launch {
 		 * - 处理 `arguments.jvm` 中的现代参数，支持条件判断（如根据是否为 OSX 启用特定参数）。
 		 * - 兼容旧版逻辑，手动注入 `java.library.path` 和 `-cp`。
 		 * @param classpath 构建好的 Classpath 字符串
-		 * @return JVM 参数列表
+		 * @param subs 参数替换表（已包含 classpath）
+		 * @param keep 需保留的内置占位符位图
+		 * @return 部分渲染后的 JVM 参数
 		 */
-        std::vector<std::string> BuildJvmArgs(const std::string &classpath);
+        std::vector<Version::ArgumentTemplate> BuildJvmArgs(const std::string &classpath, const Version::SubstitutionTable &subs, uint32_t keep);
 
 		/**
 		 * @brief 构建游戏启动参数
@@ -180,17 +376,26 @@ namespace PCL_CPP::Core::Launcher::Launch {
 		 * 实现细节：
 		 * - 对于 1.13+ 版本，解析 `arguments.game` 中的复杂参数项。
 		 * - 对于 1.12.2 及以下版本，解析 `minecraftArguments` 字符串。
-		 * - 所有参数在返回前都会经过 `GetSubstitutions` 映射表进行占位符替换。
-		 * @return 游戏参数列表
+		 * - 两种格式的参数均已在编译时切分为模板，这里以 `GetSubstitutions` 替换表单次渲染，未知占位符会记录警告。
+		 * @param subs 参数替换表
+		 * @param keep 需保留的内置占位符位图
+		 * @return 部分渲染后的游戏参数
 		 */
-        std::vector<std::string> BuildGameArgs();
+        std::vector<Version::ArgumentTemplate> BuildGameArgs(const Version::SubstitutionTable &subs, uint32_t keep);
 
 		/**
-		 * @brief 获取参数替换映射表
+		 * @brief 获取参数替换表
 		 * @details 
 		 * 汇总认证信息、路径信息、版本信息以及分辨率等数据，形成 `${key}` 到 `value` 的映射。
-		 * @return 替换映射表
+		 * 内置占位符按枚举下标写入，替换值均为指向上下文、编译模型或 `_storage` 的视图。
+		 * @return 替换表
+		 */
+        Version::SubstitutionTable GetSubstitutions() const;
+
+		/**
+		 * @brief 记录渲染参数时遇到的未知占位符
+		 * @param unknown 未知占位符名称
 		 */
-        std::map<std::string, std::string> GetSubstitutions();
+        void ReportUnknownPlaceholders(const std::vector<std::string> &unknown) const;
     };
 }
@@ -0,0 +1,247 @@
+#include "pch.h"
+#include "App/Logging/AppLogger.h"
+#include "NativesCache.h"
+#include "FileVerifier.h"
+#include "NativesUtils.h"
+#include "ProcessRunner.h"
+#include "Utils/Hashing/Sha1.h"
+#include "Utils/IO/BackgroundDeleter.h"
+#include "Utils/IO/FileStamp.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <format>
+#include <set>
+#include <string_view>
+
+using namespace PCL_CPP::Core::Logging;
+using namespace PCL_CPP::Core::Utils;
+
+namespace PCL_CPP::Core::Launcher::Launch {
+
+	/**
+	 * @brief 构造函数
+	 * @param root 缓存根目录
+	 * @param verifyCache 可选，校验记录
+	 */
+	NativesCache::NativesCache(std::filesystem::path root, std::shared_ptr<VerifiedFileCache> verifyCache)
+		: m_root(std::move(root)), m_verifyCache(std::move(verifyCache)) { }
+
+	/**
+	 * @brief 获取 Jar 的条目键
+	 * @param jar Native 库 Jar
+	 * @return 40 位十六进制键，Jar 未声明 SHA-1 且不存在时返回空字符串
+	 */
+	std::string NativesCache::GetJarKey(const NativeJar &jar) {
+		std::string material;
+		if (!jar.Sha1.empty()) {
+			material = "sha1:" + jar.Sha1;
+			std::transform(material.begin(), material.end(), material.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+		} else {
+			// 未声明校验值时以文件签名代替内容哈希，Jar 被替换后签名随之变化
+			auto stamp = FileStamp::Read(jar.Path);
+			if (!stamp) return {};
+			material = std::format("stamp:{}:{}:{}", jar.Path.lexically_normal().generic_string(), stamp->Size, stamp->ModifiedTime);
+		}
+
+		// 排除规则影响提取结果，需计入键；排序后与声明顺序无关
+		std::vector<std::string> exclude = jar.Exclude;
+		std::sort(exclude.begin(), exclude.end());
+		for (const auto &rule : exclude) material.append("\n").append(rule);
+		return Sha1::HashHex(material);
+	}
+
+	/**
+	 * @brief 计算一组 Jar 的条目键
+	 * @param jars Native 库 Jar
+	 * @param keys 输出条目键
+	 * @return 所有 Jar 均能确定键时返回 true
+	 */
+	bool NativesCache::GetJarKeys(const std::vector<NativeJar> &jars, std::vector<std::string> &keys) {
+		bool complete = true;
+		keys.clear();
+		keys.reserve(jars.size());
+		for (const auto &jar : jars) {
+			keys.push_back(GetJarKey(jar));
+			if (keys.back().empty()) complete = false;
+		}
+		return complete;
+	}
+
+	/**
+	 * @brief 获取一组 Jar 对应的组合目录路径
+	 * @param jars Native 库 Jar，靠后的 Jar 中的同名文件覆盖靠前的
+	 * @return 组合目录路径
+	 */
+	std::filesystem::path NativesCache::GetSetDirectory(const std::vector<NativeJar> &jars) const {
+		std::vector<std::string> keys;
+		GetJarKeys(jars, keys);
+
+		// 覆盖关系取决于顺序，组合键按顺序计算
+		Sha1 sha;
+		for (const auto &key : keys) {
+			sha.Update(key);
+			sha.Update("\n");
+		}
+		return m_root / "sets" / Sha1::ToHex(sha.Finish());
+	}
+
+	/**
+	 * @brief 确保一组 Jar 的组合目录已就绪
+	 * @param jars Native 库 Jar
+	 * @return 组合目录已就绪时返回 true
+	 */
+	bool NativesCache::Prepare(const std::vector<NativeJar> &jars) {
+		auto target = GetSetDirectory(jars);
+		std::error_code ec;
+		if (std::filesystem::is_directory(target, ec)) {
+			m_reusedSets++;
+			return true;
+		}
+
+		std::call_once(m_sweepOnce, [this] { SweepStaging(); });
+
+		std::vector<std::string> keys;
+		GetJarKeys(jars, keys);
+
+		std::vector<std::filesystem::path> entries(jars.size());
+		std::vector<size_t> pending;
+		bool complete = true;
+		for (size_t i = 0; i < jars.size(); i++) {
+			if (keys[i].empty()) {
+				LOG_WARNING("Failed to prepare native library: {}", jars[i].Path.string());
+				complete = false;
+				continue;
+			}
+			entries[i] = m_root / "jars" / keys[i];
+			if (!std::filesystem::is_directory(entries[i], ec)) pending.push_back(i);
+		}
+
+		// 条目以声明的 SHA-1 为键，解压前须确认 Jar 与声明一致；已有条目在创建时校验过，不再重复
+		std::vector<LaunchFile> files;
+		for (size_t i : pending) {
+			if (!jars[i].Sha1.empty()) files.push_back({ jars[i].Path, jars[i].Sha1, 0 });
+		}
+		std::set<std::filesystem::path> corrupt;
+		for (const auto &failure : FileVerifier::Verify(files, m_verifyCache.get()).Failures) corrupt.insert(failure.Path);
+
+		// 尚无条目目录的 Jar 统一并行解压到各自的临时目录
+		std::vector<NativesExtractJob> jobs;
+		std::vector<size_t> jobJars;
+		for (size_t i : pending) {
+			if (corrupt.contains(jars[i].Path)) {
+				LOG_WARNING("Native library failed verification: {}", jars[i].Path.string());
+				complete = false;
+				continue;
+			}
+			jobs.push_back({ jars[i].Path, MakeStagingPath(entries[i]), jars[i].Exclude });
+			jobJars.push_back(i);
+		}
+
+		auto extracted = NativesUtils::ExtractBatch(jobs);
+		for (size_t j = 0; j < jobs.size(); j++) {
+			size_t i = jobJars[j];
+			if (extracted.Succeeded[j] && Publish(jobs[j].TargetDir, entries[i])) {
+				m_extractedJars++;
+				continue;
+			}
+			std::filesystem::remove_all(jobs[j].TargetDir, ec);
+			LOG_WARNING("Failed to prepare native library: {}", jars[i].Path.string());
+			complete = false;
+		}
+
+		// 任一 Jar 无法提取时不发布组合目录，避免之后的启动复用不完整的结果
+		if (!complete) return false;
+
+		auto staging = MakeStagingPath(target);
+		std::filesystem::create_directories(staging, ec);
+		for (const auto &entry : entries) {
+			std::error_code iterateError;
+			for (const auto &file : std::filesystem::directory_iterator(entry, iterateError)) {
+				auto destination = staging / file.path().filename();
+				std::filesystem::remove(destination, ec);
+				std::filesystem::create_hard_link(file.path(), destination, ec);
+				if (ec) {
+					// 缓存与目标不在同一卷等情况下无法创建硬链接，退化为复制
+					std::filesystem::copy_file(file.path(), destination, std::filesystem::copy_options::overwrite_existing, ec);
+					if (ec) {
+						LOG_WARNING("Failed to link native {}: {}", file.path().string(), ec.message());
+						complete = false;
+					}
+				}
+			}
+			if (iterateError) {
+				LOG_WARNING("Failed to read natives cache entry {}: {}", entry.string(), iterateError.message());
+				complete = false;
+			}
+		}
+
+		// 缺少文件的组合目录一旦发布就会被之后的启动直接复用
+		if (!complete) {
+			std::filesystem::remove_all(staging, ec);
+			return false;
+		}
+		return Publish(staging, target);
+	}
+
+	/**
+	 * @brief 回收遗留的临时目录
+	 * @return 加入删除队列的临时目录数量
+	 */
+	size_t NativesCache::SweepStaging() {
+		constexpr std::string_view marker = ".tmp-";
+		const uint32_t self = GetCurrentProcessId();
+
+		size_t count = 0;
+		for (const char *sub : { "jars", "sets" }) {
+			std::error_code ec;
+			for (const auto &entry : std::filesystem::directory_iterator(m_root / sub, ec)) {
+				auto name = entry.path().filename().string();
+				size_t pos = name.rfind(marker);
+				if (pos == std::string::npos) continue;
+
+				// 无法解析出 PID 的目录不是由本类创建的，不做处理
+				uint32_t pid = 0;
+				const char *begin = name.data() + pos + marker.size();
+				auto [end, error] = std::from_chars(begin, name.data() + name.size(), pid);
+				if (error != std::errc() || end == begin || end == name.data() + name.size() || *end != '-') continue;
+				if (pid == self || ProcessRunner::IsRunning(pid)) continue;
+
+				BackgroundDeleter::Global().Enqueue(entry.path());
+				count++;
+			}
+		}
+		if (count > 0) LOG_INFO("Sweeping {} leftover natives staging director(ies) in {}", count, m_root.string());
+		return count;
+	}
+
+	/**
+	 * @brief 生成与 `target` 同目录的唯一临时路径
+	 * @param target 最终目录
+	 * @return 临时目录路径
+	 */
+	std::filesystem::path NativesCache::MakeStagingPath(const std::filesystem::path &target) {
+		return target.parent_path() / std::format("{}.tmp-{}-{}", target.filename().string(), GetCurrentProcessId(), m_stagingCounter++);
+	}
+
+	/**
+	 * @brief 将构建完成的临时目录发布为最终目录
+	 * @param staging 临时目录
+	 * @param target 最终目录
+	 * @return 最终目录已存在时返回 true
+	 */
+	bool NativesCache::Publish(const std::filesystem::path &staging, const std::filesystem::path &target) {
+		std::error_code ec;
+		std::filesystem::create_directories(staging, ec); // 空 Jar 不会创建临时目录
+		std::filesystem::rename(staging, target, ec);
+		if (!ec) return true;
+
+		// 其他实例已抢先发布了同一目录，内容相同，沿用即可
+		std::error_code removeError;
+		std::filesystem::remove_all(staging, removeError);
+		if (std::filesystem::is_directory(target, removeError)) return true;
+
+		LOG_ERROR("Failed to publish natives directory {}: {}", target.string(), ec.message());
+		return false;
+	}
+}
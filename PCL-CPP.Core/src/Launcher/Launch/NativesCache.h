@@ -0,0 +1,116 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace PCL_CPP::Core::Launcher::Launch {
+	class VerifiedFileCache;
+
+	/**
+	 * @brief 内容寻址的 Natives 缓存
+	 *
+	 * @details
+	 * 每个 Native 库 Jar 只解压一次：
+	 * 1. **条目目录**：以（Jar 的 SHA-1, 排除规则）为键，解压结果保存在 `<root>/jars/<键>`。
+	 *    Jar 未声明 SHA-1 时以路径、大小与修改时间代替，Jar 被替换后自然得到新的键。
+	 * 2. **组合目录**：一次启动所需的全部条目按顺序组合为 `<root>/sets/<组合键>`，其中的文件是条目文件的硬链接
+	 *    （无法创建硬链接时退化为复制）。组合键相同的启动直接复用已有目录，不做任何解压与链接。
+	 * 3. **无冲突**：所有目录先在唯一命名的临时目录中构建，完成后再原子重命名为最终名称；
+	 *    已完成的目录不再被修改，同时运行的多个实例可以安全地共享同一个组合目录。
+	 *    首次 `Prepare` 时回收已退出的实例遗留的临时目录。
+	 * 4. **先校验后解压**：声明了 SHA-1 的 Jar 在解压前通过 `FileVerifier` 校验，
+	 *    损坏的 Jar 不会以其声明的 SHA-1 为键写入缓存，从而污染之后的所有启动。
+	 */
+	class NativesCache {
+		public:
+		/**
+		 * @brief 需要提取的 Native 库 Jar
+		 */
+		struct NativeJar {
+			std::filesystem::path Path;       ///< Jar 文件路径
+			std::string Sha1;                 ///< 声明的 SHA-1，未声明时为空
+			std::vector<std::string> Exclude; ///< 提取排除规则
+		};
+
+		/**
+		 * @brief 构造函数
+		 * @param root 缓存根目录
+		 * @param verifyCache 可选，校验记录，已校验过的 Jar 不再计算 SHA-1；由调用方负责保存
+		 */
+		explicit NativesCache(std::filesystem::path root, std::shared_ptr<VerifiedFileCache> verifyCache = nullptr);
+
+		/**
+		 * @brief 获取 Jar 的条目键
+		 * @param jar Native 库 Jar
+		 * @return 40 位十六进制键，Jar 未声明 SHA-1 且不存在时返回空字符串
+		 */
+		static std::string GetJarKey(const NativeJar &jar);
+
+		/**
+		 * @brief 获取一组 Jar 对应的组合目录路径
+		 * @details 只计算路径，不访问缓存目录；可在提取之前用于构建启动参数。
+		 * @param jars Native 库 Jar，靠后的 Jar 中的同名文件覆盖靠前的
+		 * @return 组合目录路径
+		 */
+		std::filesystem::path GetSetDirectory(const std::vector<NativeJar> &jars) const;
+
+		/**
+		 * @brief 确保一组 Jar 的组合目录已就绪
+		 * @details 
+		 * 组合目录已存在时直接返回；否则校验并并行解压尚无条目的 Jar，再以硬链接构建组合目录。
+		 * 任一 Jar 校验或解压失败、或任一文件无法链接或复制时，不发布组合目录并返回 false。
+		 * @param jars Native 库 Jar
+		 * @return 组合目录已就绪时返回 true
+		 */
+		bool Prepare(const std::vector<NativeJar> &jars);
+
+		/**
+		 * @brief 回收遗留的临时目录
+		 * @details 
+		 * 实例在发布前退出或崩溃时会在 `jars` 与 `sets` 中留下临时目录（`<名称>.tmp-<进程 ID>-<序号>`）。
+		 * 所属进程已不在运行的临时目录交由 `BackgroundDeleter` 删除；当前进程与仍在运行的进程的临时目录保持不动。
+		 * @return 加入删除队列的临时目录数量
+		 */
+		size_t SweepStaging();
+
+		/**
+		 * @brief 获取缓存根目录
+		 */
+		const std::filesystem::path &GetRoot() const { return m_root; }
+
+		uint64_t ExtractedJars() const { return m_extractedJars; }  ///< 实际解压的 Jar 数量
+		uint64_t ReusedSets() const { return m_reusedSets; }        ///< 直接复用的组合目录数量
+
+		private:
+		/**
+		 * @brief 计算一组 Jar 的条目键
+		 * @param jars Native 库 Jar
+		 * @param keys 输出条目键
+		 * @return 所有 Jar 均能确定键时返回 true
+		 */
+		static bool GetJarKeys(const std::vector<NativeJar> &jars, std::vector<std::string> &keys);
+
+		/**
+		 * @brief 生成与 `target` 同目录的唯一临时路径
+		 */
+		std::filesystem::path MakeStagingPath(const std::filesystem::path &target);
+
+		/**
+		 * @brief 将构建完成的临时目录发布为最终目录
+		 * @details 目标已被其他实例抢先发布时删除临时目录并沿用已有目录。
+		 * @return 最终目录已存在时返回 true
+		 */
+		static bool Publish(const std::filesystem::path &staging, const std::filesystem::path &target);
+
+		std::filesystem::path m_root;
+		std::shared_ptr<VerifiedFileCache> m_verifyCache;
+		std::once_flag m_sweepOnce;
+		std::atomic<uint64_t> m_stagingCounter = 0;
+		std::atomic<uint64_t> m_extractedJars = 0;
+		std::atomic<uint64_t> m_reusedSets = 0;
+	};
+}
@@ -1,78 +1,176 @@
 #include "pch.h"
 #include "App/Logging/AppLogger.h"
 #include "NativesUtils.h"
-
-// miniz 优化预处理指令
-#define MINIZ_NO_TIME
-#define MINIZ_NO_ZLIB_APIS
-#define MINIZ_NO_ARCHIVE_WRITING_APIS
-
-#include <miniz/miniz.h>
+#include "ProcessRunner.h"
+#include "Utils/IO/BackgroundDeleter.h"
+#include "Utils/IO/ZipArchive.h"
+#include "Utils/Threading/Parallel.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace PCL_CPP::Core::Logging;
+using namespace PCL_CPP::Core::Utils;
 
 namespace PCL_CPP::Core::Launcher::Launch {
 
 	/**
-	 * @brief 从 Jar 文件中提取所有 .dll 文件到目标目录
-	 * @param jarPath Jar 文件路径
-	 * @param targetDir 目标提取目录
+	 * @brief 单个 Jar 在批量提取过程中的状态
+	 */
+	struct NativesJarState {
+		ZipArchive Zip;          ///< 已打开的 Jar
+
+		/**
+		 * @brief 筛选通过的条目
+		 */
+		struct Entry {
+			const ZipEntry *Source; ///< 中央目录中的条目
+			std::string Name;       ///< 展平后的目标文件名
+			bool IsWinner = true;   ///< 是否为同名目标文件的最终来源
+		};
+		std::vector<Entry> Entries;
+		size_t FailedFiles = 0;  ///< 解压或写入失败的条目数量
+	};
+
+	/**
+	 * @brief 检查条目名称是否需要提取
+	 * @param filename 条目名称
 	 * @param exclude 排除的文件列表
-	 * @return 是否全部提取过程完成
+	 * @return 是 .dll 且未命中排除规则时返回 true
 	 */
-	bool NativesUtils::Extract(const std::filesystem::path &jarPath, const std::filesystem::path &targetDir, const std::vector<std::string> &exclude) {
-		if (!std::filesystem::exists(jarPath)) {
-			LOG_WARNING("Natives jar not found: {}", jarPath.string());
-			return false;
+	static bool IsWantedNative(std::string_view filename, const std::vector<std::string> &exclude) {
+		// 仅提取 .dll 文件
+		if (filename.length() < 4 || filename.substr(filename.length() - 4) != ".dll") return false;
+
+		// 检查排除列表
+		for (const auto &ex : exclude) {
+			if (filename.find(ex) != std::string_view::npos) return false;
 		}
+		return true;
+	}
 
-		// 确保目标目录存在
-		std::filesystem::create_directories(targetDir);
+	/**
+	 * @brief 打开 Jar 并筛选需要提取的条目
+	 * @param job 提取任务
+	 * @param state 写入打开的读取器与筛选结果
+	 */
+	static void OpenNativesJar(const NativesExtractJob &job, NativesJarState &state) {
+		std::error_code ec;
+		if (!std::filesystem::exists(job.JarPath, ec)) {
+			LOG_WARNING("Natives jar not found: {}", job.JarPath.string());
+			return;
+		}
 
-		mz_zip_archive zip_archive;
-		memset(&zip_archive, 0, sizeof(zip_archive));
+		if (!state.Zip.Open(job.JarPath)) {
+			LOG_ERROR("Failed to open zip: {}", job.JarPath.string());
+			return;
+		}
 
-		// 初始化 zip 读取器
-		if (!mz_zip_reader_init_file(&zip_archive, jarPath.string().c_str(), 0)) {
-			LOG_ERROR("Failed to open zip: {}", jarPath.string());
-			return false;
+		// 中央目录已解析为条目表，筛选只需访问映射区域中的文件名，不产生任何复制
+		for (const auto &entry : state.Zip.GetEntries()) {
+			std::string_view name = state.Zip.GetName(entry);
+			if (!IsWantedNative(name, job.Exclude)) continue;
+			state.Entries.push_back({ &entry, std::filesystem::path(name).filename().string() });
 		}
+	}
 
-		int fileCount = (int) mz_zip_reader_get_num_files(&zip_archive);
-		for (int i = 0; i < fileCount; i++) {
-			mz_zip_archive_file_stat file_stat;
-			if (!mz_zip_reader_file_stat(&zip_archive, i, &file_stat)) continue;
+	/**
+	 * @brief 解压 Jar 中最终需要写入的条目
+	 * @details 失败的条目计入 `state.FailedFiles`。
+	 * @param job 提取任务
+	 * @param state 已打开的 Jar
+	 * @param files 累加写入的文件数量
+	 * @param bytes 累加写入的字节数
+	 */
+	static void ExtractNativesJar(const NativesExtractJob &job, NativesJarState &state, std::atomic<size_t> &files, std::atomic<uint64_t> &bytes) {
+		// 存储方式的条目直接从映射区域写出，Deflate 条目解压到线程内复用的缓冲区
+		thread_local std::vector<std::byte> buffer;
 
-			// 跳过目录
-			if (mz_zip_reader_is_file_a_directory(&zip_archive, i)) continue;
+		// 确保目标目录存在
+		std::error_code ec;
+		std::filesystem::create_directories(job.TargetDir, ec);
 
-			std::string filename = file_stat.m_filename;
+		for (const auto &entry : state.Entries) {
+			if (!entry.IsWinner) continue;
 
-			// 仅提取 .dll 文件
-			if (filename.length() < 4 || filename.substr(filename.length() - 4) != ".dll") {
+			auto data = state.Zip.Read(*entry.Source, buffer);
+			if (!data) {
+				LOG_WARNING("Failed to extract native: {}", entry.Name);
+				state.FailedFiles++;
 				continue;
 			}
 
-			// 检查排除列表
-			bool skipped = false;
-			for (const auto &ex : exclude) {
-				if (filename.find(ex) != std::string::npos) {
-					skipped = true;
-					break;
-				}
+			// 执行写入操作
+			std::filesystem::path destPath = job.TargetDir / entry.Name;
+			std::ofstream out(destPath, std::ios::binary | std::ios::trunc);
+			if (!out.write(reinterpret_cast<const char *>(data->data()), static_cast<std::streamsize>(data->size()))) {
+				LOG_WARNING("Failed to write native: {}", destPath.string());
+				state.FailedFiles++;
+				continue;
 			}
-			if (skipped) continue;
+			files++;
+			bytes += data->size();
+		}
+	}
 
-			// 执行提取操作
-			std::filesystem::path destPath = targetDir / std::filesystem::path(filename).filename();
+	/**
+	 * @brief 从 Jar 文件中提取所有 .dll 文件到目标目录
+	 * @param jarPath Jar 文件路径
+	 * @param targetDir 目标提取目录
+	 * @param exclude 排除的文件列表
+	 * @return 是否全部提取过程完成
+	 */
+	bool NativesUtils::Extract(const std::filesystem::path &jarPath, const std::filesystem::path &targetDir, const std::vector<std::string> &exclude) {
+		return ExtractBatch({ { jarPath, targetDir, exclude } }, 1).AllSucceeded();
+	}
 
-			if (!mz_zip_reader_extract_to_file(&zip_archive, i, destPath.string().c_str(), 0)) {
-				LOG_WARNING("Failed to extract native: {}", filename);
+	/**
+	 * @brief 并行提取多个 Jar
+	 * @param jobs 提取任务
+	 * @param maxWorkers 最大工作线程数（0 表示使用硬件并发数）
+	 * @return 提取结果
+	 */
+	NativesExtractResult NativesUtils::ExtractBatch(const std::vector<NativesExtractJob> &jobs, size_t maxWorkers) {
+		std::vector<NativesJarState> states(jobs.size());
+		Parallel::For(jobs.size(), maxWorkers, [&](size_t i) { OpenNativesJar(jobs[i], states[i]); });
+
+		// 按任务顺序决定同名文件的来源：后出现的条目覆盖先出现的，与逐个提取的结果一致
+		// 目标文件系统不区分大小写，键需折叠大小写，否则仅大小写不同的两个条目会并发写入同一个文件
+		std::unordered_map<std::string, NativesJarState::Entry *> winners;
+		for (size_t i = 0; i < jobs.size(); i++) {
+			std::string dir = jobs[i].TargetDir.lexically_normal().generic_string();
+			for (auto &entry : states[i].Entries) {
+				std::string key = dir + '/' + entry.Name;
+				std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+				auto &winner = winners[key];
+				if (winner) winner->IsWinner = false;
+				winner = &entry;
 			}
 		}
 
-		mz_zip_reader_end(&zip_archive);
-		return true;
+		std::atomic<size_t> files = 0;
+		std::atomic<uint64_t> bytes = 0;
+		Parallel::For(jobs.size(), maxWorkers, [&](size_t i) {
+			if (!states[i].Zip.IsOpen()) return;
+			ExtractNativesJar(jobs[i], states[i], files, bytes);
+		});
+
+		NativesExtractResult result;
+		result.Succeeded.reserve(jobs.size());
+		for (const auto &state : states) {
+			result.Succeeded.push_back(state.Zip.IsOpen() && state.FailedFiles == 0);
+			result.FailedFiles += state.FailedFiles;
+		}
+		result.Files = files;
+		result.Bytes = bytes;
+		return result;
 	}
 
 	/**
@@ -84,4 +182,87 @@ namespace PCL_CPP::Core::Launcher::Launch {
 			std::filesystem::remove_all(targetDir);
 		}
 	}
+
+	/**
+	 * @brief 规范化 Natives 目录路径，去除末尾的分隔符
+	 * @param targetDir 目录路径
+	 * @return 规范化后的路径
+	 */
+	static std::filesystem::path NormalizeNativesDir(const std::filesystem::path &targetDir) {
+		auto dir = targetDir.lexically_normal();
+		if (!dir.has_filename()) dir = dir.parent_path();
+		return dir;
+	}
+
+	/**
+	 * @brief 获取目录的墓碑名称前缀
+	 * @param dir 规范化后的目录路径
+	 * @return 墓碑名称前缀
+	 */
+	static std::string GetTombstonePrefix(const std::filesystem::path &dir) {
+		return dir.filename().string() + ".trash-";
+	}
+
+	/**
+	 * @brief 异步清理 Natives 目录
+	 * @param targetDir 要清理的目录路径
+	 * @return 目录不存在或已移走时返回 true
+	 */
+	bool NativesUtils::CleanAsync(const std::filesystem::path &targetDir) {
+		static std::atomic<uint64_t> tombstoneCounter = 0;
+		auto dir = NormalizeNativesDir(targetDir);
+
+		// 每个目录在进程内只回收一次遗留墓碑，之后的清理只需一次重命名
+		{
+			static std::mutex sweptMutex;
+			static std::unordered_set<std::string> swept;
+			std::lock_guard lock(sweptMutex);
+			if (swept.insert(dir.generic_string()).second) SweepTombstones(dir);
+		}
+
+		std::error_code ec;
+		if (!std::filesystem::exists(dir, ec)) return true;
+
+		// 墓碑与原目录位于同一目录下，重命名不涉及数据移动
+		auto tombstone = dir.parent_path() / std::format("{}{}-{}", GetTombstonePrefix(dir), GetCurrentProcessId(), tombstoneCounter++);
+		std::filesystem::rename(dir, tombstone, ec);
+		if (ec) {
+			LOG_WARNING("Failed to move natives directory {}: {}", dir.string(), ec.message());
+			return false;
+		}
+		BackgroundDeleter::Global().Enqueue(std::move(tombstone));
+		return true;
+	}
+
+	/**
+	 * @brief 回收遗留的墓碑目录
+	 * @param targetDir Natives 目录路径
+	 * @return 加入删除队列的墓碑数量
+	 */
+	size_t NativesUtils::SweepTombstones(const std::filesystem::path &targetDir) {
+		auto dir = NormalizeNativesDir(targetDir);
+		auto parent = dir.parent_path();
+		if (parent.empty()) parent = ".";
+		std::string prefix = GetTombstonePrefix(dir);
+
+		const uint32_t self = GetCurrentProcessId();
+		size_t count = 0;
+		std::error_code ec;
+		for (const auto &entry : std::filesystem::directory_iterator(parent, ec)) {
+			auto name = entry.path().filename().string();
+			if (!name.starts_with(prefix)) continue;
+
+			// 墓碑名称为 <前缀><进程 ID>-<序号>；当前进程的墓碑已在队列中，仍在运行的其他实例会自行删除它们的墓碑
+			uint32_t pid = 0;
+			const char *begin = name.data() + prefix.size();
+			auto [end, error] = std::from_chars(begin, name.data() + name.size(), pid);
+			if (error != std::errc() || end == begin || end == name.data() + name.size() || *end != '-') continue;
+			if (pid == self || ProcessRunner::IsRunning(pid)) continue;
+
+			BackgroundDeleter::Global().Enqueue(entry.path());
+			count++;
+		}
+		if (count > 0) LOG_INFO("Sweeping {} leftover natives tombstone(s) in {}", count, parent.string());
+		return count;
+	}
 }
@@ -1,28 +1,53 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <filesystem>
 #include <vector>
 
 namespace PCL_CPP::Core::Launcher::Launch {
+	/**
+	 * @brief 单个 Jar 的提取任务
+	 */
+	struct NativesExtractJob {
+		std::filesystem::path JarPath;     ///< Jar 文件路径
+		std::filesystem::path TargetDir;   ///< 目标提取目录
+		std::vector<std::string> Exclude;  ///< 排除的文件列表
+	};
+
+	/**
+	 * @brief 批量提取的结果
+	 */
+	struct NativesExtractResult {
+		std::vector<bool> Succeeded; ///< 与任务一一对应，Jar 能够打开且其中需要写入的文件全部写入时为 true
+		size_t Files = 0;            ///< 写入的文件数量
+		size_t FailedFiles = 0;      ///< 解压或写入失败的文件数量
+		uint64_t Bytes = 0;          ///< 写入的字节数（解压后）
+
+		/**
+		 * @brief 检查是否所有 Jar 均已完整提取
+		 */
+		bool AllSucceeded() const {
+			for (bool ok : Succeeded) if (!ok) return false;
+			return true;
+		}
+	};
+
 	/**
 	 * @brief Natives 库工具类
 	 * 
 	 * @details 
 	 * 该类负责处理 Minecraft 运行所需的 Native 库（.dll）：
-	 * 1. **Zip 解压**：集成 `miniz` 库，直接从 Jar 包（本质是 Zip 格式）中读取并解压文件。
+	 * 1. **Zip 解压**：通过内存映射的 `ZipArchive` 直接从 Jar 包（本质是 Zip 格式）中读取并解压文件。
 	 * 2. **按需提取**：仅提取后缀为 `.dll` 的文件，并支持根据排除列表（Exclude Rules）跳过特定文件（如 manifest 文件）。
-	 * 3. **目录清理**：提供清理功能，确保每次启动时的 Natives 目录都是干净且最新的。
+	 * 3. **批量并行**：多个 Jar 在工作线程池上同时解压，每个线程复用同一个解压缓冲区。
+	 * 4. **目录清理**：提供清理功能，确保每次启动时的 Natives 目录都是干净且最新的；异步清理时启动流程只承担一次重命名的开销。
 	 */
     class NativesUtils {
     public:
         /**
          * @brief 从 Jar 文件中提取所有 .dll 文件到目标目录
          * @details 
-         * 实现细节：
-         * 1. 使用 `mz_zip_reader_init_file` 初始化解压器。
-         * 2. 遍历压缩包内所有文件，过滤出 `.dll` 文件。
-         * 3. 检查文件名是否命中 `exclude` 中的任意关键词。
-         * 4. 使用 `mz_zip_reader_extract_to_file` 执行解压。
+         * 等价于只包含一个任务的 `ExtractBatch`。
          * @param jarPath Jar 文件路径
          * @param targetDir 目标提取目录
          * @param exclude 排除的文件列表
@@ -30,11 +55,48 @@ namespace PCL_CPP::Core::Launcher::Launch {
          */
         static bool Extract(const std::filesystem::path& jarPath, const std::filesystem::path& targetDir, const std::vector<std::string>& exclude = {});
 
+        /**
+         * @brief 并行提取多个 Jar
+         * @details
+         * 实现细节：
+         * 1. 并行打开所有 Jar，直接在 `ZipArchive` 的条目表上按文件名完成 `.dll` 后缀与排除规则的筛选。
+         * 2. 按任务顺序确定每个目标文件的最终来源：多个 Jar（或同一 Jar 中不同目录）包含同名文件时，与逐个提取一样由靠后的条目覆盖靠前的。
+         *    Windows 文件系统不区分大小写，只有大小写不同的文件名视为同一个文件。
+         * 3. 并行解压：存储方式的条目直接从映射区域写出，Deflate 条目解压到线程内复用的缓冲区后一次性写入目标文件。
+         *    单个条目损坏或写入失败时继续处理其余条目，但该任务记为失败。
+         * @param jobs 提取任务
+         * @param maxWorkers 最大工作线程数（0 表示使用硬件并发数）
+         * @return 提取结果
+         */
+        static NativesExtractResult ExtractBatch(const std::vector<NativesExtractJob>& jobs, size_t maxWorkers = 0);
+
         /**
          * @brief 清理 Natives 目录
          * @details 直接删除指定目录下的所有内容。
          * @param targetDir 要清理的目录路径
          */
         static void Clean(const std::filesystem::path& targetDir);
+
+        /**
+         * @brief 异步清理 Natives 目录
+         * @details
+         * 将目录原子重命名为同级的墓碑目录（`<目录名>.trash-<进程 ID>-<序号>`）后立即返回，
+         * 墓碑目录由 `BackgroundDeleter` 在低优先级后台线程上删除。
+         * 每个目录在进程内首次清理时会先调用 `SweepTombstones` 回收上次运行遗留的墓碑。
+         * 目录中的文件仍被占用（例如同一版本的游戏正在运行）时重命名会失败，此时保留原目录。
+         * @param targetDir 要清理的目录路径
+         * @return 目录不存在或已移走时返回 true
+         */
+        static bool CleanAsync(const std::filesystem::path& targetDir);
+
+        /**
+         * @brief 回收遗留的墓碑目录
+         * @details 
+         * 进程在后台删除完成前退出或崩溃时会留下墓碑目录，将其重新加入后台删除队列。
+         * 只回收所属进程已不在运行的墓碑：其他仍在运行的实例正在删除自己的墓碑，当前进程的墓碑已在队列中。
+         * @param targetDir Natives 目录路径，在其所在目录中查找属于它的墓碑
+         * @return 加入删除队列的墓碑数量
+         */
+        static size_t SweepTombstones(const std::filesystem::path& targetDir);
     };
 }
@@ -0,0 +1,87 @@
+#include "pch.h"
+#include "PlanSkeletonCache.h"
+#include "Utils/Hashing/HashUtils.h"
+
+namespace PCL_CPP::Core::Launcher::Launch {
+
+	/**
+	 * @brief 构造函数
+	 * @param capacity 最大条目数
+	 */
+	PlanSkeletonCache::PlanSkeletonCache(size_t capacity)
+		: m_capacity(capacity) { }
+
+	size_t PlanSkeletonCache::KeyHash::operator()(const Key &key) const noexcept {
+		return static_cast<size_t>(Utils::HashUtils::Combine(key.VersionHash, key.ContextHash));
+	}
+
+	/**
+	 * @brief 查找缓存条目
+	 * @param versionHash 版本继承链哈希
+	 * @param contextHash 启动上下文哈希
+	 * @return 命中时返回缓存的骨架，否则返回 nullptr
+	 */
+	std::shared_ptr<const PlanSkeleton> PlanSkeletonCache::Find(uint64_t versionHash, uint64_t contextHash) {
+		std::lock_guard lock(m_mutex);
+
+		auto it = m_lookup.find({ versionHash, contextHash });
+		if (it == m_lookup.end()) {
+			m_misses++;
+			return nullptr;
+		}
+
+		m_entries.splice(m_entries.begin(), m_entries, it->second);
+		m_hits++;
+		return it->second->Skeleton;
+	}
+
+	/**
+	 * @brief 写入缓存条目
+	 * @param versionHash 版本继承链哈希
+	 * @param contextHash 启动上下文哈希
+	 * @param skeleton 规划骨架
+	 */
+	void PlanSkeletonCache::Put(uint64_t versionHash, uint64_t contextHash, std::shared_ptr<const PlanSkeleton> skeleton) {
+		std::lock_guard lock(m_mutex);
+		if (m_capacity == 0) return;
+
+		Key key { versionHash, contextHash };
+		if (auto it = m_lookup.find(key); it != m_lookup.end()) {
+			m_entries.erase(it->second);
+			m_lookup.erase(it);
+		}
+
+		m_entries.push_front({ key, std::move(skeleton) });
+		m_lookup.emplace(key, m_entries.begin());
+		while (m_entries.size() > m_capacity) {
+			m_lookup.erase(m_entries.back().CacheKey);
+			m_entries.pop_back();
+		}
+	}
+
+	/**
+	 * @brief 清空缓存并重置统计
+	 */
+	void PlanSkeletonCache::Clear() {
+		std::lock_guard lock(m_mutex);
+		m_entries.clear();
+		m_lookup.clear();
+		m_hits = 0;
+		m_misses = 0;
+	}
+
+	size_t PlanSkeletonCache::Size() const {
+		std::lock_guard lock(m_mutex);
+		return m_entries.size();
+	}
+
+	uint64_t PlanSkeletonCache::Hits() const {
+		std::lock_guard lock(m_mutex);
+		return m_hits;
+	}
+
+	uint64_t PlanSkeletonCache::Misses() const {
+		std::lock_guard lock(m_mutex);
+		return m_misses;
+	}
+}
@@ -0,0 +1,99 @@
+#pragma once
+#include "Launcher/Version/ArgumentTemplate.h"
+#include "Launcher/Version/LibraryResolver.h"
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace PCL_CPP::Core::Launcher::Launch {
+	/**
+	 * @brief 启动规划骨架
+	 *
+	 * @details
+	 * 已渲染完毕、仅保留易变占位符的启动参数。Classpath、JVM 参数、主类等全部固化为字面量，
+	 * 只有 `VolatilePlaceholders` 中的占位符（认证信息与分辨率）仍为占位符段，再次规划时按新的替换表渲染即可。
+	 */
+	struct PlanSkeleton {
+		/**
+		 * @brief 不计入缓存键、每次规划都重新渲染的占位符
+		 */
+		static constexpr uint32_t VolatilePlaceholders = Version::MakePlaceholderMask({
+			Version::Placeholder::AuthPlayerName, Version::Placeholder::AuthUuid, Version::Placeholder::AuthAccessToken,
+			Version::Placeholder::UserType, Version::Placeholder::ResolutionWidth, Version::Placeholder::ResolutionHeight
+		});
+
+		std::filesystem::path Executable;                         ///< 可执行文件路径
+		std::filesystem::path WorkingDirectory;                   ///< 工作目录
+		std::vector<Version::ArgumentTemplate> Arguments;         ///< 部分渲染后的启动参数
+		std::vector<Version::DroppedLibrary> DroppedLibraries;    ///< 构建 Classpath 时被丢弃的重复库
+	};
+
+	/**
+	 * @brief 启动规划骨架的有界 LRU 缓存
+	 *
+	 * @details
+	 * 以（版本继承链哈希, 启动上下文哈希）为键缓存 `PlanSkeleton`。上下文哈希不包含认证信息与分辨率，
+	 * 因此切换账号或调整窗口大小后重新启动同一实例时可直接命中，只需渲染少量易变占位符。
+	 * 所有方法均可并发调用；缓存的骨架不可变，可在多个规划器之间共享。
+	 */
+	class PlanSkeletonCache {
+		public:
+		static constexpr size_t DefaultCapacity = 16; ///< 默认容量
+
+		/**
+		 * @brief 构造函数
+		 * @param capacity 最大条目数
+		 */
+		explicit PlanSkeletonCache(size_t capacity = DefaultCapacity);
+
+		/**
+		 * @brief 查找缓存条目
+		 * @param versionHash 版本继承链哈希
+		 * @param contextHash 启动上下文哈希
+		 * @return 命中时返回缓存的骨架，否则返回 nullptr
+		 */
+		std::shared_ptr<const PlanSkeleton> Find(uint64_t versionHash, uint64_t contextHash);
+
+		/**
+		 * @brief 写入缓存条目
+		 * @param versionHash 版本继承链哈希
+		 * @param contextHash 启动上下文哈希
+		 * @param skeleton 规划骨架
+		 */
+		void Put(uint64_t versionHash, uint64_t contextHash, std::shared_ptr<const PlanSkeleton> skeleton);
+
+		/**
+		 * @brief 清空缓存并重置统计
+		 */
+		void Clear();
+
+		size_t Size() const;      ///< 当前条目数
+		uint64_t Hits() const;    ///< 命中次数
+		uint64_t Misses() const;  ///< 未命中次数
+
+		private:
+		struct Key {
+			uint64_t VersionHash;
+			uint64_t ContextHash;
+			bool operator==(const Key &) const = default;
+		};
+		struct KeyHash {
+			size_t operator()(const Key &key) const noexcept;
+		};
+		struct Entry {
+			Key CacheKey;
+			std::shared_ptr<const PlanSkeleton> Skeleton;
+		};
+
+		mutable std::mutex m_mutex;
+		size_t m_capacity;
+		std::list<Entry> m_entries; ///< 按最近使用排序，表头为最近使用
+		std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> m_lookup;
+		uint64_t m_hits = 0;
+		uint64_t m_misses = 0;
+	};
+}
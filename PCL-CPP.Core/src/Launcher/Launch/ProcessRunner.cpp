@@ -85,4 +85,19 @@ namespace PCL_CPP::Core::Launcher::Launch {
 
         return true;
     }
+
+    /**
+     * @brief 检查指定 PID 的进程是否仍在运行
+     * @param pid 进程 ID
+     * @return 进程存在且尚未退出时返回 true
+     */
+    bool ProcessRunner::IsRunning(uint32_t pid) {
+        HANDLE process = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, pid);
+        if (!process) return GetLastError() == ERROR_ACCESS_DENIED;
+
+        DWORD exitCode = 0;
+        bool running = GetExitCodeProcess(process, &exitCode) && exitCode == STILL_ACTIVE;
+        CloseHandle(process);
+        return running;
+    }
 }
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <filesystem>
 #include <vector>
@@ -31,6 +32,17 @@ namespace PCL_CPP::Core::Launcher::Launch {
          */
         static bool Start(const ProcessStartInfo& startInfo);
 
+        /**
+         * @brief 检查指定 PID 的进程是否仍在运行
+         * @details 
+         * 用于判断临时目录、墓碑等以 PID 命名的文件是否仍属于某个运行中的实例。
+         * PID 可能被系统复用，因此返回 true 只表示“可能仍在使用”，调用方应将其视为不可回收。
+         * 没有权限打开该进程时同样视为仍在运行。
+         * @param pid 进程 ID
+         * @return 进程存在且尚未退出时返回 true
+         */
+        static bool IsRunning(uint32_t pid);
+
     private:
         /**
          * @brief 对 Windows 命令行参数进行转义处理
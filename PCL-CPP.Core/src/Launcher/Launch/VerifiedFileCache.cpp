@@ -0,0 +1,165 @@
+#include "pch.h"
+#include "App/Logging/AppLogger.h"
+#include "VerifiedFileCache.h"
+#include "Utils/IO/BinaryIO.h"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iterator>
+
+using namespace PCL_CPP::Core::Logging;
+using namespace PCL_CPP::Core::Utils;
+
+namespace PCL_CPP::Core::Launcher::Launch {
+
+	static constexpr uint64_t CacheMagic = 0x59464952564C4350ull; ///< 文件头魔数，小端序下为 "PCLVRIFY"
+
+	/**
+	 * @brief 将路径规范化为记录键
+	 * @param path 文件路径
+	 * @return 绝对、规范化、使用 '/' 分隔的路径
+	 */
+	static std::string MakeKey(const std::filesystem::path &path) {
+		std::error_code ec;
+		auto absolute = std::filesystem::absolute(path, ec);
+		return (ec ? path : absolute).lexically_normal().generic_string();
+	}
+
+	/**
+	 * @brief 将十六进制校验值转换为小写
+	 * @param sha1 校验值
+	 * @return 小写校验值
+	 */
+	static std::string ToLower(std::string_view sha1) {
+		std::string result(sha1);
+		std::transform(result.begin(), result.end(), result.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+		return result;
+	}
+
+	/**
+	 * @brief 构造函数
+	 * @param cachePath 记录文件路径
+	 */
+	VerifiedFileCache::VerifiedFileCache(std::filesystem::path cachePath)
+		: m_cachePath(std::move(cachePath)) { }
+
+	/**
+	 * @brief 从磁盘加载记录
+	 * @return 是否成功读取到有效记录
+	 */
+	bool VerifiedFileCache::Load() {
+		std::lock_guard lock(m_mutex);
+		m_entries.clear();
+		m_dirty = false;
+
+		std::ifstream file(m_cachePath, std::ios::binary);
+		if (!file.is_open()) return false;
+
+		std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		BinaryReader reader(data);
+
+		if (reader.Read<uint64_t>() != CacheMagic || reader.Read<uint32_t>() != FormatVersion) {
+			LOG_INFO("Verified file cache {} is outdated or invalid, rebuilding.", m_cachePath.string());
+			m_dirty = true;
+			return false;
+		}
+
+		uint32_t count = reader.Read<uint32_t>();
+		std::unordered_map<std::string, Entry> entries;
+		entries.reserve(count);
+		for (uint32_t i = 0; i < count && reader.IsOk(); i++) {
+			std::string key = reader.ReadString();
+			Entry entry;
+			entry.Stamp.Size = reader.Read<uint64_t>();
+			entry.Stamp.ModifiedTime = reader.Read<int64_t>();
+			entry.Sha1 = reader.ReadString();
+			entries.emplace(std::move(key), std::move(entry));
+		}
+
+		if (!reader.IsOk()) {
+			LOG_WARNING("Verified file cache {} is truncated, rebuilding.", m_cachePath.string());
+			m_dirty = true;
+			return false;
+		}
+
+		m_entries = std::move(entries);
+		LOG_DEBUG("Loaded verified file cache with {} entries.", m_entries.size());
+		return true;
+	}
+
+	/**
+	 * @brief 如有修改则将记录保存到磁盘
+	 * @return 无需保存或保存成功时返回 true
+	 */
+	bool VerifiedFileCache::Save() {
+		std::lock_guard lock(m_mutex);
+		if (!m_dirty) return true;
+
+		BinaryWriter writer;
+		writer.Write<uint64_t>(CacheMagic);
+		writer.Write<uint32_t>(FormatVersion);
+		writer.Write<uint32_t>(static_cast<uint32_t>(m_entries.size()));
+		for (const auto &[key, entry] : m_entries) {
+			writer.WriteString(key);
+			writer.Write<uint64_t>(entry.Stamp.Size);
+			writer.Write<int64_t>(entry.Stamp.ModifiedTime);
+			writer.WriteString(entry.Sha1);
+		}
+
+		std::error_code ec;
+		std::filesystem::create_directories(m_cachePath.parent_path(), ec);
+		if (!writer.SaveAtomically(m_cachePath)) return false;
+		m_dirty = false;
+		return true;
+	}
+
+	/**
+	 * @brief 检查文件是否已以相同签名和校验值通过校验
+	 * @param path 文件路径
+	 * @param stamp 文件的当前签名
+	 * @param sha1 期望的 SHA-1（不区分大小写）
+	 * @return 记录一致时返回 true
+	 */
+	bool VerifiedFileCache::IsVerified(const std::filesystem::path &path, const FileStamp &stamp, std::string_view sha1) const {
+		std::string key = MakeKey(path);
+		std::string expected = ToLower(sha1);
+
+		std::lock_guard lock(m_mutex);
+		auto it = m_entries.find(key);
+		return it != m_entries.end() && it->second.Stamp == stamp && it->second.Sha1 == expected;
+	}
+
+	/**
+	 * @brief 记录一次成功的校验
+	 * @param path 文件路径
+	 * @param stamp 校验时文件的签名
+	 * @param sha1 校验通过的 SHA-1
+	 */
+	void VerifiedFileCache::Record(const std::filesystem::path &path, const FileStamp &stamp, std::string_view sha1) {
+		std::string key = MakeKey(path);
+		Entry entry { stamp, ToLower(sha1) };
+
+		std::lock_guard lock(m_mutex);
+		m_entries[std::move(key)] = std::move(entry);
+		m_dirty = true;
+	}
+
+	/**
+	 * @brief 删除文件的记录
+	 * @param path 文件路径
+	 */
+	void VerifiedFileCache::Forget(const std::filesystem::path &path) {
+		std::string key = MakeKey(path);
+
+		std::lock_guard lock(m_mutex);
+		if (m_entries.erase(key) > 0) m_dirty = true;
+	}
+
+	/**
+	 * @brief 获取记录数量
+	 */
+	size_t VerifiedFileCache::Size() const {
+		std::lock_guard lock(m_mutex);
+		return m_entries.size();
+	}
+}
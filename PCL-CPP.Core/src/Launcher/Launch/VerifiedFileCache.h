@@ -0,0 +1,82 @@
+#pragma once
+#include "Utils/IO/FileStamp.h"
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace PCL_CPP::Core::Launcher::Launch {
+	/**
+	 * @brief 已通过完整性校验的文件记录
+	 *
+	 * @details
+	 * 持久化保存（路径, 大小, 修改时间, SHA-1）四元组：
+	 * 1. **跳过重复校验**：文件签名与期望的 SHA-1 均与记录一致时，视为已校验，无需再次读取文件内容。
+	 * 2. **自动失效**：文件被修改（大小或修改时间变化）或版本配置声明了新的校验值时，记录不再匹配。
+	 * 3. **容错**：记录文件缺失、损坏或格式版本不符时视为空缓存。
+	 * 4. **线程安全**：`IsVerified` 与 `Record` 可在校验线程中并发调用。
+	 */
+	class VerifiedFileCache {
+		public:
+		static constexpr uint32_t FormatVersion = 1; ///< 记录文件格式版本
+
+		/**
+		 * @brief 构造函数
+		 * @param cachePath 记录文件路径
+		 */
+		explicit VerifiedFileCache(std::filesystem::path cachePath);
+
+		/**
+		 * @brief 从磁盘加载记录
+		 * @return 是否成功读取到有效记录
+		 */
+		bool Load();
+
+		/**
+		 * @brief 如有修改则将记录保存到磁盘
+		 * @return 无需保存或保存成功时返回 true
+		 */
+		bool Save();
+
+		/**
+		 * @brief 检查文件是否已以相同签名和校验值通过校验
+		 * @param path 文件路径
+		 * @param stamp 文件的当前签名
+		 * @param sha1 期望的 SHA-1（不区分大小写）
+		 * @return 记录一致时返回 true
+		 */
+		bool IsVerified(const std::filesystem::path &path, const Utils::FileStamp &stamp, std::string_view sha1) const;
+
+		/**
+		 * @brief 记录一次成功的校验
+		 * @param path 文件路径
+		 * @param stamp 校验时文件的签名
+		 * @param sha1 校验通过的 SHA-1
+		 */
+		void Record(const std::filesystem::path &path, const Utils::FileStamp &stamp, std::string_view sha1);
+
+		/**
+		 * @brief 删除文件的记录
+		 * @param path 文件路径
+		 */
+		void Forget(const std::filesystem::path &path);
+
+		/**
+		 * @brief 获取记录数量
+		 */
+		size_t Size() const;
+
+		private:
+		struct Entry {
+			Utils::FileStamp Stamp; ///< 校验时的文件签名
+			std::string Sha1;       ///< 小写十六进制校验值
+		};
+
+		std::filesystem::path m_cachePath;
+		mutable std::mutex m_mutex;
+		std::unordered_map<std::string, Entry> m_entries; ///< 规范化路径 -> 记录
+		bool m_dirty = false;
+	};
+}
@@ -0,0 +1,202 @@
+#include "pch.h"
+#include "ArgumentTemplate.h"
+
+namespace PCL_CPP::Core::Launcher::Version {
+	using Utils::InternedString;
+	using Utils::StringPool;
+
+	/**
+	 * @brief 从名称映射表构建替换表
+	 * @param substitutions 占位符名称到替换值的映射
+	 */
+	SubstitutionTable::SubstitutionTable(const std::map<std::string, std::string> &substitutions) {
+		for (const auto &[name, value] : substitutions) Set(name, value);
+	}
+
+	/**
+	 * @brief 设置内置占位符的替换值
+	 * @param key 内置占位符
+	 * @param value 替换值
+	 */
+	void SubstitutionTable::Set(Placeholder key, std::string_view value) {
+		if (key == Placeholder::Custom) return;
+		auto index = static_cast<size_t>(key);
+		m_values[index] = value;
+		m_present |= 1u << index;
+	}
+
+	/**
+	 * @brief 按名称设置占位符的替换值
+	 * @param name 占位符名称
+	 * @param value 替换值
+	 */
+	void SubstitutionTable::Set(std::string_view name, std::string_view value) {
+		Placeholder key = GetPlaceholder(name);
+		if (key != Placeholder::Custom) {
+			Set(key, value);
+		} else {
+			m_overflow[StringPool::Global().Intern(name)] = value;
+		}
+	}
+
+	/**
+	 * @brief 查找占位符的替换值
+	 * @param key 内置占位符
+	 * @param name 驻留后的占位符名称
+	 * @return 替换值，未设置时返回 std::nullopt
+	 */
+	std::optional<std::string_view> SubstitutionTable::Find(Placeholder key, InternedString name) const {
+		if (key != Placeholder::Custom) {
+			auto index = static_cast<size_t>(key);
+			if (m_present & (1u << index)) return m_values[index];
+			return std::nullopt;
+		}
+		if (m_overflow.empty()) return std::nullopt;
+		auto it = m_overflow.find(name);
+		return it != m_overflow.end() ? std::optional<std::string_view>(it->second) : std::nullopt;
+	}
+
+	/**
+	 * @brief 编译参数模板
+	 * @param text 参数原文
+	 * @return 编译后的模板
+	 */
+	ArgumentTemplate ArgumentTemplate::Compile(std::string text) {
+		ArgumentTemplate result;
+		result.m_text = std::move(text);
+		std::string_view view = result.m_text;
+
+		size_t pos = 0;
+		while (pos < view.size()) {
+			size_t open = view.find("${", pos);
+			size_t close = open == std::string_view::npos ? open : view.find('}', open + 2);
+			if (close == std::string_view::npos) break;
+
+			result.AppendLiteral(pos, open - pos);
+			Segment placeholder;
+			placeholder.Offset = static_cast<uint32_t>(open);
+			placeholder.Length = static_cast<uint32_t>(close + 1 - open);
+			std::string_view name = view.substr(open + 2, close - open - 2);
+			placeholder.Key = GetPlaceholder(name);
+			placeholder.Name = StringPool::Global().Intern(name);
+			placeholder.IsPlaceholder = true;
+			result.m_segments.push_back(placeholder);
+			result.m_placeholderCount++;
+			pos = close + 1;
+		}
+		result.AppendLiteral(pos, view.size() - pos);
+		return result;
+	}
+
+	/**
+	 * @brief 构造不含占位符的模板
+	 * @param text 参数原文
+	 * @return 字面量模板
+	 */
+	ArgumentTemplate ArgumentTemplate::Literal(std::string text) {
+		ArgumentTemplate result;
+		result.m_text = std::move(text);
+		result.AppendLiteral(0, result.m_text.size());
+		return result;
+	}
+
+	/**
+	 * @brief 追加字面量段
+	 * @param offset 字面量在原文中的偏移
+	 * @param length 字面量长度
+	 */
+	void ArgumentTemplate::AppendLiteral(size_t offset, size_t length) {
+		if (length == 0) return;
+		// 相邻的字面量合并为一段（未闭合的 ${ 或部分渲染会产生这种情况）
+		if (!m_segments.empty() && !m_segments.back().IsPlaceholder) {
+			m_segments.back().Length += static_cast<uint32_t>(length);
+		} else {
+			Segment segment;
+			segment.Offset = static_cast<uint32_t>(offset);
+			segment.Length = static_cast<uint32_t>(length);
+			m_segments.push_back(segment);
+		}
+		m_literalLength += length;
+	}
+
+	/**
+	 * @brief 部分渲染
+	 * @param substitutions 替换表
+	 * @param keep 需保留的内置占位符位图
+	 * @param unknown 可选，收集替换表中不存在的占位符名称
+	 * @return 部分渲染后的模板
+	 */
+	ArgumentTemplate ArgumentTemplate::Bind(const SubstitutionTable &substitutions, uint32_t keep, std::vector<std::string> *unknown) const {
+		ArgumentTemplate result;
+		result.m_text.reserve(m_text.size());
+		std::string_view text = m_text;
+		for (const auto &segment : m_segments) {
+			size_t offset = result.m_text.size();
+			std::string_view original = text.substr(segment.Offset, segment.Length);
+
+			if (segment.IsPlaceholder && segment.Key != Placeholder::Custom && (keep & (1u << static_cast<uint32_t>(segment.Key)))) {
+				result.m_text.append(original);
+				Segment placeholder = segment;
+				placeholder.Offset = static_cast<uint32_t>(offset);
+				result.m_segments.push_back(placeholder);
+				result.m_placeholderCount++;
+				continue;
+			}
+
+			if (!segment.IsPlaceholder) {
+				result.m_text.append(original);
+			} else if (auto value = substitutions.Find(segment.Key, segment.Name)) {
+				result.m_text.append(*value);
+			} else {
+				result.m_text.append(original);
+				if (unknown) unknown->push_back(segment.Name.Str());
+			}
+			result.AppendLiteral(offset, result.m_text.size() - offset);
+		}
+		return result;
+	}
+
+	/**
+	 * @brief 渲染参数
+	 * @param substitutions 替换表
+	 * @param unknown 可选，收集替换表中不存在的占位符名称
+	 * @return 替换后的参数
+	 */
+	std::string ArgumentTemplate::Render(const SubstitutionTable &substitutions, std::vector<std::string> *unknown) const & {
+		if (IsLiteral()) return m_text;
+
+		// 先计算结果长度，一次性分配
+		size_t length = m_literalLength;
+		for (const auto &segment : m_segments) {
+			if (!segment.IsPlaceholder) continue;
+			auto value = substitutions.Find(segment.Key, segment.Name);
+			length += value ? value->size() : segment.Length;
+		}
+
+		std::string result;
+		result.reserve(length);
+		std::string_view text = m_text;
+		for (const auto &segment : m_segments) {
+			if (!segment.IsPlaceholder) {
+				result.append(text.substr(segment.Offset, segment.Length));
+			} else if (auto value = substitutions.Find(segment.Key, segment.Name)) {
+				result.append(*value);
+			} else {
+				result.append(text.substr(segment.Offset, segment.Length));
+				if (unknown) unknown->push_back(segment.Name.Str());
+			}
+		}
+		return result;
+	}
+
+	/**
+	 * @brief 渲染参数，不含占位符时直接移出原文
+	 * @param substitutions 替换表
+	 * @param unknown 可选，收集替换表中不存在的占位符名称
+	 * @return 替换后的参数
+	 */
+	std::string ArgumentTemplate::Render(const SubstitutionTable &substitutions, std::vector<std::string> *unknown) && {
+		if (IsLiteral()) return std::move(m_text);
+		return static_cast<const ArgumentTemplate &>(*this).Render(substitutions, unknown);
+	}
+}
@@ -0,0 +1,239 @@
+#pragma once
+#include "Utils/Text/StringPool.h"
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace PCL_CPP::Core::Launcher::Version {
+	/**
+	 * @brief 内置占位符
+	 * @details 启动器自身提供的替换键在编译期确定，以枚举值为下标存放在定长数组中；`Custom` 表示不在此列的自定义键。
+	 */
+	enum class Placeholder : uint8_t {
+		AuthPlayerName,
+		AuthUuid,
+		AuthAccessToken,
+		UserType,
+		VersionName,
+		VersionType,
+		AssetsIndexName,
+		GameDirectory,
+		AssetsRoot,
+		NativesDirectory,
+		LibraryDirectory,
+		ClasspathSeparator,
+		LauncherName,
+		LauncherVersion,
+		ResolutionWidth,
+		ResolutionHeight,
+		Classpath,
+		Custom ///< 自定义占位符，同时表示内置占位符的数量
+	};
+
+	/**
+	 * @brief 内置占位符的名称（不含 `${}`），与 `Placeholder` 的枚举值一一对应
+	 */
+	inline constexpr std::array<std::string_view, static_cast<size_t>(Placeholder::Custom)> PlaceholderNames = {
+		"auth_player_name", "auth_uuid", "auth_access_token", "user_type",
+		"version_name", "version_type", "assets_index_name",
+		"game_directory", "assets_root", "natives_directory", "library_directory", "classpath_separator",
+		"launcher_name", "launcher_version", "resolution_width", "resolution_height", "classpath"
+	};
+
+	/**
+	 * @brief 按名称查找内置占位符
+	 * @param name 占位符名称（不含 `${}`）
+	 * @return 对应的枚举值，不是内置占位符时返回 `Placeholder::Custom`
+	 */
+	constexpr Placeholder GetPlaceholder(std::string_view name) noexcept {
+		for (size_t i = 0; i < PlaceholderNames.size(); i++) {
+			if (PlaceholderNames[i] == name) return static_cast<Placeholder>(i);
+		}
+		return Placeholder::Custom;
+	}
+
+	/**
+	 * @brief 构建内置占位符位图
+	 * @param keys 内置占位符列表
+	 * @return 第 i 位对应枚举值 i 的位图
+	 */
+	constexpr uint32_t MakePlaceholderMask(std::initializer_list<Placeholder> keys) noexcept {
+		uint32_t mask = 0;
+		for (Placeholder key : keys) mask |= 1u << static_cast<uint32_t>(key);
+		return mask;
+	}
+
+	/**
+	 * @brief 参数替换表
+	 *
+	 * @details
+	 * 内置占位符的值存放在以 `Placeholder` 为下标的定长数组中，自定义占位符存放在以驻留名称为键的溢出表中。
+	 * 表中只保存 `std::string_view`，不复制替换值（包括长达数十 KB 的 Classpath），调用方需保证被引用的字符串在渲染期间存活。
+	 */
+	class SubstitutionTable {
+		public:
+		SubstitutionTable() = default;
+
+		/**
+		 * @brief 从名称映射表构建替换表
+		 * @details 替换值引用映射表中的字符串，映射表需在替换表使用期间保持不变。
+		 * @param substitutions 占位符名称（不含 `${}`）到替换值的映射
+		 */
+		SubstitutionTable(const std::map<std::string, std::string> &substitutions);
+
+		/**
+		 * @brief 设置内置占位符的替换值
+		 * @param key 内置占位符
+		 * @param value 替换值
+		 */
+		void Set(Placeholder key, std::string_view value);
+
+		/**
+		 * @brief 按名称设置占位符的替换值
+		 * @param name 占位符名称（不含 `${}`），内置占位符写入定长数组，其余写入溢出表
+		 * @param value 替换值
+		 */
+		void Set(std::string_view name, std::string_view value);
+
+		/**
+		 * @brief 以字符串字面量设置内置占位符的替换值
+		 * @details 使字符串字面量优先匹配此重载，而不会与被删除的 `std::string &&` 重载产生歧义。
+		 * @param key 内置占位符
+		 * @param value 替换值，需在替换表使用期间保持有效
+		 */
+		void Set(Placeholder key, const char *value) { Set(key, std::string_view(value)); }
+
+		/**
+		 * @brief 以字符串字面量按名称设置占位符的替换值
+		 * @param name 占位符名称（不含 `${}`）
+		 * @param value 替换值，需在替换表使用期间保持有效
+		 */
+		void Set(std::string_view name, const char *value) { Set(name, std::string_view(value)); }
+
+		/**
+		 * @brief 禁止以临时字符串设置内置占位符的替换值
+		 * @details 表中只保存视图，临时字符串在语句结束时即被销毁，例如 `Set(key, std::to_string(width))` 会留下悬空引用。
+		 */
+		void Set(Placeholder key, std::string &&value) = delete;
+
+		/**
+		 * @brief 禁止以临时字符串按名称设置占位符的替换值
+		 */
+		void Set(std::string_view name, std::string &&value) = delete;
+
+		/**
+		 * @brief 查找占位符的替换值
+		 * @param key 内置占位符；为 `Placeholder::Custom` 时按 `name` 查找溢出表
+		 * @param name 驻留后的占位符名称
+		 * @return 替换值，未设置时返回 std::nullopt
+		 */
+		std::optional<std::string_view> Find(Placeholder key, Utils::InternedString name = {}) const;
+
+		private:
+		static_assert(static_cast<size_t>(Placeholder::Custom) <= 32, "内置占位符数量超出 m_present 的位数");
+
+		std::array<std::string_view, static_cast<size_t>(Placeholder::Custom)> m_values {};
+		uint32_t m_present = 0; ///< 已设置的内置占位符位图，用于区分未设置与空值
+		std::unordered_map<Utils::InternedString, std::string_view, Utils::InternedString::Hash> m_overflow;
+	};
+
+	/**
+	 * @brief 预编译的参数模板
+	 *
+	 * @details
+	 * 将含有 `${name}` 占位符的参数字符串在编译时切分为字面量段与占位符段，内置占位符在编译时解析为枚举值，其余占位符名称驻留为句柄。
+	 * 渲染时只需按段顺序写入预先分配好的缓冲区，整体为单次遍历，不再对每个替换键执行 find / replace。
+	 * 替换表中不存在的占位符保留原文 `${name}`，并可通过 `unknown` 参数收集。
+	 */
+	class ArgumentTemplate {
+		public:
+		/**
+		 * @brief 模板片段
+		 */
+		struct Segment {
+			uint32_t Offset = 0;                   ///< 字面量在原文中的偏移（占位符段为 `${` 的位置）
+			uint32_t Length = 0;                   ///< 字面量长度（占位符段为含 `${}` 的完整长度）
+			Placeholder Key = Placeholder::Custom; ///< 编译时解析出的内置占位符
+			Utils::InternedString Name;            ///< 占位符名称，字面量段为空
+			bool IsPlaceholder = false;            ///< 是否为占位符段
+		};
+
+		ArgumentTemplate() = default;
+
+		/**
+		 * @brief 编译参数模板
+		 * @details 未闭合的 `${` 视为字面量。
+		 * @param text 参数原文
+		 * @return 编译后的模板
+		 */
+		static ArgumentTemplate Compile(std::string text);
+
+		/**
+		 * @brief 构造不含占位符的模板
+		 * @details 原文中的 `${` 不会被解析，用于启动器自行拼接、可能包含任意路径的参数。
+		 * @param text 参数原文
+		 * @return 字面量模板
+		 */
+		static ArgumentTemplate Literal(std::string text);
+
+		/**
+		 * @brief 部分渲染
+		 * @details
+		 * `keep` 中的内置占位符保留为占位符段，其余占位符按替换表替换为字面量（未知占位符保留原文并报告）。
+		 * 结果可缓存，之后只需以包含 `keep` 中各键的替换表再次 `Render`。
+		 * @param substitutions 替换表
+		 * @param keep 需保留的内置占位符位图（第 i 位对应枚举值 i）
+		 * @param unknown 可选，收集替换表中不存在的占位符名称
+		 * @return 部分渲染后的模板
+		 */
+		ArgumentTemplate Bind(const SubstitutionTable &substitutions, uint32_t keep, std::vector<std::string> *unknown = nullptr) const;
+
+		/**
+		 * @brief 渲染参数
+		 * @param substitutions 替换表
+		 * @param unknown 可选，收集替换表中不存在的占位符名称
+		 * @return 替换后的参数
+		 */
+		std::string Render(const SubstitutionTable &substitutions, std::vector<std::string> *unknown = nullptr) const &;
+
+		/**
+		 * @brief 渲染参数，不含占位符时直接移出原文
+		 * @param substitutions 替换表
+		 * @param unknown 可选，收集替换表中不存在的占位符名称
+		 * @return 替换后的参数
+		 */
+		std::string Render(const SubstitutionTable &substitutions, std::vector<std::string> *unknown = nullptr) &&;
+
+		/**
+		 * @brief 获取参数原文
+		 */
+		const std::string &GetText() const { return m_text; }
+
+		/**
+		 * @brief 获取模板片段
+		 */
+		const std::vector<Segment> &GetSegments() const { return m_segments; }
+
+		/**
+		 * @brief 是否不含任何占位符
+		 */
+		bool IsLiteral() const { return m_placeholderCount == 0; }
+
+		private:
+		/**
+		 * @brief 追加字面量段，与前一个字面量段相邻时合并
+		 */
+		void AppendLiteral(size_t offset, size_t length);
+
+		std::string m_text;
+		std::vector<Segment> m_segments;
+		size_t m_literalLength = 0;    ///< 所有字面量段的总长度，用于预分配
+		size_t m_placeholderCount = 0;
+	};
+}
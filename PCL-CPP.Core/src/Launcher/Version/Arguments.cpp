@@ -1,6 +1,6 @@
 #include "pch.h"
 #include "Arguments.h"
-#include <regex>
+#include "VersionJsonView.h"
 
 namespace PCL_CPP::Core::Launcher::Version {
 
@@ -32,9 +32,29 @@ namespace PCL_CPP::Core::Launcher::Version {
 				}
 			}
 		}
+		part.CompileRules();
+		part.CompileTemplates();
 		return part;
 	}
 
+	/**
+	 * @brief 由 `Rules` 重新编译 `Condition`
+	 */
+	void ArgumentPart::CompileRules() {
+		Condition = RulePredicate::Compile(Rules);
+	}
+
+	/**
+	 * @brief 由 `Values` 重新编译 `Templates`
+	 */
+	void ArgumentPart::CompileTemplates() {
+		Templates.clear();
+		Templates.reserve(Values.size());
+		for (const auto &value : Values) {
+			Templates.push_back(ArgumentTemplate::Compile(value));
+		}
+	}
+
 	/**
 	 * @brief 检查参数项在当前环境下是否激活
 	 * @param features 当前启用的功能开关
@@ -52,6 +72,32 @@ namespace PCL_CPP::Core::Launcher::Version {
 		return isAllowed;
 	}
 
+	/**
+	 * @brief 在环境快照上检查参数项是否激活
+	 * @param environment 环境快照
+	 * @return 如果应激活则返回 true
+	 */
+	bool ArgumentPart::IsActive(const RuleEnvironment &environment) const {
+		return Condition.Evaluate(environment);
+	}
+
+	/**
+	 * @brief 检查参数项在目标环境下是否激活
+	 * @param target 目标环境
+	 * @return 如果应激活则返回 true
+	 */
+	bool ArgumentPart::IsActive(const TargetEnvironment &target) const {
+		if (Rules.empty()) return true;
+
+		bool isAllowed = false;
+		for (const auto &rule : Rules) {
+			if (rule.IsMatch(target)) {
+				isAllowed = (rule.Action == Rule::ActionType::Allow);
+			}
+		}
+		return isAllowed;
+	}
+
 	/**
 	 * @brief 从 JSON 对象解析参数配置
 	 * @param j JSON 数据
@@ -76,21 +122,62 @@ namespace PCL_CPP::Core::Launcher::Version {
 	}
 
 	/**
-	 * @brief 执行参数占位符替换
-	 * @param str 包含占位符的字符串
-	 * @param substitutions 替换映射表
-	 * @return 替换后的字符串
+	 * @brief 从版本叠加视图解析参数配置
+	 * @param view 版本 JSON 叠加视图
+	 * @return 解析出的 Arguments 对象
 	 */
-	static std::string DoSubstitution(std::string str, const std::map<std::string, std::string> &substitutions) {
-		for (const auto &[key, val] : substitutions) {
-			std::string placeholder = "${" + key + "}";
-			size_t pos = 0;
-			while ((pos = str.find(placeholder, pos)) != std::string::npos) {
-				str.replace(pos, placeholder.length(), val);
-				pos += val.length();
-			}
+	Arguments Arguments::Parse(const VersionJsonView &view) {
+		Arguments args;
+		args.Game.reserve(view.GameArguments().Size());
+		args.Jvm.reserve(view.JvmArguments().Size());
+
+		view.GameArguments().ForEach([&](const nlohmann::json &item) { args.Game.push_back(ArgumentPart::Parse(item)); });
+		view.JvmArguments().ForEach([&](const nlohmann::json &item) { args.Jvm.push_back(ArgumentPart::Parse(item)); });
+
+		return args;
+	}
+
+	/**
+	 * @brief 遍历激活的参数项中的参数模板
+	 * @param parts 参数项列表
+	 * @param environment 环境快照
+	 * @param visit 对每个模板调用
+	 */
+	template <typename Visitor>
+	static void ForEachActive(const std::vector<ArgumentPart> &parts, const RuleEnvironment &environment, Visitor &&visit) {
+		for (const auto &part : parts) {
+			if (!part.IsActive(environment)) continue;
+			for (const auto &tmpl : part.Templates) visit(tmpl);
 		}
-		return str;
+	}
+
+	/**
+	 * @brief 收集激活的参数项并渲染模板
+	 * @param parts 参数项列表
+	 * @param substitutions 替换表
+	 * @param environment 环境快照
+	 * @param unknown 可选，收集未知占位符
+	 * @return 替换后的参数列表
+	 */
+	static std::vector<std::string> CollectArgs(const std::vector<ArgumentPart> &parts, const SubstitutionTable &substitutions, const RuleEnvironment &environment, std::vector<std::string> *unknown) {
+		std::vector<std::string> result;
+		ForEachActive(parts, environment, [&](const ArgumentTemplate &tmpl) { result.push_back(tmpl.Render(substitutions, unknown)); });
+		return result;
+	}
+
+	/**
+	 * @brief 收集激活的参数项并部分渲染模板
+	 * @param parts 参数项列表
+	 * @param substitutions 替换表
+	 * @param environment 环境快照
+	 * @param keep 需保留的内置占位符位图
+	 * @param unknown 可选，收集未知占位符
+	 * @return 部分渲染后的模板列表
+	 */
+	static std::vector<ArgumentTemplate> BindArgs(const std::vector<ArgumentPart> &parts, const SubstitutionTable &substitutions, const RuleEnvironment &environment, uint32_t keep, std::vector<std::string> *unknown) {
+		std::vector<ArgumentTemplate> result;
+		ForEachActive(parts, environment, [&](const ArgumentTemplate &tmpl) { result.push_back(tmpl.Bind(substitutions, keep, unknown)); });
+		return result;
 	}
 
 	/**
@@ -100,15 +187,38 @@ namespace PCL_CPP::Core::Launcher::Version {
 	 * @return 替换后的完整游戏参数列表
 	 */
 	std::vector<std::string> Arguments::GetGameArgs(const std::map<std::string, std::string> &substitutions, const std::map<std::string, bool> &features) const {
-		std::vector<std::string> result;
-		for (const auto &part : Game) {
-			if (part.IsActive(features)) {
-				for (const auto &val : part.Values) {
-					result.push_back(DoSubstitution(val, substitutions));
-				}
-			}
-		}
-		return result;
+		return CollectArgs(Game, SubstitutionTable(substitutions), RuleEnvironment::Current(features), nullptr);
+	}
+
+	/**
+	 * @brief 在环境快照上获取处理后的游戏启动参数列表
+	 * @param substitutions 参数替换映射表
+	 * @param environment 环境快照
+	 * @return 替换后的完整游戏参数列表
+	 */
+	std::vector<std::string> Arguments::GetGameArgs(const std::map<std::string, std::string> &substitutions, const RuleEnvironment &environment) const {
+		return CollectArgs(Game, SubstitutionTable(substitutions), environment, nullptr);
+	}
+
+	/**
+	 * @brief 以预构建的替换表获取处理后的游戏启动参数列表
+	 * @param substitutions 参数替换表
+	 * @param environment 环境快照
+	 * @param unknown 可选，收集未知占位符
+	 * @return 替换后的完整游戏参数列表
+	 */
+	std::vector<std::string> Arguments::GetGameArgs(const SubstitutionTable &substitutions, const RuleEnvironment &environment, std::vector<std::string> *unknown) const {
+		return CollectArgs(Game, substitutions, environment, unknown);
+	}
+
+	/**
+	 * @brief 获取处理后的游戏启动参数列表
+	 * @param substitutions 参数替换映射表
+	 * @param target 目标环境
+	 * @return 替换后的完整游戏参数列表
+	 */
+	std::vector<std::string> Arguments::GetGameArgs(const std::map<std::string, std::string> &substitutions, const TargetEnvironment &target) const {
+		return CollectArgs(Game, SubstitutionTable(substitutions), RuleEnvironment::From(target), nullptr);
 	}
 
 	/**
@@ -118,14 +228,61 @@ namespace PCL_CPP::Core::Launcher::Version {
 	 * @return 替换后的完整 JVM 参数列表
 	 */
 	std::vector<std::string> Arguments::GetJvmArgs(const std::map<std::string, std::string> &substitutions, const std::map<std::string, bool> &features) const {
-		std::vector<std::string> result;
-		for (const auto &part : Jvm) {
-			if (part.IsActive(features)) {
-				for (const auto &val : part.Values) {
-					result.push_back(DoSubstitution(val, substitutions));
-				}
-			}
-		}
-		return result;
+		return CollectArgs(Jvm, SubstitutionTable(substitutions), RuleEnvironment::Current(features), nullptr);
+	}
+
+	/**
+	 * @brief 在环境快照上获取处理后的 JVM 启动参数列表
+	 * @param substitutions 参数替换映射表
+	 * @param environment 环境快照
+	 * @return 替换后的完整 JVM 参数列表
+	 */
+	std::vector<std::string> Arguments::GetJvmArgs(const std::map<std::string, std::string> &substitutions, const RuleEnvironment &environment) const {
+		return CollectArgs(Jvm, SubstitutionTable(substitutions), environment, nullptr);
+	}
+
+	/**
+	 * @brief 以预构建的替换表获取处理后的 JVM 启动参数列表
+	 * @param substitutions 参数替换表
+	 * @param environment 环境快照
+	 * @param unknown 可选，收集未知占位符
+	 * @return 替换后的完整 JVM 参数列表
+	 */
+	std::vector<std::string> Arguments::GetJvmArgs(const SubstitutionTable &substitutions, const RuleEnvironment &environment, std::vector<std::string> *unknown) const {
+		return CollectArgs(Jvm, substitutions, environment, unknown);
+	}
+
+	/**
+	 * @brief 获取处理后的JVM 启动参数列表
+	 * @param substitutions 参数替换映射表
+	 * @param target 目标环境
+	 * @return 替换后的完整JVM 参数列表
+	 */
+	std::vector<std::string> Arguments::GetJvmArgs(const std::map<std::string, std::string> &substitutions, const TargetEnvironment &target) const {
+		return CollectArgs(Jvm, SubstitutionTable(substitutions), RuleEnvironment::From(target), nullptr);
+	}
+
+	/**
+	 * @brief 部分渲染激活的游戏参数
+	 * @param substitutions 参数替换表
+	 * @param environment 环境快照
+	 * @param keep 需保留的内置占位符位图
+	 * @param unknown 可选，收集未知占位符
+	 * @return 部分渲染后的游戏参数模板
+	 */
+	std::vector<ArgumentTemplate> Arguments::BindGameArgs(const SubstitutionTable &substitutions, const RuleEnvironment &environment, uint32_t keep, std::vector<std::string> *unknown) const {
+		return BindArgs(Game, substitutions, environment, keep, unknown);
+	}
+
+	/**
+	 * @brief 部分渲染激活的 JVM 参数
+	 * @param substitutions 参数替换表
+	 * @param environment 环境快照
+	 * @param keep 需保留的内置占位符位图
+	 * @param unknown 可选，收集未知占位符
+	 * @return 部分渲染后的 JVM 参数模板
+	 */
+	std::vector<ArgumentTemplate> Arguments::BindJvmArgs(const SubstitutionTable &substitutions, const RuleEnvironment &environment, uint32_t keep, std::vector<std::string> *unknown) const {
+		return BindArgs(Jvm, substitutions, environment, keep, unknown);
 	}
 }
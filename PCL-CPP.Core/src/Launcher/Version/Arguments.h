@@ -1,17 +1,22 @@
 #pragma once
+#include "ArgumentTemplate.h"
 #include "Rule.h"
+#include "RuleEngine.h"
 #include <map>
 #include <string>
 #include <vector>
 
 namespace PCL_CPP::Core::Launcher::Version {
+	class VersionJsonView;
 
 	/**
 	 * @brief 参数项结构体，包含一个或多个参数值及其启用规则。
 	 */
 	struct ArgumentPart {
 		std::vector<std::string> Values; ///< 参数值列表
-		std::vector<Rule> Rules;         ///< 启用该参数项需满足的规则
+		std::vector<Rule> Rules;         ///< 启用该参数项需满足的规则；解析后修改时需调用 `CompileRules` 更新 `Condition`
+		RulePredicate Condition;         ///< 由 Rules 编译而来的启用条件（Parse 时生成）
+		std::vector<ArgumentTemplate> Templates; ///< 由 Values 编译而来的参数模板（Parse 时生成）；解析后修改 Values 时需调用 `CompileTemplates` 更新
 
 		/**
 		 * @brief 从 JSON 对象解析参数项
@@ -20,12 +25,39 @@ namespace PCL_CPP::Core::Launcher::Version {
 		 */
 		static ArgumentPart Parse(const nlohmann::json &j);
 
+		/**
+		 * @brief 由 `Rules` 重新编译 `Condition`
+		 * @details `Parse` 会自动调用；在解析后修改 `Rules` 时必须调用，否则在环境快照上求值时仍使用修改前的规则。
+		 */
+		void CompileRules();
+
+		/**
+		 * @brief 由 `Values` 重新编译 `Templates`
+		 * @details `Parse` 会自动调用；在解析后修改 `Values` 时必须调用，否则渲染时仍使用修改前的参数值。
+		 */
+		void CompileTemplates();
+
 		/**
 		 * @brief 检查该参数项在当前环境下是否激活
 		 * @param features 当前启用的功能开关
 		 * @return 如果应激活则返回 true
 		 */
 		bool IsActive(const std::map<std::string, bool> &features) const;
+
+		/**
+		 * @brief 在环境快照上检查该参数项是否激活
+		 * @details 只对编译后的 `Condition` 求值，不检查 `Rules`。
+		 * @param environment 环境快照
+		 * @return 如果应激活则返回 true
+		 */
+		bool IsActive(const RuleEnvironment &environment) const;
+
+		/**
+		 * @brief 检查该参数项在目标环境下是否激活
+		 * @param target 目标环境
+		 * @return 如果应激活则返回 true
+		 */
+		bool IsActive(const TargetEnvironment &target) const;
 	};
 
 	/**
@@ -43,6 +75,14 @@ namespace PCL_CPP::Core::Launcher::Version {
 		 */
 		static Arguments Parse(const nlohmann::json &j);
 
+		/**
+		 * @brief 从版本叠加视图解析参数配置
+		 * @details 直接遍历各层 JSON 中的参数分段，无需先平铺继承链。
+		 * @param view 版本 JSON 叠加视图
+		 * @return 解析出的 Arguments 对象
+		 */
+		static Arguments Parse(const VersionJsonView &view);
+
 		/**
 		 * @brief 获取处理后的游戏启动参数列表
 		 * @param substitutions 参数替换映射表 (例如 "${version_name}" -> "1.18.2")
@@ -51,6 +91,31 @@ namespace PCL_CPP::Core::Launcher::Version {
 		 */
 		std::vector<std::string> GetGameArgs(const std::map<std::string, std::string> &substitutions, const std::map<std::string, bool> &features = {}) const;
 
+		/**
+		 * @brief 在环境快照上获取处理后的游戏启动参数列表
+		 * @param substitutions 参数替换映射表
+		 * @param environment 环境快照
+		 * @return 替换后的完整游戏参数列表
+		 */
+		std::vector<std::string> GetGameArgs(const std::map<std::string, std::string> &substitutions, const RuleEnvironment &environment) const;
+
+		/**
+		 * @brief 以预构建的替换表获取处理后的游戏启动参数列表
+		 * @param substitutions 参数替换表
+		 * @param environment 环境快照
+		 * @param unknown 可选，收集替换表中不存在的占位符名称
+		 * @return 替换后的完整游戏参数列表
+		 */
+		std::vector<std::string> GetGameArgs(const SubstitutionTable &substitutions, const RuleEnvironment &environment, std::vector<std::string> *unknown = nullptr) const;
+
+		/**
+		 * @brief 获取处理后的游戏启动参数列表
+		 * @param substitutions 参数替换映射表
+		 * @param target 目标环境
+		 * @return 替换后的完整游戏参数列表
+		 */
+		std::vector<std::string> GetGameArgs(const std::map<std::string, std::string> &substitutions, const TargetEnvironment &target) const;
+
 		/**
 		 * @brief 获取处理后的 JVM 启动参数列表
 		 * @param substitutions 参数替换映射表
@@ -58,5 +123,51 @@ namespace PCL_CPP::Core::Launcher::Version {
 		 * @return 替换后的完整 JVM 参数列表
 		 */
 		std::vector<std::string> GetJvmArgs(const std::map<std::string, std::string> &substitutions, const std::map<std::string, bool> &features = {}) const;
+
+		/**
+		 * @brief 在环境快照上获取处理后的 JVM 启动参数列表
+		 * @param substitutions 参数替换映射表
+		 * @param environment 环境快照
+		 * @return 替换后的完整 JVM 参数列表
+		 */
+		std::vector<std::string> GetJvmArgs(const std::map<std::string, std::string> &substitutions, const RuleEnvironment &environment) const;
+
+		/**
+		 * @brief 以预构建的替换表获取处理后的 JVM 启动参数列表
+		 * @param substitutions 参数替换表
+		 * @param environment 环境快照
+		 * @param unknown 可选，收集替换表中不存在的占位符名称
+		 * @return 替换后的完整 JVM 参数列表
+		 */
+		std::vector<std::string> GetJvmArgs(const SubstitutionTable &substitutions, const RuleEnvironment &environment, std::vector<std::string> *unknown = nullptr) const;
+
+		/**
+		 * @brief 获取处理后的JVM 启动参数列表
+		 * @param substitutions 参数替换映射表
+		 * @param target 目标环境
+		 * @return 替换后的完整JVM 参数列表
+		 */
+		std::vector<std::string> GetJvmArgs(const std::map<std::string, std::string> &substitutions, const TargetEnvironment &target) const;
+
+		/**
+		 * @brief 部分渲染激活的游戏参数
+		 * @details 参见 `ArgumentTemplate::Bind`，结果可缓存并在之后以新的替换表渲染 `keep` 中的占位符。
+		 * @param substitutions 参数替换表
+		 * @param environment 环境快照
+		 * @param keep 需保留的内置占位符位图
+		 * @param unknown 可选，收集替换表中不存在的占位符名称
+		 * @return 部分渲染后的游戏参数模板
+		 */
+		std::vector<ArgumentTemplate> BindGameArgs(const SubstitutionTable &substitutions, const RuleEnvironment &environment, uint32_t keep, std::vector<std::string> *unknown = nullptr) const;
+
+		/**
+		 * @brief 部分渲染激活的 JVM 参数
+		 * @param substitutions 参数替换表
+		 * @param environment 环境快照
+		 * @param keep 需保留的内置占位符位图
+		 * @param unknown 可选，收集替换表中不存在的占位符名称
+		 * @return 部分渲染后的 JVM 参数模板
+		 */
+		std::vector<ArgumentTemplate> BindJvmArgs(const SubstitutionTable &substitutions, const RuleEnvironment &environment, uint32_t keep, std::vector<std::string> *unknown = nullptr) const;
 	};
 }
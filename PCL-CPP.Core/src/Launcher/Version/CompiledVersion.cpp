@@ -0,0 +1,66 @@
+#include "pch.h"
+#include "CompiledVersion.h"
+#include "VersionJsonView.h"
+#include "App/Logging/AppLogger.h"
+#include <sstream>
+#include <stdexcept>
+
+namespace PCL_CPP::Core::Launcher::Version {
+
+	/**
+	 * @brief 从版本信息构建编译模型
+	 * @param info 已解析的版本信息
+	 * @return 编译后的版本模型
+	 * @throws std::runtime_error 仅包含头部字段的版本无法加载完整配置
+	 */
+	std::shared_ptr<const CompiledVersion> CompiledVersion::Compile(const VersionInfo &info) {
+		// 仅包含头部字段的版本先加载完整配置，直接使用缓存中的共享实例而不复制
+		if (info.IsHeaderOnly) {
+			auto full = VersionLocator::GetSharedVersion(info.RootPath.parent_path(), info.RootPath.filename().string());
+			if (!full) {
+				// 不能退回编译头部字段：那样会得到没有依赖库和参数的规划
+				LOG_ERROR("Failed to materialize version {}", info.Id);
+				throw std::runtime_error("Cannot load version: " + info.Id);
+			}
+			return Compile(*full);
+		}
+
+		auto compiled = std::make_shared<CompiledVersion>();
+		compiled->Id = info.Id;
+		compiled->Type = info.Type;
+		compiled->Jar = info.Jar;
+		compiled->MainClass = info.MainClass;
+		compiled->AssetsIndex = info.AssetsIndex;
+		compiled->RootPath = info.RootPath;
+		compiled->ContentHash = info.ContentHash;
+		compiled->ResolvedHash = VersionLocator::GetResolvedHash(info);
+
+		VersionJsonView view(info);
+
+		// 依赖库
+		compiled->Libraries.reserve(view.Libraries().Size());
+		view.Libraries().ForEach([&](const nlohmann::json &j) {
+			compiled->Libraries.push_back(Library::Parse(j));
+		});
+
+		// 现代版参数
+		compiled->HasGameArguments = view.GameArguments().Exists();
+		compiled->HasJvmArguments = view.JvmArguments().Exists();
+		if (compiled->HasGameArguments || compiled->HasJvmArguments) {
+			compiled->Args = Arguments::Parse(view);
+		}
+
+		// 旧版参数，按空格切分并丢弃空片段，与现代版参数共用模板引擎
+		if (const auto *legacy = view.Find("minecraftArguments")) {
+			compiled->HasLegacyArguments = true;
+
+			std::stringstream ss(legacy->get<std::string>());
+			std::string segment;
+			while (std::getline(ss, segment, ' ')) {
+				if (!segment.empty()) compiled->LegacyGameArguments.push_back(ArgumentTemplate::Compile(std::move(segment)));
+			}
+		}
+
+		return compiled;
+	}
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include "Arguments.h"
+#include "Library.h"
+#include "VersionLocator.h"
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace PCL_CPP::Core::Launcher::Version {
+	/**
+	 * @brief 编译后的强类型版本模型
+	 *
+	 * @details
+	 * 由已解析的 `VersionInfo` 一次性构建，保存启动规划所需的全部数据：
+	 * 1. **依赖库**：`libraries` 中每一项都已解析为 `Library`（包括下载信息与启用规则）。
+	 * 2. **启动参数**：现代版的 `arguments.game/jvm` 解析为 `ArgumentPart`，旧版 `minecraftArguments` 预先按空格切分；两者的参数值均预编译为 `ArgumentTemplate`。
+	 * 3. **头部字段**：ID、主类、核心 Jar 等。
+	 *
+	 * 构建完成后不再持有 JSON，重复规划同一版本时无需遍历任何 JSON 节点。
+	 * 对象构建后不可变，可通过 `std::shared_ptr<const CompiledVersion>` 在多个规划器之间共享。
+	 */
+	struct CompiledVersion {
+		std::string Id;          ///< 版本 ID
+		std::string Type;        ///< 版本类型
+		std::string Jar;         ///< 核心 Jar 文件名
+		std::string MainClass;   ///< 游戏主类
+		std::string AssetsIndex; ///< 资源索引名称
+		std::filesystem::path RootPath; ///< 版本根目录路径
+		uint64_t ContentHash = 0;       ///< 版本 JSON 内容哈希
+		uint64_t ResolvedHash = 0;      ///< 继承链上所有 JSON 内容哈希的组合，无法确定时为 0（此时不应缓存规划结果）
+
+		std::vector<Library> Libraries; ///< 依赖库列表（按继承链合并后的顺序）
+		Arguments Args;                 ///< 现代版启动参数
+
+		bool HasGameArguments = false; ///< 是否声明了 arguments.game
+		bool HasJvmArguments = false;  ///< 是否声明了 arguments.jvm
+
+		bool HasLegacyArguments = false;            ///< 是否声明了 minecraftArguments
+		std::vector<ArgumentTemplate> LegacyGameArguments; ///< 按空格切分并编译后的 minecraftArguments
+
+		/**
+		 * @brief 从版本信息构建编译模型
+		 * @details 仅含头部字段的版本会先加载完整配置；叠加形式的继承版本直接通过 `VersionJsonView` 遍历，不会平铺。
+		 * @param info 已解析的版本信息
+		 * @return 编译后的版本模型
+		 * @throws std::runtime_error 仅包含头部字段的版本无法加载完整配置
+		 */
+		static std::shared_ptr<const CompiledVersion> Compile(const VersionInfo &info);
+	};
+}
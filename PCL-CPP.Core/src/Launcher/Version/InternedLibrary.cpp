@@ -0,0 +1,218 @@
+#include "pch.h"
+#include "InternedLibrary.h"
+#include <algorithm>
+
+using namespace PCL_CPP::Core::Utils;
+
+namespace PCL_CPP::Core::Launcher::Version {
+
+	/**
+	 * @brief 驻留字符串
+	 * @param text 字符串内容
+	 * @return 全局字符串池中的句柄
+	 */
+	static InternedString Intern(std::string_view text) {
+		return StringPool::Global().Intern(text);
+	}
+
+	/**
+	 * @brief 从文件信息构建驻留形式
+	 * @param info 文件信息
+	 * @return 驻留形式的文件信息
+	 */
+	InternedFileInfo InternedFileInfo::From(const FileInfo &info) {
+		InternedFileInfo result;
+		result.Path = Intern(info.Path);
+		result.Sha1 = Intern(info.Sha1);
+		result.Size = info.Size;
+
+		// 优先按相对路径拆分，使剩余部分与 Path 共享副本；否则在最后一个 '/' 之后拆分
+		std::string_view url = info.Url;
+		size_t split = url.size();
+		if (!info.Path.empty() && url.ends_with(info.Path)) {
+			split = url.size() - info.Path.size();
+		} else if (size_t slash = url.rfind('/'); slash != std::string_view::npos) {
+			split = slash + 1;
+		}
+		result.UrlBase = Intern(url.substr(0, split));
+		result.UrlTail = Intern(url.substr(split));
+		return result;
+	}
+
+	/**
+	 * @brief 拼接完整的下载链接
+	 */
+	std::string InternedFileInfo::Url() const {
+		std::string url;
+		url.reserve(UrlBase.View().size() + UrlTail.View().size());
+		url.append(UrlBase.View());
+		url.append(UrlTail.View());
+		return url;
+	}
+
+	/**
+	 * @brief 转换回普通文件信息
+	 */
+	FileInfo InternedFileInfo::ToFileInfo() const {
+		return FileInfo { Path.Str(), Sha1.Str(), Size, Url() };
+	}
+
+	/**
+	 * @brief 从规则构建驻留形式
+	 * @param rule 规则
+	 * @return 驻留形式的规则
+	 */
+	InternedRule InternedRule::From(const Rule &rule) {
+		InternedRule result;
+		result.Action = rule.Action;
+		if (rule.OsName) result.OsName = Intern(*rule.OsName);
+		if (rule.OsVersion) result.OsVersion = Intern(*rule.OsVersion);
+		if (rule.OsArch) result.OsArch = Intern(*rule.OsArch);
+
+		result.Os = OsCondition::Get(rule);
+
+		result.Features.reserve(rule.Features.size());
+		for (const auto &[key, value] : rule.Features) {
+			InternedString feature = Intern(key);
+			result.Features.emplace_back(feature, value);
+
+			// 与 RulePredicate 一致：无法分配位的功能开关在环境中始终视为未启用
+			FeatureMask bit = FeatureRegistry::Bit(feature);
+			if (bit == 0) {
+				if (value) result.Never = true;
+				continue;
+			}
+			result.Mask |= bit;
+			if (value) result.Expected |= bit;
+		}
+		return result;
+	}
+
+	/**
+	 * @brief 转换回普通规则
+	 */
+	Rule InternedRule::ToRule() const {
+		Rule rule;
+		rule.Action = Action;
+		if (OsName) rule.OsName = OsName->Str();
+		if (OsVersion) rule.OsVersion = OsVersion->Str();
+		if (OsArch) rule.OsArch = OsArch->Str();
+		for (const auto &[key, value] : Features) rule.Features[key.Str()] = value;
+		return rule;
+	}
+
+	/**
+	 * @brief 判断该规则是否匹配环境快照
+	 * @param environment 环境快照
+	 * @return 如果匹配则返回 true
+	 */
+	bool InternedRule::IsMatch(const RuleEnvironment &environment) const {
+		if (Never) return false;
+		if ((environment.Features & Mask) != Expected) return false;
+		return !Os || environment.Matches(*Os);
+	}
+
+	/**
+	 * @brief 从依赖库构建驻留形式
+	 * @param library 依赖库
+	 * @return 驻留形式的依赖库
+	 */
+	InternedLibrary InternedLibrary::From(const Library &library) {
+		InternedLibrary result;
+		result.Name = Intern(library.Name);
+		if (library.Artifact) result.Artifact = InternedFileInfo::From(*library.Artifact);
+
+		result.Classifiers.reserve(library.Classifiers.size());
+		for (const auto &[key, info] : library.Classifiers) {
+			result.Classifiers.emplace_back(Intern(key), InternedFileInfo::From(info));
+		}
+
+		result.Natives.reserve(library.Natives.size());
+		for (const auto &[os, classifier] : library.Natives) {
+			result.Natives.emplace_back(Intern(os), Intern(classifier));
+		}
+
+		if (library.Extract) {
+			auto &exclude = result.Extract.emplace();
+			exclude.reserve(library.Extract->Exclude.size());
+			for (const auto &item : library.Extract->Exclude) exclude.push_back(Intern(item));
+		}
+
+		result.Rules.reserve(library.Rules.size());
+		for (const auto &rule : library.Rules) result.Rules.push_back(InternedRule::From(rule));
+		return result;
+	}
+
+	/**
+	 * @brief 转换回普通依赖库
+	 */
+	Library InternedLibrary::ToLibrary() const {
+		Library lib;
+		lib.Name = Name.Str();
+		if (Artifact) lib.Artifact = Artifact->ToFileInfo();
+		for (const auto &[key, info] : Classifiers) lib.Classifiers[key.Str()] = info.ToFileInfo();
+		for (const auto &[os, classifier] : Natives) lib.Natives[os.Str()] = classifier.Str();
+		if (Extract) {
+			ExtractRule ex;
+			for (const auto &item : *Extract) ex.Exclude.push_back(item.Str());
+			lib.Extract = std::move(ex);
+		}
+		for (const auto &rule : Rules) lib.Rules.push_back(rule.ToRule());
+		lib.CompileRules();
+		return lib;
+	}
+
+	/**
+	 * @brief 检查该库在环境快照下是否应被激活
+	 * @param environment 环境快照
+	 * @return 如果应激活则返回 true
+	 */
+	bool InternedLibrary::IsActive(const RuleEnvironment &environment) const {
+		if (Rules.empty()) return true;
+
+		bool isAllowed = false;
+		for (const auto &rule : Rules) {
+			if (rule.IsMatch(environment)) {
+				isAllowed = (rule.Action == Rule::ActionType::Allow);
+			}
+		}
+		return isAllowed;
+	}
+
+	/**
+	 * @brief 检查该库是否为指定系统的 Native 库
+	 * @param osName 操作系统名称
+	 * @return 如果是 Native 库则返回 true
+	 */
+	bool InternedLibrary::IsNative(InternedString osName) const {
+		return std::any_of(Natives.begin(), Natives.end(), [&](const auto &item) { return item.first == osName; });
+	}
+
+	/**
+	 * @brief 在环境快照上获取适用的文件信息
+	 * @param environment 环境快照
+	 * @return 适用的文件信息，如果不适用则返回 std::nullopt
+	 */
+	std::optional<InternedFileInfo> InternedLibrary::GetApplicableFile(const RuleEnvironment &environment) const {
+		if (!IsActive(environment)) return std::nullopt;
+
+		auto native = std::find_if(Natives.begin(), Natives.end(), [&](const auto &item) { return item.first == environment.OsName; });
+		if (native == Natives.end()) {
+			return Artifact;
+		}
+
+		// 只有包含占位符的分类器键才需要重新拼接并查找句柄
+		InternedString classifierKey = native->second;
+		if (size_t pos = classifierKey.View().find("${arch}"); pos != std::string_view::npos) {
+			std::string key = classifierKey.Str();
+			key.replace(pos, 7, (environment.OsArch.View() == "x86") ? "32" : "64");
+			auto found = StringPool::Global().Find(key);
+			if (!found) return std::nullopt;
+			classifierKey = *found;
+		}
+
+		auto it = std::find_if(Classifiers.begin(), Classifiers.end(), [&](const auto &item) { return item.first == classifierKey; });
+		if (it == Classifiers.end()) return std::nullopt;
+		return it->second;
+	}
+}
@@ -0,0 +1,140 @@
+#pragma once
+#include "Library.h"
+#include "Rule.h"
+#include "RuleEngine.h"
+#include "Utils/Text/StringPool.h"
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace PCL_CPP::Core::Launcher::Version {
+	using Utils::InternedString;
+
+	/**
+	 * @brief 驻留形式的文件信息
+	 *
+	 * @details
+	 * 下载地址被拆分为前缀与剩余部分分别驻留：官方源的地址通常等于“仓库前缀 + 相对路径”，
+	 * 此时剩余部分与 `Path` 共享同一份副本，每个库只额外保存一个仓库前缀句柄。
+	 */
+	struct InternedFileInfo {
+		InternedString Path;    ///< 文件的相对路径
+		InternedString Sha1;    ///< 文件的 SHA-1 校验值
+		size_t Size = 0;        ///< 文件大小（字节）
+		InternedString UrlBase; ///< 下载链接前缀
+		InternedString UrlTail; ///< 下载链接剩余部分
+
+		/**
+		 * @brief 从文件信息构建驻留形式
+		 * @param info 文件信息
+		 * @return 驻留形式的文件信息
+		 */
+		static InternedFileInfo From(const FileInfo &info);
+
+		/**
+		 * @brief 拼接完整的下载链接
+		 */
+		std::string Url() const;
+
+		/**
+		 * @brief 转换回普通文件信息
+		 */
+		FileInfo ToFileInfo() const;
+
+		bool operator==(const InternedFileInfo &) const = default;
+	};
+
+	/**
+	 * @brief 驻留形式的规则
+	 */
+	struct InternedRule {
+		Rule::ActionType Action = Rule::ActionType::Allow; ///< 规则动作
+
+		std::optional<InternedString> OsName;    ///< 操作系统名称
+		std::optional<InternedString> OsVersion; ///< 操作系统版本正则
+		std::optional<InternedString> OsArch;    ///< 系统架构
+
+		std::vector<std::pair<InternedString, bool>> Features; ///< 功能开关要求
+
+		const OsCondition *Os = nullptr; ///< 共享的操作系统条件（版本正则已预先编译），没有操作系统条件时为空
+		FeatureMask Mask = 0;            ///< 规则涉及的功能开关
+		FeatureMask Expected = 0;        ///< 规则要求的功能开关值
+		bool Never = false;              ///< 要求了无法分配位的功能开关，永不匹配
+
+		/**
+		 * @brief 从规则构建驻留形式
+		 * @param rule 规则
+		 * @return 驻留形式的规则
+		 */
+		static InternedRule From(const Rule &rule);
+
+		/**
+		 * @brief 转换回普通规则
+		 */
+		Rule ToRule() const;
+
+		/**
+		 * @brief 判断该规则是否匹配环境快照
+		 * @details 与 `Rule::IsMatch(const TargetEnvironment &)` 语义相同，但系统条件按共享实例在快照上匹配，功能开关按位比较。
+		 * @param environment 环境快照
+		 * @return 如果匹配则返回 true
+		 */
+		bool IsMatch(const RuleEnvironment &environment) const;
+
+		bool operator==(const InternedRule &) const = default;
+	};
+
+	/**
+	 * @brief 驻留形式的依赖库
+	 *
+	 * @details
+	 * 所有字符串字段均驻留在全局字符串池中，同一个库在数百个版本中重复出现时只保存一份文本；
+	 * 库之间的比较与按名称哈希均为指针操作。各映射以有序的 `std::vector` 保存，顺序与 `Library` 中的 `std::map` 一致。
+	 */
+	class InternedLibrary {
+		public:
+		InternedString Name; ///< 库的名称 (格式为 group:artifact:version)
+
+		std::optional<InternedFileInfo> Artifact;                             ///< 主文件下载信息
+		std::vector<std::pair<InternedString, InternedFileInfo>> Classifiers; ///< 各分类器对应的下载信息
+		std::vector<std::pair<InternedString, InternedString>> Natives;       ///< OS 名称 -> 分类器键
+		std::optional<std::vector<InternedString>> Extract;                   ///< 提取时排除的文件列表
+		std::vector<InternedRule> Rules;                                      ///< 启用规则
+
+		/**
+		 * @brief 从依赖库构建驻留形式
+		 * @param library 依赖库
+		 * @return 驻留形式的依赖库
+		 */
+		static InternedLibrary From(const Library &library);
+
+		/**
+		 * @brief 转换回普通依赖库
+		 */
+		Library ToLibrary() const;
+
+		/**
+		 * @brief 检查该库在环境快照下是否应被激活
+		 * @param environment 环境快照
+		 * @return 如果应激活则返回 true
+		 */
+		bool IsActive(const RuleEnvironment &environment) const;
+
+		/**
+		 * @brief 在环境快照上获取适用的文件信息
+		 * @param environment 环境快照
+		 * @return 适用的文件信息，如果不适用则返回 std::nullopt
+		 */
+		std::optional<InternedFileInfo> GetApplicableFile(const RuleEnvironment &environment) const;
+
+		/**
+		 * @brief 检查该库是否为指定系统的 Native 库
+		 * @param osName 操作系统名称
+		 * @return 如果是 Native 库则返回 true
+		 */
+		bool IsNative(InternedString osName) const;
+
+		bool operator==(const InternedLibrary &) const = default;
+	};
+}
@@ -68,10 +68,18 @@ namespace PCL_CPP::Core::Launcher::Version {
 				lib.Rules.push_back(Rule::Parse(r));
 			}
 		}
+		lib.CompileRules();
 
 		return lib;
 	}
 
+	/**
+	 * @brief 由 `Rules` 重新编译 `Condition`
+	 */
+	void Library::CompileRules() {
+		Condition = RulePredicate::Compile(Rules);
+	}
+
 	/**
 	 * @brief 检查该库在当前环境下是否应被激活
 	 * @param features 当前启用的功能开关
@@ -90,12 +98,47 @@ namespace PCL_CPP::Core::Launcher::Version {
 		return isAllowed;
 	}
 
+	/**
+	 * @brief 在环境快照上检查该库是否应被激活
+	 * @param environment 环境快照
+	 * @return 如果应激活则返回 true
+	 */
+	bool Library::IsActive(const RuleEnvironment &environment) const {
+		return Condition.Evaluate(environment);
+	}
+
+	/**
+	 * @brief 检查该库在目标环境下是否应被激活
+	 * @param target 目标环境
+	 * @return 如果应激活则返回 true
+	 */
+	bool Library::IsActive(const TargetEnvironment &target) const {
+		if (Rules.empty()) return true;
+
+		bool isAllowed = false;
+		for (const auto &rule : Rules) {
+			if (rule.IsMatch(target)) {
+				isAllowed = (rule.Action == Rule::ActionType::Allow);
+			}
+		}
+		return isAllowed;
+	}
+
 	/**
 	 * @brief 检查该库是否为 Native 库
 	 * @return 如果是 Native 库则返回 true
 	 */
 	bool Library::IsNative() const {
-		return Natives.count("windows") > 0;
+		return IsNative("windows");
+	}
+
+	/**
+	 * @brief 检查该库是否为指定系统的 Native 库
+	 * @param osName 操作系统名称
+	 * @return 如果是 Native 库则返回 true
+	 */
+	bool Library::IsNative(std::string_view osName) const {
+		return Natives.find(std::string(osName)) != Natives.end();
 	}
 
 	/**
@@ -105,14 +148,43 @@ namespace PCL_CPP::Core::Launcher::Version {
 	 */
 	std::optional<FileInfo> Library::GetApplicableFile(const std::map<std::string, bool> &features) const {
 		if (!IsActive(features)) return std::nullopt;
+		return SelectFile("windows", SystemInfo::GetArch());
+	}
+
+	/**
+	 * @brief 在环境快照上获取适用的文件信息
+	 * @param environment 环境快照
+	 * @return 适用的文件信息，如果不适用则返回 std::nullopt
+	 */
+	std::optional<FileInfo> Library::GetApplicableFile(const RuleEnvironment &environment) const {
+		if (!IsActive(environment)) return std::nullopt;
+		return SelectFile(environment.OsName.View(), environment.OsArch.View());
+	}
+
+	/**
+	 * @brief 获取适用于目标环境的文件信息
+	 * @param target 目标环境
+	 * @return 适用的文件信息，如果不适用则返回 std::nullopt
+	 */
+	std::optional<FileInfo> Library::GetApplicableFile(const TargetEnvironment &target) const {
+		if (!IsActive(target)) return std::nullopt;
+		return SelectFile(target.OsName, target.OsArch);
+	}
 
-		if (IsNative()) {
-			std::string classifierKey = Natives.at("windows");
+	/**
+	 * @brief 在已激活的前提下选择适用的文件（Native 分类器或主文件）
+	 * @param osName 目标操作系统名称
+	 * @param osArch 目标系统架构
+	 * @return 适用的文件信息，如果不适用则返回 std::nullopt
+	 */
+	std::optional<FileInfo> Library::SelectFile(std::string_view osName, std::string_view osArch) const {
+		if (auto native = Natives.find(std::string(osName)); native != Natives.end()) {
+			std::string classifierKey = native->second;
 
 			// 处理占位符替换，例如 ${arch}
 			size_t pos = classifierKey.find("${arch}");
 			if (pos != std::string::npos) {
-				std::string bitness = (SystemInfo::GetArch() == "x86") ? "32" : "64";
+				std::string bitness = (osArch == "x86") ? "32" : "64";
 				classifierKey.replace(pos, 7, bitness);
 			}
 
@@ -1,8 +1,10 @@
 #pragma once
 #include "Rule.h"
+#include "RuleEngine.h"
 #include <map>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace PCL_CPP::Core::Launcher::Version {
@@ -41,7 +43,8 @@ namespace PCL_CPP::Core::Launcher::Version {
 		std::optional<ExtractRule> Extract;
 
 		// 启用规则
-		std::vector<Rule> Rules;
+		std::vector<Rule> Rules; ///< 启用规则；解析后修改时需调用 `CompileRules` 更新 `Condition`
+		RulePredicate Condition; ///< 由 Rules 编译而来的启用条件（Parse 时生成）
 
 		/**
 		 * @brief 从 JSON 对象解析 Library
@@ -50,6 +53,12 @@ namespace PCL_CPP::Core::Launcher::Version {
 		 */
 		static Library Parse(const nlohmann::json &j);
 
+		/**
+		 * @brief 由 `Rules` 重新编译 `Condition`
+		 * @details `Parse` 会自动调用；在解析后修改 `Rules` 时必须调用，否则在环境快照上求值时仍使用修改前的规则。
+		 */
+		void CompileRules();
+
 		/**
 		 * @brief 检查该库在当前环境下是否应被激活
 		 * @param features 当前启用的功能开关
@@ -57,6 +66,21 @@ namespace PCL_CPP::Core::Launcher::Version {
 		 */
 		bool IsActive(const std::map<std::string, bool> &features = {}) const;
 
+		/**
+		 * @brief 在环境快照上检查该库是否应被激活
+		 * @details 只对编译后的 `Condition` 求值，不检查 `Rules`；`Rules` 在解析后被修改时需先调用 `CompileRules`。
+		 * @param environment 环境快照
+		 * @return 如果应激活则返回 true
+		 */
+		bool IsActive(const RuleEnvironment &environment) const;
+
+		/**
+		 * @brief 检查该库在目标环境下是否应被激活
+		 * @param target 目标环境
+		 * @return 如果应激活则返回 true
+		 */
+		bool IsActive(const TargetEnvironment &target) const;
+
 		/**
 		 * @brief 获取适用于当前环境的文件信息
 		 * @param features 当前启用的功能开关
@@ -64,10 +88,40 @@ namespace PCL_CPP::Core::Launcher::Version {
 		 */
 		std::optional<FileInfo> GetApplicableFile(const std::map<std::string, bool> &features = {}) const;
 
+		/**
+		 * @brief 在环境快照上获取适用的文件信息
+		 * @param environment 环境快照
+		 * @return 适用的文件信息，如果不适用则返回 std::nullopt
+		 */
+		std::optional<FileInfo> GetApplicableFile(const RuleEnvironment &environment) const;
+
+		/**
+		 * @brief 获取适用于目标环境的文件信息
+		 * @param target 目标环境
+		 * @return 适用的文件信息，如果不适用则返回 std::nullopt
+		 */
+		std::optional<FileInfo> GetApplicableFile(const TargetEnvironment &target) const;
+
 		/**
 		 * @brief 检查该库是否为 Native 库
 		 * @return 如果是 Native 库则返回 true
 		 */
 		bool IsNative() const;
+
+		/**
+		 * @brief 检查该库是否为指定系统的 Native 库
+		 * @param osName 操作系统名称
+		 * @return 如果是 Native 库则返回 true
+		 */
+		bool IsNative(std::string_view osName) const;
+
+		/**
+		 * @brief 在已激活的前提下选择适用的文件（Native 分类器或主文件）
+		 * @details 不检查启用规则，调用方需自行确认该库已激活；不访问任何缓存，可在多个线程中同时调用。
+		 * @param osName 目标操作系统名称
+		 * @param osArch 目标系统架构
+		 * @return 适用的文件信息，如果不适用则返回 std::nullopt
+		 */
+		std::optional<FileInfo> SelectFile(std::string_view osName, std::string_view osArch) const;
 	};
 }
@@ -0,0 +1,120 @@
+#include "pch.h"
+#include "LibraryResolver.h"
+#include "MavenCoordinate.h"
+#include <algorithm>
+#include <charconv>
+
+namespace PCL_CPP::Core::Launcher::Version {
+
+	/**
+	 * @brief 获取库名称中的版本号
+	 * @param name 库名称
+	 * @return 版本号，坐标无效时为空
+	 */
+	static std::string_view GetVersion(std::string_view name) {
+		auto coordinate = MavenCoordinate::Parse(name);
+		return coordinate ? coordinate->Version : std::string_view();
+	}
+
+	/**
+	 * @brief 构造函数
+	 * @param policy 冲突处理策略
+	 */
+	LibraryResolver::LibraryResolver(LibraryConflictPolicy policy)
+		: m_policy(policy) { }
+
+	/**
+	 * @brief 添加一个依赖库
+	 * @param lib 依赖库
+	 * @return 该库当前是否被保留
+	 */
+	bool LibraryResolver::Add(const Library &lib) {
+		if (m_policy == LibraryConflictPolicy::KeepAll) {
+			m_libraries.push_back(&lib);
+			return true;
+		}
+
+		std::string key = GetKey(lib.Name);
+		auto [it, inserted] = m_slots.try_emplace(key, m_libraries.size());
+		if (inserted) {
+			m_libraries.push_back(&lib);
+			return true;
+		}
+
+		const Library *&current = m_libraries[it->second];
+		bool replace = m_policy == LibraryConflictPolicy::ChildWins
+			|| CompareVersions(GetVersion(lib.Name), GetVersion(current->Name)) > 0;
+
+		if (replace) {
+			m_dropped.push_back({ std::move(key), current->Name, lib.Name });
+			current = &lib;
+		} else {
+			m_dropped.push_back({ std::move(key), lib.Name, current->Name });
+		}
+		return replace;
+	}
+
+	/**
+	 * @brief 计算依赖库的冲突键
+	 * @param name 库名称 (group:artifact:version[:classifier][@ext])
+	 * @return 冲突键 (group:artifact[:classifier][@ext])
+	 */
+	std::string LibraryResolver::GetKey(std::string_view name) {
+		auto coordinate = MavenCoordinate::Parse(name);
+		if (!coordinate) return std::string(name);
+
+		std::string key;
+		key.reserve(name.size());
+		key.append(coordinate->Group).append(":").append(coordinate->Artifact);
+		if (!coordinate->Classifier.empty()) key.append(":").append(coordinate->Classifier);
+		if (coordinate->Extension != "jar") key.append("@").append(coordinate->Extension);
+		return key;
+	}
+
+	/**
+	 * @brief 比较两个版本号
+	 * @param a 版本号 a
+	 * @param b 版本号 b
+	 * @return a < b 时返回负数，相等返回 0，a > b 时返回正数
+	 */
+	int LibraryResolver::CompareVersions(std::string_view a, std::string_view b) {
+		auto isSeparator = [](char c) { return c == '.' || c == '-' || c == '_'; };
+		auto nextToken = [&](std::string_view &s) {
+			size_t end = 0;
+			while (end < s.size() && !isSeparator(s[end])) end++;
+			std::string_view token = s.substr(0, end);
+			s.remove_prefix(std::min(end + 1, s.size()));
+			return token;
+		};
+		auto parseNumber = [](std::string_view token, uint64_t &value) {
+			if (token.empty()) return false;
+			auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+			return ec == std::errc() && ptr == token.data() + token.size();
+		};
+
+		while (!a.empty() || !b.empty()) {
+			if (a.empty() || b.empty()) {
+				// 多出的段为数字时版本更高，为限定符（如 beta、SNAPSHOT）时版本更低
+				std::string_view rest = a.empty() ? b : a;
+				uint64_t value = 0;
+				bool higher = parseNumber(nextToken(rest), value);
+				return (a.empty() == higher) ? -1 : 1;
+			}
+
+			std::string_view ta = nextToken(a);
+			std::string_view tb = nextToken(b);
+			uint64_t na = 0, nb = 0;
+			bool numA = parseNumber(ta, na);
+			bool numB = parseNumber(tb, nb);
+
+			if (numA && numB) {
+				if (na != nb) return na < nb ? -1 : 1;
+			} else if (numA != numB) {
+				return numA ? 1 : -1; // 数字段高于限定符段
+			} else if (int cmp = ta.compare(tb); cmp != 0) {
+				return cmp < 0 ? -1 : 1;
+			}
+		}
+		return 0;
+	}
+}
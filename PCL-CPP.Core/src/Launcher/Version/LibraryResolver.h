@@ -0,0 +1,88 @@
+#pragma once
+#include "Library.h"
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace PCL_CPP::Core::Launcher::Version {
+	/**
+	 * @brief 依赖库冲突处理策略
+	 */
+	enum class LibraryConflictPolicy {
+		KeepAll,        ///< 不去重，保留所有条目（旧行为）
+		ChildWins,      ///< 继承链中靠后（子版本）声明的条目生效
+		HighestVersion  ///< 版本号最高的条目生效，版本相同时保留先出现的条目
+	};
+
+	/**
+	 * @brief 被去重丢弃的依赖库
+	 */
+	struct DroppedLibrary {
+		std::string Key;      ///< 冲突键 (group:artifact[:classifier][@ext])
+		std::string Name;     ///< 被丢弃的库名称
+		std::string KeptName; ///< 最终保留的库名称
+	};
+
+	/**
+	 * @brief 依赖库解析器
+	 *
+	 * @details
+	 * 按 `group:artifact[:classifier][@ext]` 为依赖库建立索引，同一个键只保留一个条目：
+	 * 1. **流式处理**：按继承链合并后的顺序逐个 `Add`，无需预先收集完整列表，可与其他单次遍历的处理合并。
+	 * 2. **稳定顺序**：每个键占据其首次出现的位置，后出现的条目胜出时只替换该位置上的库，Classpath 顺序不受冲突影响。
+	 * 3. **可追溯**：所有被丢弃的条目及其对应的保留条目记录在 `GetDropped` 中。
+	 *
+	 * 解析器不检查规则，调用方应只添加在目标环境下激活的库；Classpath 库与 Native 库应使用各自的解析器。
+	 */
+	class LibraryResolver {
+		public:
+		/**
+		 * @brief 构造函数
+		 * @param policy 冲突处理策略
+		 */
+		explicit LibraryResolver(LibraryConflictPolicy policy = LibraryConflictPolicy::ChildWins);
+
+		/**
+		 * @brief 添加一个依赖库
+		 * @param lib 依赖库，需在解析器的生命周期内保持有效
+		 * @return 该库当前是否被保留（可能在之后被更晚的条目替换）
+		 */
+		bool Add(const Library &lib);
+
+		/**
+		 * @brief 获取去重后的依赖库列表
+		 */
+		const std::vector<const Library *> &GetLibraries() const { return m_libraries; }
+
+		/**
+		 * @brief 获取被丢弃的依赖库
+		 */
+		const std::vector<DroppedLibrary> &GetDropped() const { return m_dropped; }
+
+		/**
+		 * @brief 计算依赖库的冲突键
+		 * @details 坐标无效时以完整名称为键；扩展名为 jar 时省略，仅对完全相同的名称去重。
+		 * @param name 库名称 (group:artifact:version[:classifier][@ext])
+		 * @return 冲突键 (group:artifact[:classifier][@ext])
+		 */
+		static std::string GetKey(std::string_view name);
+
+		/**
+		 * @brief 比较两个版本号
+		 * @details
+		 * 以 `.`、`-`、`_` 切分后逐段比较：两段均为数字时按数值比较，否则按字典序比较。
+		 * 一方段数更多时，多出的段为数字则该版本更高（1.0.1 > 1.0），否则更低（1.0-beta < 1.0）。
+		 * @param a 版本号 a
+		 * @param b 版本号 b
+		 * @return a < b 时返回负数，相等返回 0，a > b 时返回正数
+		 */
+		static int CompareVersions(std::string_view a, std::string_view b);
+
+		private:
+		LibraryConflictPolicy m_policy;
+		std::vector<const Library *> m_libraries;
+		std::unordered_map<std::string, size_t> m_slots; ///< 冲突键 -> m_libraries 下标
+		std::vector<DroppedLibrary> m_dropped;
+	};
+}
@@ -0,0 +1,164 @@
+#include "pch.h"
+#include "MavenCoordinate.h"
+#include <algorithm>
+#include <filesystem>
+
+namespace PCL_CPP::Core::Launcher::Version {
+
+	/**
+	 * @brief 解析 Maven 坐标
+	 * @param name 坐标字符串
+	 * @return 解析结果，格式无效时返回 std::nullopt
+	 */
+	std::optional<MavenCoordinate> MavenCoordinate::Parse(std::string_view name) noexcept {
+		MavenCoordinate coordinate;
+
+		// 扩展名只能出现在最后一段
+		size_t at = name.rfind('@');
+		if (at != std::string_view::npos && name.find(':', at) == std::string_view::npos) {
+			coordinate.Extension = name.substr(at + 1);
+			name = name.substr(0, at);
+			if (coordinate.Extension.empty()) return std::nullopt;
+		}
+
+		std::string_view parts[4];
+		size_t count = 0;
+		size_t start = 0;
+		while (true) {
+			if (count == 4) return std::nullopt;
+			size_t colon = name.find(':', start);
+			parts[count++] = name.substr(start, colon - start);
+			if (colon == std::string_view::npos) break;
+			start = colon + 1;
+		}
+		if (count < 3 || parts[0].empty() || parts[1].empty() || parts[2].empty()) return std::nullopt;
+
+		coordinate.Group = parts[0];
+		coordinate.Artifact = parts[1];
+		coordinate.Version = parts[2];
+		if (count == 4) coordinate.Classifier = parts[3];
+		return coordinate;
+	}
+
+	/**
+	 * @brief 计算相对路径的长度
+	 * @return 相对路径的字符数
+	 */
+	size_t MavenCoordinate::GetPathLength() const noexcept {
+		// group/artifact/version/artifact-version[-classifier].ext
+		size_t length = Group.size() + 1 + Artifact.size() + 1 + Version.size() + 1
+			+ Artifact.size() + 1 + Version.size() + 1 + Extension.size();
+		if (!Classifier.empty()) length += 1 + Classifier.size();
+		return length;
+	}
+
+	/**
+	 * @brief 将相对路径追加到字符串末尾
+	 * @param out 输出字符串
+	 */
+	void MavenCoordinate::AppendPath(std::string &out) const {
+		size_t groupStart = out.size();
+		out.append(Group);
+		std::replace(out.begin() + groupStart, out.end(), '.', '/');
+
+		out.append(1, '/').append(Artifact);
+		out.append(1, '/').append(Version);
+		out.append(1, '/').append(Artifact).append(1, '-').append(Version);
+		if (!Classifier.empty()) out.append(1, '-').append(Classifier);
+		out.append(1, '.').append(Extension);
+	}
+
+	/**
+	 * @brief 获取相对路径
+	 */
+	std::string MavenCoordinate::GetPath() const {
+		std::string path;
+		path.reserve(GetPathLength());
+		AppendPath(path);
+		return path;
+	}
+
+	/**
+	 * @brief 构造函数
+	 * @param baseDir 基础目录
+	 */
+	LibraryPathArena::LibraryPathArena(std::string baseDir)
+		: m_baseDir(std::move(baseDir)) {
+		if (!m_baseDir.empty() && m_baseDir.back() != '/' && m_baseDir.back() != '\\') {
+			m_baseDir.push_back(static_cast<char>(std::filesystem::path::preferred_separator));
+		}
+	}
+
+	/**
+	 * @brief 批量解析 Maven 坐标对应的路径
+	 * @param baseDir 基础目录
+	 * @param coordinates 坐标字符串列表
+	 * @return 与坐标一一对应的路径缓冲区
+	 */
+	LibraryPathArena LibraryPathArena::Resolve(std::string baseDir, std::span<const std::string_view> coordinates) {
+		LibraryPathArena arena(std::move(baseDir));
+
+		// 第一遍：解析坐标并计算总长度
+		std::vector<std::optional<MavenCoordinate>> parsed;
+		parsed.reserve(coordinates.size());
+		size_t relativeBytes = 0;
+		for (auto name : coordinates) {
+			parsed.push_back(MavenCoordinate::Parse(name));
+			if (parsed.back()) relativeBytes += parsed.back()->GetPathLength();
+		}
+		arena.Reserve(coordinates.size(), relativeBytes);
+
+		// 第二遍：写入缓冲区
+		for (const auto &coordinate : parsed) {
+			if (coordinate) {
+				arena.AddCoordinate(*coordinate);
+			} else {
+				arena.m_spans.emplace_back(static_cast<uint32_t>(arena.m_buffer.size()), 0);
+			}
+		}
+		return arena;
+	}
+
+	/**
+	 * @brief 预留空间
+	 * @param count 路径数量
+	 * @param relativeBytes 相对路径的总字节数
+	 */
+	void LibraryPathArena::Reserve(size_t count, size_t relativeBytes) {
+		m_spans.reserve(m_spans.size() + count);
+		m_buffer.reserve(m_buffer.size() + count * m_baseDir.size() + relativeBytes);
+	}
+
+	/**
+	 * @brief 写入基础目录，返回该路径的起始偏移
+	 */
+	size_t LibraryPathArena::BeginPath() {
+		size_t offset = m_buffer.size();
+		m_buffer.append(m_baseDir);
+		return offset;
+	}
+
+	/**
+	 * @brief 添加一条已知的相对路径
+	 * @param relative 相对路径
+	 * @return 路径下标
+	 */
+	size_t LibraryPathArena::AddPath(std::string_view relative) {
+		size_t offset = BeginPath();
+		m_buffer.append(relative);
+		m_spans.emplace_back(static_cast<uint32_t>(offset), static_cast<uint32_t>(m_buffer.size() - offset));
+		return m_spans.size() - 1;
+	}
+
+	/**
+	 * @brief 添加一个 Maven 坐标对应的路径
+	 * @param coordinate Maven 坐标
+	 * @return 路径下标
+	 */
+	size_t LibraryPathArena::AddCoordinate(const MavenCoordinate &coordinate) {
+		size_t offset = BeginPath();
+		coordinate.AppendPath(m_buffer);
+		m_spans.emplace_back(static_cast<uint32_t>(offset), static_cast<uint32_t>(m_buffer.size() - offset));
+		return m_spans.size() - 1;
+	}
+}
@@ -0,0 +1,130 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace PCL_CPP::Core::Launcher::Version {
+	/**
+	 * @brief Maven 坐标
+	 *
+	 * @details
+	 * 解析 `group:artifact:version[:classifier][@ext]` 形式的坐标（Forge / NeoForge 的库常带有分类器与 `@zip` 等扩展名）。
+	 * 各字段均为指向原字符串的 `std::string_view`，解析过程不分配堆内存；使用期间需保证原字符串存活。
+	 */
+	struct MavenCoordinate {
+		std::string_view Group;             ///< 组 ID（以 . 分隔）
+		std::string_view Artifact;          ///< 构件 ID
+		std::string_view Version;           ///< 版本号
+		std::string_view Classifier;        ///< 分类器，未声明时为空
+		std::string_view Extension = "jar"; ///< 扩展名，未声明时为 jar
+
+		/**
+		 * @brief 解析 Maven 坐标
+		 * @param name 坐标字符串
+		 * @return 解析结果；段数不是 3 或 4、或 group / artifact / version 为空时返回 std::nullopt
+		 */
+		static std::optional<MavenCoordinate> Parse(std::string_view name) noexcept;
+
+		/**
+		 * @brief 计算相对路径的长度
+		 * @return `GetPath` 结果的字符数
+		 */
+		size_t GetPathLength() const noexcept;
+
+		/**
+		 * @brief 将相对路径追加到字符串末尾
+		 * @details 路径形如 `com/google/guava/guava/31.0/guava-31.0[-classifier].jar`，统一使用 `/` 分隔。
+		 * @param out 输出字符串
+		 */
+		void AppendPath(std::string &out) const;
+
+		/**
+		 * @brief 获取相对路径
+		 */
+		std::string GetPath() const;
+
+		bool operator==(const MavenCoordinate &) const = default;
+	};
+
+	/**
+	 * @brief 依赖库路径缓冲区
+	 *
+	 * @details
+	 * 将一批依赖库的完整路径（基础目录 + 相对路径）连续写入同一块内存，每条路径只记录偏移与长度：
+	 * 已知数量时可通过 `Reserve` 或 `Resolve` 一次性分配，批量解析 400 个库只需两次分配。
+	 * 通过下标获取的 `std::string_view` 在下一次添加路径之前有效。
+	 */
+	class LibraryPathArena {
+		public:
+		/**
+		 * @brief 构造函数
+		 * @param baseDir 基础目录（如 .minecraft/libraries），为空时只保存相对路径
+		 */
+		explicit LibraryPathArena(std::string baseDir = {});
+
+		/**
+		 * @brief 批量解析 Maven 坐标对应的路径
+		 * @details 先计算总长度并一次性分配，无法解析的坐标对应空路径。
+		 * @param baseDir 基础目录
+		 * @param coordinates 坐标字符串列表
+		 * @return 与坐标一一对应的路径缓冲区
+		 */
+		static LibraryPathArena Resolve(std::string baseDir, std::span<const std::string_view> coordinates);
+
+		/**
+		 * @brief 预留空间
+		 * @param count 路径数量
+		 * @param relativeBytes 相对路径的总字节数
+		 */
+		void Reserve(size_t count, size_t relativeBytes);
+
+		/**
+		 * @brief 添加一条已知的相对路径
+		 * @param relative 相对路径
+		 * @return 路径下标
+		 */
+		size_t AddPath(std::string_view relative);
+
+		/**
+		 * @brief 添加一个 Maven 坐标对应的路径
+		 * @param coordinate Maven 坐标
+		 * @return 路径下标
+		 */
+		size_t AddCoordinate(const MavenCoordinate &coordinate);
+
+		/**
+		 * @brief 获取路径
+		 * @param index 路径下标
+		 * @return 完整路径
+		 */
+		std::string_view operator[](size_t index) const {
+			const auto &[offset, length] = m_spans[index];
+			return std::string_view(m_buffer).substr(offset, length);
+		}
+
+		/**
+		 * @brief 获取路径数量
+		 */
+		size_t Size() const { return m_spans.size(); }
+
+		/**
+		 * @brief 获取所有路径的总字节数
+		 */
+		size_t Bytes() const { return m_buffer.size(); }
+
+		private:
+		/**
+		 * @brief 写入基础目录及分隔符，返回该路径的起始偏移
+		 */
+		size_t BeginPath();
+
+		std::string m_baseDir;
+		std::string m_buffer;
+		std::vector<std::pair<uint32_t, uint32_t>> m_spans; ///< 各路径的 (偏移, 长度)
+	};
+}
@@ -0,0 +1,336 @@
+#include "pch.h"
+#include "App/Logging/AppLogger.h"
+#include "MultiRootCatalog.h"
+#include "VersionIndex.h"
+#include "Utils/Hashing/HashUtils.h"
+#include "Utils/IO/FileStamp.h"
+#include "Utils/IO/MappedFile.h"
+#include "Utils/Threading/Parallel.h"
+#include <algorithm>
+#include <optional>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+
+using namespace PCL_CPP::Core::Logging;
+using namespace PCL_CPP::Core::Utils;
+
+namespace PCL_CPP::Core::Launcher::Version {
+
+	/**
+	 * @brief 逐字节比较两个文件的内容
+	 * @param a 第一个文件
+	 * @param b 第二个文件
+	 * @return 两个文件均可读取且内容完全相同时返回 true
+	 */
+	static bool HasSameContent(const std::filesystem::path &a, const std::filesystem::path &b) {
+		MappedFile first, second;
+		if (!first.Open(a) || !second.Open(b)) return false;
+		return first.View() == second.View();
+	}
+
+	/**
+	 * @brief 构造函数
+	 * @param versionRoots 各 .minecraft/versions 目录路径
+	 */
+	MultiRootCatalog::MultiRootCatalog(std::vector<std::filesystem::path> versionRoots)
+		: m_roots(std::move(versionRoots)) { }
+
+	/**
+	 * @brief 扫描所有根目录并重建目录
+	 * @param maxWorkers 最大工作线程数，为 0 时使用硬件并发数
+	 */
+	void MultiRootCatalog::Scan(size_t maxWorkers) {
+		m_versions.clear();
+		m_lookup.clear();
+		m_stats = {};
+
+		// 第一步：收集所有根目录下的候选版本目录，每个根目录各自加载索引
+		struct Slot {
+			size_t RootIndex = 0;
+			std::string DirName;
+			std::filesystem::path JsonPath;
+			std::optional<FileStamp> Stamp;
+			uint64_t ContentHash = 0;
+			size_t Variant = 0; ///< 内容哈希相同但内容不同时的区分序号
+			bool IsStale = false;
+		};
+		std::vector<Slot> slots;
+		std::vector<std::unique_ptr<VersionIndex>> indexes;
+
+		for (size_t r = 0; r < m_roots.size(); r++) {
+			indexes.push_back(std::make_unique<VersionIndex>(m_roots[r]));
+			indexes.back()->Load();
+
+			std::vector<std::string> dirNames;
+			std::error_code ec;
+			for (const auto &entry : std::filesystem::directory_iterator(m_roots[r], ec)) {
+				if (entry.is_directory(ec)) dirNames.push_back(entry.path().filename().string());
+			}
+			if (ec) {
+				LOG_WARNING("Versions root not found: {}", m_roots[r].string());
+				continue;
+			}
+			std::sort(dirNames.begin(), dirNames.end());
+
+			for (auto &dirName : dirNames) {
+				Slot slot;
+				slot.RootIndex = r;
+				slot.JsonPath = m_roots[r] / dirName / (dirName + ".json");
+				slot.DirName = std::move(dirName);
+				slots.push_back(std::move(slot));
+			}
+		}
+
+		// 第二步：并行获取所有文件的内容哈希，签名未变化时直接使用索引中的哈希
+		Parallel::For(slots.size(), maxWorkers, [&](size_t i) {
+			Slot &slot = slots[i];
+			slot.Stamp = FileStamp::Read(slot.JsonPath);
+			if (!slot.Stamp) return;
+
+			if (const auto *cached = indexes[slot.RootIndex]->Find(slot.DirName, *slot.Stamp)) {
+				slot.ContentHash = cached->ContentHash;
+				return;
+			}
+
+			MappedFile file;
+			if (!file.Open(slot.JsonPath)) {
+				slot.Stamp.reset();
+				return;
+			}
+			slot.ContentHash = HashUtils::Fnv1a64(file.View());
+			slot.IsStale = true;
+		});
+
+		// 第三步：按内容哈希分组。FNV-1a 不抵抗碰撞，因此哈希相同的文件需逐字节比对一致后才视为同一内容
+		std::unordered_map<uint64_t, std::vector<size_t>> representatives; ///< 内容哈希 -> 各个不同内容的首个槽位（下标即 Variant）
+		std::map<std::filesystem::path, size_t> byPath;                    ///< JSON 路径 -> 槽位
+		std::vector<size_t> duplicates;
+		for (size_t i = 0; i < slots.size(); i++) {
+			if (!slots[i].Stamp) continue;
+			m_stats.VersionFiles++;
+			if (slots[i].IsStale) m_stats.HashedFiles++;
+			byPath.emplace(slots[i].JsonPath, i);
+
+			auto &group = representatives[slots[i].ContentHash];
+			if (group.empty()) {
+				group.push_back(i);
+			} else {
+				duplicates.push_back(i);
+			}
+		}
+
+		std::vector<char> matchesFirst(duplicates.size());
+		Parallel::For(duplicates.size(), maxWorkers, [&](size_t k) {
+			const Slot &slot = slots[duplicates[k]];
+			matchesFirst[k] = HasSameContent(slot.JsonPath, slots[representatives.at(slot.ContentHash).front()].JsonPath);
+		});
+
+		for (size_t k = 0; k < duplicates.size(); k++) {
+			if (matchesFirst[k]) continue;
+			Slot &slot = slots[duplicates[k]];
+			auto &group = representatives[slot.ContentHash];
+			LOG_WARNING("Content hash collision between {} and {}", slot.JsonPath.string(), slots[group.front()].JsonPath.string());
+
+			size_t variant = 1;
+			while (variant < group.size() && !HasSameContent(slot.JsonPath, slots[group[variant]].JsonPath)) variant++;
+			if (variant == group.size()) group.push_back(duplicates[k]);
+			slot.Variant = variant;
+		}
+
+		// 每种内容只解析一次。上次扫描的结果仅在其来源文件本次仍属于同一内容且未变化时复用
+		std::unordered_map<uint64_t, std::vector<std::optional<VersionInfo>>> sources;
+		std::vector<std::pair<size_t, std::optional<VersionInfo> *>> toParse;
+		for (const auto &[contentHash, group] : representatives) {
+			auto &variants = sources[contentHash];
+			variants.resize(group.size());
+
+			auto previous = m_sources.find(contentHash);
+			for (size_t variant = 0; variant < group.size(); variant++) {
+				if (previous != m_sources.end()) {
+					for (auto &candidate : previous->second) {
+						if (!candidate) continue;
+						auto origin = byPath.find(candidate->JsonPath);
+						if (origin == byPath.end()) continue;
+						const Slot &originSlot = slots[origin->second];
+						if (!originSlot.IsStale && originSlot.ContentHash == contentHash && originSlot.Variant == variant) {
+							variants[variant] = std::move(candidate);
+							candidate.reset();
+							break;
+						}
+					}
+				}
+				if (!variants[variant]) toParse.emplace_back(group[variant], &variants[variant]);
+			}
+		}
+
+		Parallel::For(toParse.size(), maxWorkers, [&](size_t i) {
+			*toParse[i].second = VersionLocator::ParseVersionJson(slots[toParse[i].first].JsonPath);
+		});
+
+		m_sources = std::move(sources);
+		m_stats.ParsedFiles = toParse.size();
+
+		auto sourceOf = [&](const Slot &slot) -> const VersionInfo * {
+			auto it = m_sources.find(slot.ContentHash);
+			if (it == m_sources.end() || slot.Variant >= it->second.size() || !it->second[slot.Variant]) return nullptr;
+			return &*it->second[slot.Variant];
+		};
+		for (const auto &[contentHash, variants] : m_sources) {
+			m_stats.UniqueContents += static_cast<size_t>(std::count_if(variants.begin(), variants.end(), [](const auto &v) { return v.has_value(); }));
+		}
+
+		// 第四步：刷新各根目录的索引
+		std::vector<std::set<std::string>> existing(m_roots.size());
+		for (const auto &slot : slots) {
+			const VersionInfo *source = slot.Stamp ? sourceOf(slot) : nullptr;
+			if (!source) continue;
+			existing[slot.RootIndex].insert(slot.DirName);
+			if (!slot.IsStale) continue;
+
+			const VersionInfo &info = *source;
+			VersionIndexEntry entry;
+			entry.Stamp = *slot.Stamp;
+			entry.ContentHash = slot.ContentHash;
+			entry.Id = info.Id;
+			entry.Type = info.Type;
+			entry.InheritsFrom = info.InheritsFrom;
+			entry.Jar = info.Jar;
+			entry.MainClass = info.MainClass;
+			entry.AssetsIndex = info.AssetsIndex;
+			indexes[slot.RootIndex]->Update(slot.DirName, std::move(entry));
+		}
+		for (size_t r = 0; r < m_roots.size(); r++) {
+			indexes[r]->Retain(existing[r]);
+			indexes[r]->Save();
+		}
+
+		// 第五步：逐个根目录解析继承关系。
+		// 解析结果以“自身内容 + 父版本解析结果”为键记忆化，继承链内容相同的版本在根目录间共享同一实例。
+		using MemoKey = std::tuple<uint64_t, size_t, const VersionInfo *>; ///< (内容哈希, 区分序号, 父版本实例)
+		std::map<MemoKey, std::shared_ptr<const VersionInfo>> memo;
+
+		for (size_t r = 0; r < m_roots.size(); r++) {
+			// 版本 ID -> 槽位，同一 ID 出现多次时排序靠后的目录生效（与 GetAllVersions 一致）
+			std::map<std::string, const Slot *> byId;
+			for (const auto &slot : slots) {
+				if (slot.RootIndex != r || !slot.Stamp) continue;
+				if (const VersionInfo *source = sourceOf(slot)) byId[source->Id] = &slot;
+			}
+
+			std::map<std::string, std::shared_ptr<const VersionInfo>> resolved;
+			for (const auto &[startId, startSlot] : byId) {
+				if (resolved.contains(startId)) continue;
+
+				// 沿继承链向上回溯，收集尚未解析的版本
+				std::vector<std::string> chain;
+				std::set<std::string> onChain;
+				std::string currentId = startId;
+				while (!resolved.contains(currentId)) {
+					auto it = byId.find(currentId);
+					if (it == byId.end()) break;
+					if (onChain.contains(currentId)) {
+						LOG_ERROR("Circular inheritance detected: {} in chain", currentId);
+						break;
+					}
+					chain.push_back(currentId);
+					onChain.insert(currentId);
+
+					const VersionInfo &source = *sourceOf(*it->second);
+					if (!source.IsInherited()) break;
+					currentId = source.InheritsFrom;
+				}
+
+				// 从祖先到子孙依次解析，优先复用其他根目录中已解析的相同继承链
+				for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+					const Slot &slot = *byId.at(*it);
+					const VersionInfo &source = *sourceOf(slot);
+
+					std::shared_ptr<const VersionInfo> parent;
+					if (source.IsInherited()) {
+						auto parentIt = resolved.find(source.InheritsFrom);
+						if (parentIt != resolved.end()) parent = parentIt->second;
+					}
+
+					std::shared_ptr<const VersionInfo> version;
+					MemoKey key { slot.ContentHash, slot.Variant, parent.get() };
+					auto memoIt = memo.find(key);
+					if (memoIt != memo.end()) {
+						version = memoIt->second;
+					} else {
+						VersionInfo info = source;
+						if (parent) {
+							info.Parent = parent;
+							if (info.Jar.empty()) info.Jar = parent->Jar;
+							if (info.MainClass.empty()) info.MainClass = parent->MainClass;
+							if (info.AssetsIndex.empty()) info.AssetsIndex = parent->AssetsIndex;
+						} else if (source.IsInherited() && !byId.contains(source.InheritsFrom)) {
+							LOG_WARNING("Version {} inherits from {}, but parent not found in context.", source.Id, source.InheritsFrom);
+						}
+						info.IsResolved = true;
+
+						version = std::make_shared<const VersionInfo>(std::move(info));
+						memo.emplace(key, version);
+					}
+					resolved.emplace(*it, std::move(version));
+				}
+			}
+
+			for (auto &[id, shared] : resolved) {
+				// 每个根目录持有自己的轻量实例：路径指向本根目录，RawData 为空，通过 Parent 叠加在共享实例之上
+				auto local = std::make_shared<VersionInfo>();
+				local->Id = shared->Id;
+				local->Type = shared->Type;
+				local->InheritsFrom = shared->InheritsFrom;
+				local->Jar = shared->Jar;
+				local->MainClass = shared->MainClass;
+				local->AssetsIndex = shared->AssetsIndex;
+				local->JsonPath = byId.at(id)->JsonPath;
+				local->RootPath = local->JsonPath.parent_path();
+				local->RawData = nlohmann::json::object();
+				local->ContentHash = shared->ContentHash;
+				local->Parent = shared;
+				local->IsResolved = true;
+
+				RootedVersion version;
+				version.RootIndex = r;
+				version.Root = m_roots[r];
+				version.Id = id;
+				version.JsonPath = local->JsonPath;
+				version.Version = std::move(local);
+				version.Shared = std::move(shared);
+
+				m_lookup.emplace(std::make_pair(r, id), m_versions.size());
+				m_versions.push_back(std::move(version));
+			}
+		}
+		m_stats.UniqueVersions = memo.size();
+
+		LOG_INFO("Scanned {} version files across {} roots: {} unique contents, {} unique versions.",
+				 m_stats.VersionFiles, m_roots.size(), m_stats.UniqueContents, m_stats.UniqueVersions);
+	}
+
+	/**
+	 * @brief 获取指定根目录下的所有版本
+	 * @param rootIndex 根目录下标
+	 * @return 版本列表
+	 */
+	std::vector<RootedVersion> MultiRootCatalog::GetVersions(size_t rootIndex) const {
+		std::vector<RootedVersion> result;
+		for (const auto &version : m_versions) {
+			if (version.RootIndex == rootIndex) result.push_back(version);
+		}
+		return result;
+	}
+
+	/**
+	 * @brief 查找指定根目录下的版本
+	 * @param rootIndex 根目录下标
+	 * @param id 版本 ID
+	 * @return 找到时返回版本，否则返回 nullptr
+	 */
+	const RootedVersion *MultiRootCatalog::Find(size_t rootIndex, const std::string &id) const {
+		auto it = m_lookup.find({ rootIndex, id });
+		return it != m_lookup.end() ? &m_versions[it->second] : nullptr;
+	}
+}
@@ -0,0 +1,103 @@
+#pragma once
+#include "VersionLocator.h"
+#include <cstddef>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace PCL_CPP::Core::Launcher::Version {
+	/**
+	 * @brief 带有所属根目录的版本
+	 */
+	struct RootedVersion {
+		size_t RootIndex = 0;                       ///< 所属根目录在构造参数中的下标
+		std::filesystem::path Root;                 ///< 所属 versions 目录
+		std::string Id;                             ///< 版本 ID
+		std::filesystem::path JsonPath;             ///< 该根目录下的版本 JSON 路径
+		std::shared_ptr<const VersionInfo> Version; ///< 该根目录专属的版本实例（RootPath / JsonPath 指向本根目录，内容通过 Parent 叠加在 Shared 之上）
+		std::shared_ptr<const VersionInfo> Shared;  ///< 已解析的版本内容（继承链内容相同的版本在各根目录间共享同一实例）
+	};
+
+	/**
+	 * @brief 多根目录版本目录
+	 *
+	 * @details
+	 * 同时管理多个 .minecraft/versions 目录，并按内容对版本 JSON 去重：
+	 * 1. **并发扫描**：所有根目录下的版本 JSON 作为同一批任务并行处理。
+	 * 2. **内容去重**：每个文件只计算内容哈希（未变化的文件直接取自各根目录的 `VersionIndex`），
+	 *    哈希相同的文件再逐字节比对确认，相同内容只解析一次，且解析结果保留到下次扫描。
+	 * 3. **继承去重**：继承链内容完全相同的版本（例如各团队目录中的同一原版与加载器）只解析一次继承关系，
+	 *    各根目录共享同一个 `VersionInfo` 实例，内存与耗时随唯一内容增长，而不是随根目录数量增长。
+	 * 4. **统一视图**：以 (根目录, 版本 ID) 限定每个版本。
+	 *
+	 * 共享的 `RootedVersion::Shared` 中的 `RootPath` / `JsonPath` 指向首个出现该内容的根目录；
+	 * `RootedVersion::Version` 是各根目录专属的轻量实例（不复制 JSON），其路径指向本根目录，可直接用于启动规划。
+	 */
+	class MultiRootCatalog {
+		public:
+		/**
+		 * @brief 扫描统计
+		 */
+		struct ScanStats {
+			size_t VersionFiles = 0;     ///< 扫描到的版本 JSON 数量
+			size_t HashedFiles = 0;      ///< 因索引失效而读取内容计算哈希的文件数量
+			size_t UniqueContents = 0;   ///< 不同内容的版本 JSON 数量
+			size_t ParsedFiles = 0;      ///< 实际解析的 JSON 数量（上次扫描已解析过的内容不再解析）
+			size_t UniqueVersions = 0;   ///< 解析继承关系后不同的版本实例数量
+		};
+
+		/**
+		 * @brief 构造函数
+		 * @param versionRoots 各 .minecraft/versions 目录路径
+		 */
+		explicit MultiRootCatalog(std::vector<std::filesystem::path> versionRoots);
+
+		/**
+		 * @brief 扫描所有根目录并重建目录
+		 * @param maxWorkers 最大工作线程数，为 0 时使用硬件并发数
+		 */
+		void Scan(size_t maxWorkers = 0);
+
+		/**
+		 * @brief 获取所有根目录
+		 */
+		const std::vector<std::filesystem::path> &GetRoots() const { return m_roots; }
+
+		/**
+		 * @brief 获取所有版本（按根目录顺序、再按版本 ID 排序）
+		 */
+		const std::vector<RootedVersion> &GetVersions() const { return m_versions; }
+
+		/**
+		 * @brief 获取指定根目录下的所有版本
+		 * @param rootIndex 根目录下标
+		 * @return 版本列表
+		 */
+		std::vector<RootedVersion> GetVersions(size_t rootIndex) const;
+
+		/**
+		 * @brief 查找指定根目录下的版本
+		 * @param rootIndex 根目录下标
+		 * @param id 版本 ID
+		 * @return 找到时返回版本，否则返回 nullptr
+		 */
+		const RootedVersion *Find(size_t rootIndex, const std::string &id) const;
+
+		/**
+		 * @brief 获取最近一次扫描的统计
+		 */
+		const ScanStats &GetStats() const { return m_stats; }
+
+		private:
+		std::vector<std::filesystem::path> m_roots;
+		std::vector<RootedVersion> m_versions;
+		std::map<std::pair<size_t, std::string>, size_t> m_lookup; ///< (根目录下标, 版本 ID) -> m_versions 下标
+		std::unordered_map<uint64_t, std::vector<std::optional<VersionInfo>>> m_sources; ///< 内容哈希 -> 逐字节不同的各内容（下标即区分序号），解析失败时为空
+		ScanStats m_stats;
+	};
+}
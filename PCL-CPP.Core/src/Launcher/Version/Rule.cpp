@@ -72,6 +72,20 @@ namespace PCL_CPP::Core::Launcher::Version {
         return ver;
     }
 
+	/**
+	 * @brief 获取当前系统的目标环境
+	 * @param features 启用的功能开关
+	 * @return 当前系统的目标环境
+	 */
+	TargetEnvironment TargetEnvironment::Current(const std::map<std::string, bool> &features) {
+		TargetEnvironment target;
+		target.OsName = "windows"; // 本项目仅支持在 Windows 上运行
+		target.OsVersion = SystemInfo::GetOsVersion();
+		target.OsArch = SystemInfo::GetArch();
+		target.Features = features;
+		return target;
+	}
+
 	/**
 	 * @brief 从 JSON 对象解析规则
 	 * @param j JSON 数据
@@ -110,19 +124,40 @@ namespace PCL_CPP::Core::Launcher::Version {
 	 * @return 如果匹配则返回 true
 	 */
     bool Rule::IsMatch(const std::map<std::string, bool>& currentFeatures) const {
-        // 如果指定了系统名称且不是 Windows，则不匹配（本项目仅支持 Windows）
-        if (OsName.has_value() && OsName.value() != "windows") return false;
+        return IsMatch("windows", SystemInfo::GetOsVersion(), SystemInfo::GetArch(), currentFeatures);
+    }
+
+	/**
+	 * @brief 判断该规则是否匹配目标环境
+	 * @param target 目标环境
+	 * @return 如果匹配则返回 true
+	 */
+    bool Rule::IsMatch(const TargetEnvironment& target) const {
+        return IsMatch(target.OsName, target.OsVersion, target.OsArch, target.Features);
+    }
+
+	/**
+	 * @brief 按给定的系统信息与功能开关匹配规则
+	 * @param osName 操作系统名称
+	 * @param osVersion 操作系统版本
+	 * @param osArch 系统架构
+	 * @param currentFeatures 启用的功能开关
+	 * @return 如果匹配则返回 true
+	 */
+    bool Rule::IsMatch(std::string_view osName, const std::string& osVersion, std::string_view osArch, const std::map<std::string, bool>& currentFeatures) const {
+        // 检查系统名称是否匹配
+        if (OsName.has_value() && OsName.value() != osName) return false;
 
         // 检查架构是否匹配
         if (OsArch.has_value()) {
-            if (OsArch.value() != SystemInfo::GetArch()) return false;
+            if (OsArch.value() != osArch) return false;
         }
 
         // 检查操作系统版本（支持正则表达式）
         if (OsVersion.has_value()) {
             try {
                 std::regex re(OsVersion.value());
-                if (!std::regex_search(SystemInfo::GetOsVersion(), re)) return false;
+                if (!std::regex_search(osVersion, re)) return false;
             }
             catch (...) {
                 LOG_WARNING("Invalid regex in rule: {}", OsVersion.value());
@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include <string_view>
 #include <map>
 #include <optional>
 #include <regex>
@@ -27,6 +28,34 @@ namespace PCL_CPP::Core::Launcher::Version {
         static const std::string& GetOsVersion();
     };
 
+	/**
+	 * @brief 规划目标环境
+	 * 
+	 * @details 
+	 * 描述启动计划所面向的系统，规则匹配、Native 库选择与 Classpath 分隔符均以此为准，
+	 * 因此可以在任意主机上为其他系统或架构生成启动计划。
+	 * 名称与架构取值与版本 JSON 一致：系统为 `windows` / `linux` / `osx`，架构为 `x86` / `x64` / `arm64`。
+	 */
+	struct TargetEnvironment {
+		std::string OsName = "windows";       ///< 操作系统名称
+		std::string OsVersion;                ///< 操作系统版本（用于匹配规则中的版本正则）
+		std::string OsArch = "x64";           ///< 系统架构
+		std::map<std::string, bool> Features; ///< 启用的功能开关
+
+		/**
+		 * @brief 获取当前系统的目标环境
+		 * @param features 启用的功能开关
+		 * @return 当前系统的目标环境
+		 */
+		static TargetEnvironment Current(const std::map<std::string, bool> &features = {});
+
+		/**
+		 * @brief 获取目标系统的 Classpath 分隔符
+		 * @return Windows 为 ";"，其他系统为 ":"
+		 */
+		std::string_view ClasspathSeparator() const { return OsName == "windows" ? ";" : ":"; }
+	};
+
 	/**
 	 * @brief 规则类，用于判断库或参数在当前环境下是否适用。
 	 */
@@ -63,5 +92,18 @@ namespace PCL_CPP::Core::Launcher::Version {
 		 * @return 如果匹配则返回 true
 		 */
 		bool IsMatch(const std::map<std::string, bool> &features = {}) const;
+
+		/**
+		 * @brief 判断该规则是否匹配目标环境
+		 * @param target 目标环境
+		 * @return 如果匹配则返回 true
+		 */
+		bool IsMatch(const TargetEnvironment &target) const;
+
+		private:
+		/**
+		 * @brief 按给定的系统信息与功能开关匹配规则
+		 */
+		bool IsMatch(std::string_view osName, const std::string &osVersion, std::string_view osArch, const std::map<std::string, bool> &features) const;
 	};
 }
@@ -0,0 +1,190 @@
+#include "pch.h"
+#include "App/Logging/AppLogger.h"
+#include "RuleEngine.h"
+#include <deque>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+
+using namespace PCL_CPP::Core::Logging;
+using namespace PCL_CPP::Core::Utils;
+
+namespace PCL_CPP::Core::Launcher::Version {
+
+	/**
+	 * @brief 获取功能开关对应的位
+	 * @param name 功能开关名称
+	 * @return 对应的位掩码（只有一位为 1），注册表已满时返回 0
+	 */
+	FeatureMask FeatureRegistry::Bit(InternedString name) {
+		static std::mutex mutex;
+		static std::unordered_map<InternedString, FeatureMask, InternedString::Hash> bits;
+
+		std::lock_guard lock(mutex);
+		auto it = bits.find(name);
+		if (it != bits.end()) return it->second;
+
+		if (bits.size() >= Capacity) {
+			LOG_WARNING("Too many distinct rule features, ignoring: {}", name.View());
+			return 0;
+		}
+		FeatureMask bit = FeatureMask(1) << bits.size();
+		bits.emplace(name, bit);
+		return bit;
+	}
+
+	/**
+	 * @brief 将功能开关表转换为位掩码
+	 * @param features 功能开关表
+	 * @return 所有值为 true 的功能开关组成的位掩码
+	 */
+	FeatureMask FeatureRegistry::ToMask(const std::map<std::string, bool> &features) {
+		FeatureMask mask = 0;
+		for (const auto &[key, value] : features) {
+			if (value) mask |= Bit(StringPool::Global().Intern(key));
+		}
+		return mask;
+	}
+
+	/**
+	 * @brief 获取与规则中操作系统条件对应的共享实例
+	 * @param rule 规则
+	 * @return 共享的条件实例，规则没有操作系统条件时返回 nullptr
+	 */
+	const OsCondition *OsCondition::Get(const Rule &rule) {
+		if (!rule.OsName && !rule.OsArch && !rule.OsVersion) return nullptr;
+
+		static std::mutex mutex;
+		static std::deque<OsCondition> conditions;
+		static std::map<std::tuple<int64_t, int64_t, int64_t>, const OsCondition *> lookup;
+
+		auto &pool = StringPool::Global();
+		auto intern = [&](const std::optional<std::string> &value) -> std::optional<InternedString> {
+			if (!value) return std::nullopt;
+			return pool.Intern(*value);
+		};
+		auto idOf = [](const std::optional<InternedString> &value) -> int64_t {
+			return value ? value->Id() : -1;
+		};
+
+		auto name = intern(rule.OsName);
+		auto arch = intern(rule.OsArch);
+		auto version = intern(rule.OsVersion);
+		auto key = std::make_tuple(idOf(name), idOf(arch), idOf(version));
+
+		std::lock_guard lock(mutex);
+		auto it = lookup.find(key);
+		if (it != lookup.end()) return it->second;
+
+		OsCondition &condition = conditions.emplace_back();
+		condition.Id = static_cast<uint32_t>(conditions.size() - 1);
+		condition.Name = name;
+		condition.Arch = arch;
+		condition.Version = version;
+		if (version) {
+			try {
+				condition.VersionRegex.emplace(version->Str());
+			}
+			catch (...) {
+				LOG_WARNING("Invalid regex in rule: {}", version->View());
+				condition.IsInvalid = true;
+			}
+		}
+
+		lookup.emplace(key, &condition);
+		return &condition;
+	}
+
+	/**
+	 * @brief 构建目标环境的快照
+	 * @param target 目标环境
+	 * @return 环境快照
+	 */
+	RuleEnvironment RuleEnvironment::From(const TargetEnvironment &target) {
+		auto &pool = StringPool::Global();
+
+		RuleEnvironment environment;
+		environment.OsName = pool.Intern(target.OsName);
+		environment.OsArch = pool.Intern(target.OsArch);
+		environment.OsVersion = target.OsVersion;
+		environment.Features = FeatureRegistry::ToMask(target.Features);
+		return environment;
+	}
+
+	/**
+	 * @brief 构建当前系统的环境快照
+	 * @param features 当前启用的功能开关
+	 * @return 环境快照
+	 */
+	RuleEnvironment RuleEnvironment::Current(const std::map<std::string, bool> &features) {
+		return From(TargetEnvironment::Current(features));
+	}
+
+	/**
+	 * @brief 判断操作系统条件是否匹配，结果按条件缓存
+	 * @param condition 操作系统条件
+	 * @return 如果匹配则返回 true
+	 */
+	bool RuleEnvironment::Matches(const OsCondition &condition) const {
+		if (condition.Id < m_osMatches.size() && m_osMatches[condition.Id] >= 0) {
+			return m_osMatches[condition.Id] != 0;
+		}
+
+		bool matched = !condition.IsInvalid;
+		if (matched && condition.Name && *condition.Name != OsName) matched = false;
+		if (matched && condition.Arch && *condition.Arch != OsArch) matched = false;
+		if (matched && condition.VersionRegex && !std::regex_search(OsVersion, *condition.VersionRegex)) matched = false;
+
+		if (condition.Id >= m_osMatches.size()) m_osMatches.resize(condition.Id + 1, -1);
+		m_osMatches[condition.Id] = matched ? 1 : 0;
+		return matched;
+	}
+
+	/**
+	 * @brief 编译规则列表
+	 * @param rules 规则列表
+	 * @return 编译后的规则列表
+	 */
+	RulePredicate RulePredicate::Compile(const std::vector<Rule> &rules) {
+		auto &pool = StringPool::Global();
+
+		RulePredicate predicate;
+		predicate.m_clauses.reserve(rules.size());
+		for (const auto &rule : rules) {
+			Clause clause;
+			clause.Allow = rule.Action == Rule::ActionType::Allow;
+			clause.Os = OsCondition::Get(rule);
+
+			for (const auto &[feature, required] : rule.Features) {
+				FeatureMask bit = FeatureRegistry::Bit(pool.Intern(feature));
+				if (bit == 0) {
+					// 无法分配位的功能开关在环境中始终视为未启用
+					if (required) clause.Never = true;
+					continue;
+				}
+				clause.Mask |= bit;
+				if (required) clause.Expected |= bit;
+			}
+			predicate.m_clauses.push_back(clause);
+		}
+		return predicate;
+	}
+
+	/**
+	 * @brief 在环境快照上求值
+	 * @param environment 环境快照
+	 * @return 如果应启用则返回 true
+	 */
+	bool RulePredicate::Evaluate(const RuleEnvironment &environment) const {
+		if (m_clauses.empty()) return true;
+
+		bool isAllowed = false;
+		for (const auto &clause : m_clauses) {
+			if (clause.Never) continue;
+			if ((environment.Features & clause.Mask) != clause.Expected) continue;
+			if (clause.Os && !environment.Matches(*clause.Os)) continue;
+			isAllowed = clause.Allow;
+		}
+		return isAllowed;
+	}
+}
@@ -0,0 +1,149 @@
+#pragma once
+#include "Rule.h"
+#include "Utils/Text/StringPool.h"
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <regex>
+#include <string>
+#include <vector>
+
+namespace PCL_CPP::Core::Launcher::Version {
+	using Utils::InternedString;
+
+	/**
+	 * @brief 功能开关位掩码，每个功能开关占一位
+	 */
+	using FeatureMask = uint64_t;
+
+	/**
+	 * @brief 功能开关注册表
+	 *
+	 * @details
+	 * 为每个出现过的功能开关名称（驻留字符串）分配一个固定的位下标，使功能开关的集合可以用一个 `FeatureMask` 表示。
+	 * 版本 JSON 中的功能开关只有十余种，注册表最多容纳 `Capacity` 个；超出部分无法分配位，视为始终未启用。
+	 */
+	class FeatureRegistry {
+		public:
+		static constexpr size_t Capacity = 64; ///< 最多可注册的功能开关数量
+
+		/**
+		 * @brief 获取功能开关对应的位
+		 * @param name 功能开关名称
+		 * @return 对应的位掩码（只有一位为 1），注册表已满时返回 0
+		 */
+		static FeatureMask Bit(InternedString name);
+
+		/**
+		 * @brief 将功能开关表转换为位掩码
+		 * @param features 功能开关表
+		 * @return 所有值为 true 的功能开关组成的位掩码
+		 */
+		static FeatureMask ToMask(const std::map<std::string, bool> &features);
+	};
+
+	/**
+	 * @brief 规则中的操作系统条件
+	 *
+	 * @details
+	 * 内容相同的条件（名称、版本正则、架构）全局只保存一份，版本正则在创建时编译一次。
+	 * 每个条件拥有连续分配的 `Id`，供环境快照缓存匹配结果。
+	 */
+	struct OsCondition {
+		uint32_t Id = 0;                         ///< 条件编号
+		std::optional<InternedString> Name;      ///< 操作系统名称
+		std::optional<InternedString> Arch;      ///< 系统架构
+		std::optional<InternedString> Version;   ///< 操作系统版本正则原文
+		std::optional<std::regex> VersionRegex;  ///< 编译后的版本正则
+		bool IsInvalid = false;                  ///< 版本正则无效，条件永不匹配
+
+		/**
+		 * @brief 获取与规则中操作系统条件对应的共享实例
+		 * @param rule 规则
+		 * @return 共享的条件实例，规则没有操作系统条件时返回 nullptr
+		 */
+		static const OsCondition *Get(const Rule &rule);
+	};
+
+	/**
+	 * @brief 规则求值所用的环境快照
+	 *
+	 * @details
+	 * 在一次规划开始时构建一次：系统名称与架构驻留为句柄，功能开关转换为位掩码。
+	 * 每个操作系统条件在同一快照上只会真正匹配一次，结果缓存在快照中。
+	 * 由于缓存的存在，同一个快照不应被多个线程同时使用；快照的构建代价很小，每个线程可各自构建。
+	 */
+	class RuleEnvironment {
+		public:
+		InternedString OsName;    ///< 操作系统名称
+		InternedString OsArch;    ///< 系统架构
+		std::string OsVersion;    ///< 操作系统版本
+		FeatureMask Features = 0; ///< 已启用的功能开关
+
+		/**
+		 * @brief 构建目标环境的快照
+		 * @param target 目标环境
+		 * @return 环境快照
+		 */
+		static RuleEnvironment From(const TargetEnvironment &target);
+
+		/**
+		 * @brief 构建当前系统的环境快照
+		 * @param features 当前启用的功能开关
+		 * @return 环境快照
+		 */
+		static RuleEnvironment Current(const std::map<std::string, bool> &features = {});
+
+		/**
+		 * @brief 判断操作系统条件是否匹配，结果按条件缓存
+		 * @param condition 操作系统条件
+		 * @return 如果匹配则返回 true
+		 */
+		bool Matches(const OsCondition &condition) const;
+
+		private:
+		mutable std::vector<int8_t> m_osMatches; ///< 条件编号 -> 匹配结果（-1 表示尚未计算）
+	};
+
+	/**
+	 * @brief 编译后的规则列表
+	 *
+	 * @details
+	 * 将 `std::vector<Rule>` 编译为紧凑的子句序列：每条子句只包含动作、共享的操作系统条件指针，
+	 * 以及功能开关的掩码与期望值，求值时功能开关判断只需一次位运算。
+	 * 语义与逐条调用 `Rule::IsMatch` 完全一致：没有规则时总是启用，否则以最后一条匹配规则的动作为准。
+	 */
+	class RulePredicate {
+		public:
+		/**
+		 * @brief 编译规则列表
+		 * @param rules 规则列表
+		 * @return 编译后的规则列表
+		 */
+		static RulePredicate Compile(const std::vector<Rule> &rules);
+
+		/**
+		 * @brief 在环境快照上求值
+		 * @param environment 环境快照
+		 * @return 如果应启用则返回 true
+		 */
+		bool Evaluate(const RuleEnvironment &environment) const;
+
+		/**
+		 * @brief 获取编译时的规则数量
+		 */
+		size_t RuleCount() const { return m_clauses.size(); }
+
+		private:
+		struct Clause {
+			bool Allow = true;                     ///< 规则动作
+			bool Never = false;                    ///< 要求了无法分配位的功能开关，永不匹配
+			const OsCondition *Os = nullptr;       ///< 操作系统条件
+			FeatureMask Mask = 0;                  ///< 规则涉及的功能开关
+			FeatureMask Expected = 0;              ///< 规则要求的功能开关值
+		};
+
+		std::vector<Clause> m_clauses;
+	};
+}
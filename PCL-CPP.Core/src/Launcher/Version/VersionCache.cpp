@@ -0,0 +1,150 @@
+#include "pch.h"
+#include "VersionCache.h"
+#include <algorithm>
+
+using namespace PCL_CPP::Core::Utils;
+
+namespace PCL_CPP::Core::Launcher::Version {
+
+	/**
+	 * @brief 构造函数
+	 * @param capacity 最大条目数
+	 */
+	VersionCache::VersionCache(size_t capacity)
+		: m_capacity(capacity) { }
+
+	/**
+	 * @brief 生成缓存键
+	 * @param versionsRoot 版本根目录
+	 * @param id 版本 ID
+	 * @return 缓存键
+	 */
+	std::string VersionCache::MakeKey(const std::filesystem::path &versionsRoot, const std::string &id) {
+		return versionsRoot.lexically_normal().generic_string() + '\n' + id;
+	}
+
+	/**
+	 * @brief 查找并校验缓存条目
+	 * @param versionsRoot 版本根目录
+	 * @param id 版本 ID
+	 * @return 命中时返回缓存的版本信息，否则返回 nullptr
+	 */
+	std::shared_ptr<const VersionInfo> VersionCache::Find(const std::filesystem::path &versionsRoot, const std::string &id) {
+		std::lock_guard lock(m_mutex);
+
+		auto it = m_lookup.find(MakeKey(versionsRoot, id));
+		if (it == m_lookup.end()) {
+			m_misses++;
+			return nullptr;
+		}
+
+		// 逐一校验继承链上的文件签名
+		auto entry = it->second;
+		for (const auto &file : entry->Chain) {
+			if (FileStamp::Read(file.Path) != file.Stamp) {
+				m_lookup.erase(it);
+				m_entries.erase(entry);
+				m_misses++;
+				return nullptr;
+			}
+		}
+
+		m_entries.splice(m_entries.begin(), m_entries, entry);
+		m_hits++;
+		return entry->Info;
+	}
+
+	/**
+	 * @brief 写入缓存条目
+	 * @param versionsRoot 版本根目录
+	 * @param id 版本 ID
+	 * @param info 已解析的版本信息
+	 * @param chain 从目标版本到最顶层祖先的 JSON 文件及其签名
+	 */
+	void VersionCache::Put(const std::filesystem::path &versionsRoot, const std::string &id, std::shared_ptr<const VersionInfo> info, std::vector<ChainFile> chain) {
+		std::lock_guard lock(m_mutex);
+		if (m_capacity == 0) return;
+
+		std::string key = MakeKey(versionsRoot, id);
+		auto it = m_lookup.find(key);
+		if (it != m_lookup.end()) {
+			m_entries.erase(it->second);
+			m_lookup.erase(it);
+		}
+
+		m_entries.push_front({ key, std::move(info), std::move(chain) });
+		m_lookup.emplace(std::move(key), m_entries.begin());
+		EvictLocked();
+	}
+
+	/**
+	 * @brief 移除继承链中包含指定文件的所有条目
+	 * @param jsonPath 版本 JSON 文件路径
+	 * @return 移除的条目数
+	 */
+	size_t VersionCache::Invalidate(const std::filesystem::path &jsonPath) {
+		std::lock_guard lock(m_mutex);
+
+		auto target = jsonPath.lexically_normal();
+		size_t removed = 0;
+		for (auto it = m_entries.begin(); it != m_entries.end();) {
+			bool dependent = std::any_of(it->Chain.begin(), it->Chain.end(), [&](const ChainFile &file) {
+				return file.Path.lexically_normal() == target;
+			});
+			if (dependent) {
+				m_lookup.erase(it->Key);
+				it = m_entries.erase(it);
+				removed++;
+			} else {
+				++it;
+			}
+		}
+		return removed;
+	}
+
+	/**
+	 * @brief 清空缓存并重置统计
+	 */
+	void VersionCache::Clear() {
+		std::lock_guard lock(m_mutex);
+		m_entries.clear();
+		m_lookup.clear();
+		m_hits = 0;
+		m_misses = 0;
+	}
+
+	/**
+	 * @brief 设置容量，必要时立即淘汰多余条目
+	 * @param capacity 最大条目数，为 0 时禁用缓存
+	 */
+	void VersionCache::SetCapacity(size_t capacity) {
+		std::lock_guard lock(m_mutex);
+		m_capacity = capacity;
+		EvictLocked();
+	}
+
+	/**
+	 * @brief 淘汰超出容量的最久未使用条目，调用方需持有锁
+	 */
+	void VersionCache::EvictLocked() {
+		while (m_entries.size() > m_capacity) {
+			m_lookup.erase(m_entries.back().Key);
+			m_entries.pop_back();
+		}
+	}
+
+	size_t VersionCache::Size() const {
+		std::lock_guard lock(m_mutex);
+		return m_entries.size();
+	}
+
+	uint64_t VersionCache::Hits() const {
+		std::lock_guard lock(m_mutex);
+		return m_hits;
+	}
+
+	uint64_t VersionCache::Misses() const {
+		std::lock_guard lock(m_mutex);
+		return m_misses;
+	}
+}
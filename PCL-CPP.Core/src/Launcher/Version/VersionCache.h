@@ -0,0 +1,100 @@
+#pragma once
+#include "VersionLocator.h"
+#include "Utils/IO/FileStamp.h"
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace PCL_CPP::Core::Launcher::Version {
+	/**
+	 * @brief 已解析版本的有界 LRU 缓存
+	 *
+	 * @details
+	 * 为 `VersionLocator::GetVersion` 提供进程内缓存：
+	 * 1. **链式校验**：每个条目记录其继承链上所有 JSON 文件（包括缺失的父版本路径）的状态签名，
+	 *    命中前逐一校验，任意一层被修改、删除或新建都会使该条目失效，而不影响继承链之外的条目。
+	 * 2. **有界淘汰**：条目数超过容量时淘汰最久未使用的条目。
+	 * 3. **线程安全**：所有方法均可并发调用。
+	 */
+	class VersionCache {
+		public:
+		static constexpr size_t DefaultCapacity = 32; ///< 默认容量
+
+		/**
+		 * @brief 继承链上的一个 JSON 文件
+		 */
+		struct ChainFile {
+			std::filesystem::path Path;             ///< JSON 文件路径
+			std::optional<Utils::FileStamp> Stamp;  ///< 加载时的状态签名，文件不存在时为空
+		};
+
+		/**
+		 * @brief 构造函数
+		 * @param capacity 最大条目数
+		 */
+		explicit VersionCache(size_t capacity = DefaultCapacity);
+
+		/**
+		 * @brief 查找并校验缓存条目
+		 * @details 继承链上任一文件的签名与记录不一致时移除该条目并返回未命中。
+		 * @param versionsRoot 版本根目录
+		 * @param id 版本 ID
+		 * @return 命中时返回缓存的版本信息，否则返回 nullptr
+		 */
+		std::shared_ptr<const VersionInfo> Find(const std::filesystem::path &versionsRoot, const std::string &id);
+
+		/**
+		 * @brief 写入缓存条目
+		 * @param versionsRoot 版本根目录
+		 * @param id 版本 ID
+		 * @param info 已解析的版本信息
+		 * @param chain 从目标版本到最顶层祖先的 JSON 文件及其签名
+		 */
+		void Put(const std::filesystem::path &versionsRoot, const std::string &id, std::shared_ptr<const VersionInfo> info, std::vector<ChainFile> chain);
+
+		/**
+		 * @brief 移除继承链中包含指定文件的所有条目
+		 * @param jsonPath 版本 JSON 文件路径
+		 * @return 移除的条目数
+		 */
+		size_t Invalidate(const std::filesystem::path &jsonPath);
+
+		/**
+		 * @brief 清空缓存并重置统计
+		 */
+		void Clear();
+
+		/**
+		 * @brief 设置容量，必要时立即淘汰多余条目
+		 * @param capacity 最大条目数，为 0 时禁用缓存
+		 */
+		void SetCapacity(size_t capacity);
+
+		size_t Size() const;      ///< 当前条目数
+		uint64_t Hits() const;    ///< 命中次数
+		uint64_t Misses() const;  ///< 未命中次数（包括校验失败）
+
+		private:
+		struct Entry {
+			std::string Key;
+			std::shared_ptr<const VersionInfo> Info;
+			std::vector<ChainFile> Chain;
+		};
+
+		static std::string MakeKey(const std::filesystem::path &versionsRoot, const std::string &id);
+		void EvictLocked();
+
+		mutable std::mutex m_mutex;
+		size_t m_capacity;
+		std::list<Entry> m_entries; ///< 按最近使用排序，表头为最近使用
+		std::unordered_map<std::string, std::list<Entry>::iterator> m_lookup;
+		uint64_t m_hits = 0;
+		uint64_t m_misses = 0;
+	};
+}
@@ -0,0 +1,379 @@
+#include "pch.h"
+#include "App/Logging/AppLogger.h"
+#include "VersionCatalog.h"
+#include "VersionIndex.h"
+#include "Utils/Threading/Parallel.h"
+#include <optional>
+
+using namespace PCL_CPP::Core::Logging;
+using namespace PCL_CPP::Core::Utils;
+
+namespace PCL_CPP::Core::Launcher::Version {
+
+	/**
+	 * @brief 构造函数
+	 * @param versionsRoot .minecraft/versions 目录路径
+	 */
+	VersionCatalog::VersionCatalog(const std::filesystem::path &versionsRoot)
+		: m_root(versionsRoot) { }
+
+	VersionCatalog::~VersionCatalog() {
+		Stop();
+	}
+
+	/**
+	 * @brief 检查整个 versions 目录并应用所有变化
+	 * @return 本轮产生的变更事件
+	 */
+	std::vector<VersionChangeEvent> VersionCatalog::Refresh() {
+		std::set<std::filesystem::path> dirNames;
+
+		std::error_code ec;
+		for (const auto &entry : std::filesystem::directory_iterator(m_root, ec)) {
+			if (entry.is_directory(ec)) dirNames.insert(entry.path().filename());
+		}
+		if (ec) {
+			LOG_WARNING("Failed to enumerate versions root {}: {}", m_root.string(), ec.message());
+		}
+
+		// 已消失的目录同样需要检查，以便产生删除事件
+		{
+			std::lock_guard lock(m_refreshMutex);
+			for (const auto &[dirName, source] : m_sources) dirNames.insert(dirName);
+		}
+
+		return Refresh(dirNames);
+	}
+
+	/**
+	 * @brief 仅检查指定的版本目录并应用其变化
+	 * @param dirNames 版本目录名集合
+	 * @return 本轮产生的变更事件
+	 */
+	std::vector<VersionChangeEvent> VersionCatalog::Refresh(const std::set<std::filesystem::path> &dirNames) {
+		std::vector<VersionChangeEvent> events;
+		{
+			std::lock_guard lock(m_refreshMutex);
+			events = Apply(dirNames);
+		}
+		if (!events.empty()) Notify(events);
+		return events;
+	}
+
+	/**
+	 * @brief 重新解析发生变化的版本，并重新解析受影响版本的继承关系
+	 * @details 调用方需持有 m_refreshMutex。
+	 * @param dirNames 待检查的版本目录名集合
+	 * @return 本轮产生的变更事件
+	 */
+	std::vector<VersionChangeEvent> VersionCatalog::Apply(const std::set<std::filesystem::path> &dirNames) {
+		// 第一步：通过文件签名筛选出需要重新解析的目录
+		struct Pending {
+			std::filesystem::path DirName;
+			std::optional<FileStamp> Stamp;
+			std::optional<VersionInfo> Info;
+		};
+		std::vector<Pending> pending;
+
+		for (const auto &dirName : dirNames) {
+			if (dirName.empty() || dirName == VersionIndex::FileName) continue;
+
+			auto stamp = FileStamp::Read(m_root / dirName / (dirName.string() + ".json"));
+			auto it = m_sources.find(dirName);
+			if (it != m_sources.end() && stamp && it->second.Stamp == *stamp) continue;
+			if (it == m_sources.end() && !stamp) continue;
+
+			pending.push_back({ dirName, stamp, std::nullopt });
+		}
+		if (pending.empty()) return {};
+
+		// 第二步：并行解析变化的 JSON（首次加载时即为全部版本）
+		Parallel::For(pending.size(), 0, [&](size_t i) {
+			auto &p = pending[i];
+			if (p.Stamp) p.Info = VersionLocator::ParseVersionJson(m_root / p.DirName / (p.DirName.string() + ".json"));
+		});
+
+		// 第三步：更新解析结果，记录内容真正发生变化的版本 ID
+		std::set<std::string> changedIds;
+		for (auto &p : pending) {
+			auto it = m_sources.find(p.DirName);
+			if (it != m_sources.end()) {
+				// 仅修改时间变化而内容不变时只更新签名
+				if (p.Info && p.Info->ContentHash == it->second.Info.ContentHash) {
+					it->second.Stamp = *p.Stamp;
+					continue;
+				}
+				changedIds.insert(it->second.Info.Id);
+				m_sources.erase(it);
+			}
+			if (p.Info) {
+				changedIds.insert(p.Info->Id);
+				m_sources.emplace(p.DirName, Source { *p.Stamp, std::move(*p.Info) });
+			}
+		}
+		if (changedIds.empty()) return {};
+
+		// 第四步：建立 ID 索引与子版本关系，找出所有受影响的子孙版本
+		std::map<std::string, const VersionInfo *> byId;
+		std::map<std::string, std::vector<std::string>> children;
+		for (const auto &[dirName, source] : m_sources) {
+			byId[source.Info.Id] = &source.Info;
+		}
+		for (const auto &[id, info] : byId) {
+			if (info->IsInherited()) children[info->InheritsFrom].push_back(id);
+		}
+
+		std::set<std::string> affected;
+		std::vector<std::string> queue(changedIds.begin(), changedIds.end());
+		while (!queue.empty()) {
+			std::string id = std::move(queue.back());
+			queue.pop_back();
+			if (!affected.insert(id).second) continue;
+
+			auto it = children.find(id);
+			if (it != children.end()) queue.insert(queue.end(), it->second.begin(), it->second.end());
+		}
+
+		// 第五步：仅重新解析受影响版本的继承关系，未受影响的版本作为已解析的父版本直接复用
+		std::map<std::string, VersionInfo> toResolve;
+		for (const auto &id : affected) {
+			auto it = byId.find(id);
+			if (it != byId.end()) toResolve.emplace(id, *it->second);
+		}
+
+		std::vector<VersionChangeEvent> events;
+		{
+			std::lock_guard lock(m_mutex);
+
+			std::set<std::string> existed;
+			for (const auto &id : affected) {
+				if (m_resolved.erase(id)) existed.insert(id);
+			}
+
+			VersionLocator::ResolveInheritance(std::move(toResolve), m_resolved);
+
+			for (const auto &id : affected) {
+				auto it = m_resolved.find(id);
+				if (it == m_resolved.end()) {
+					if (existed.contains(id)) events.push_back({ VersionChangeType::Removed, id, nullptr });
+				} else {
+					events.push_back({ existed.contains(id) ? VersionChangeType::Updated : VersionChangeType::Added, id, it->second });
+				}
+			}
+		}
+
+		LOG_INFO("Version catalog refreshed: {} changed, {} affected.", changedIds.size(), affected.size());
+		return events;
+	}
+
+	/**
+	 * @brief 将变更事件分发给所有订阅者
+	 * @param events 变更事件
+	 */
+	void VersionCatalog::Notify(const std::vector<VersionChangeEvent> &events) {
+		std::vector<ChangeListener> listeners;
+		{
+			std::lock_guard lock(m_mutex);
+			for (const auto &[token, listener] : m_listeners) listeners.push_back(listener);
+		}
+
+		for (const auto &listener : listeners) {
+			try {
+				listener(events);
+			} catch (const std::exception &e) {
+				LOG_ERROR("Version catalog listener threw: {}", e.what());
+			}
+		}
+	}
+
+	/**
+	 * @brief 启动后台监视线程
+	 * @param forcePolling 为 true 时不订阅目录通知，直接使用轮询
+	 * @param pollInterval 轮询间隔
+	 * @return 成功启动（或已在运行）时返回 true
+	 */
+	bool VersionCatalog::Start(bool forcePolling, std::chrono::milliseconds pollInterval) {
+		if (IsRunning()) return true;
+
+		m_stopEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+		if (m_stopEvent == nullptr) {
+			LOG_ERROR("Failed to create stop event for version catalog ({})", GetLastError());
+			return false;
+		}
+
+		m_forcePolling = forcePolling;
+		m_pollInterval = pollInterval;
+		m_worker = std::jthread([this](std::stop_token stopToken) {
+			if (m_forcePolling) {
+				PollLoop(stopToken);
+			} else {
+				WatchLoop(stopToken);
+			}
+		});
+		return true;
+	}
+
+	/**
+	 * @brief 停止后台监视线程并等待其退出
+	 */
+	void VersionCatalog::Stop() {
+		if (!IsRunning()) return;
+
+		m_worker.request_stop();
+		SetEvent(m_stopEvent);
+		m_worker.join();
+
+		CloseHandle(m_stopEvent);
+		m_stopEvent = nullptr;
+	}
+
+	/**
+	 * @brief 通过目录变化通知监视 versions 目录
+	 * @details 连续的通知在静默 `DebounceDelay` 后合并为一次增量更新；通知缓冲区溢出时执行一次完整检查。
+	 * @param stopToken 停止令牌
+	 */
+	void VersionCatalog::WatchLoop(std::stop_token stopToken) {
+		HANDLE dir = CreateFileW(m_root.c_str(), FILE_LIST_DIRECTORY,
+								 FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+								 nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+		if (dir == INVALID_HANDLE_VALUE) {
+			LOG_WARNING("Cannot watch {} ({}), falling back to polling.", m_root.string(), GetLastError());
+			PollLoop(stopToken);
+			return;
+		}
+
+		HANDLE ioEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+		std::vector<DWORD> buffer(16 * 1024); // 64 KB，DWORD 对齐
+		OVERLAPPED overlapped {};
+		overlapped.hEvent = ioEvent;
+
+		auto issueRead = [&]() {
+			ResetEvent(ioEvent);
+			return ReadDirectoryChangesW(dir, buffer.data(), static_cast<DWORD>(buffer.size() * sizeof(DWORD)), TRUE,
+										 FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME |
+										 FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE,
+										 nullptr, &overlapped, nullptr) != FALSE;
+		};
+
+		bool watching = ioEvent != nullptr && issueRead();
+		if (!watching) {
+			LOG_WARNING("ReadDirectoryChangesW failed on {} ({}), falling back to polling.", m_root.string(), GetLastError());
+		}
+
+		std::set<std::filesystem::path> dirty;
+		bool overflow = false;
+
+		while (watching && !stopToken.stop_requested()) {
+			DWORD timeout = (dirty.empty() && !overflow) ? INFINITE : static_cast<DWORD>(DebounceDelay.count());
+			HANDLE handles[] = { ioEvent, m_stopEvent };
+			DWORD result = WaitForMultipleObjects(2, handles, FALSE, timeout);
+
+			if (result == WAIT_OBJECT_0) {
+				DWORD bytes = 0;
+				if (!GetOverlappedResult(dir, &overlapped, &bytes, FALSE)) {
+					LOG_WARNING("Directory watch on {} failed ({}), falling back to polling.", m_root.string(), GetLastError());
+					watching = false;
+					break;
+				}
+
+				if (bytes == 0) {
+					overflow = true; // 通知过多导致缓冲区溢出，无法得知具体变化
+				} else {
+					auto *cursor = reinterpret_cast<const std::byte *>(buffer.data());
+					while (true) {
+						auto *info = reinterpret_cast<const FILE_NOTIFY_INFORMATION *>(cursor);
+						std::wstring_view name(info->FileName, info->FileNameLength / sizeof(WCHAR));
+						dirty.insert(std::filesystem::path(name.substr(0, name.find(L'\\'))));
+
+						if (info->NextEntryOffset == 0) break;
+						cursor += info->NextEntryOffset;
+					}
+				}
+
+				if (!issueRead()) {
+					LOG_WARNING("ReadDirectoryChangesW failed on {} ({}), falling back to polling.", m_root.string(), GetLastError());
+					watching = false;
+				}
+			} else if (result == WAIT_TIMEOUT) {
+				if (overflow) {
+					Refresh();
+				} else {
+					Refresh(dirty);
+				}
+				dirty.clear();
+				overflow = false;
+			} else {
+				break; // 收到停止信号或等待失败
+			}
+		}
+
+		if (ioEvent != nullptr) {
+			DWORD bytes = 0;
+			if (CancelIoEx(dir, &overlapped) || GetLastError() != ERROR_NOT_FOUND) {
+				GetOverlappedResult(dir, &overlapped, &bytes, TRUE);
+			}
+			CloseHandle(ioEvent);
+		}
+		CloseHandle(dir);
+
+		if (!watching && !stopToken.stop_requested()) {
+			Refresh(); // 补上监视失效前可能遗漏的变化
+			PollLoop(stopToken);
+		}
+	}
+
+	/**
+	 * @brief 定时轮询 versions 目录
+	 * @param stopToken 停止令牌
+	 */
+	void VersionCatalog::PollLoop(std::stop_token stopToken) {
+		while (!stopToken.stop_requested()) {
+			if (WaitForSingleObject(m_stopEvent, static_cast<DWORD>(m_pollInterval.count())) != WAIT_TIMEOUT) break;
+			Refresh();
+		}
+	}
+
+	/**
+	 * @brief 订阅版本变更事件
+	 * @param listener 回调函数
+	 * @return 用于取消订阅的标识
+	 */
+	size_t VersionCatalog::Subscribe(ChangeListener listener) {
+		std::lock_guard lock(m_mutex);
+		size_t token = m_nextToken++;
+		m_listeners.emplace(token, std::move(listener));
+		return token;
+	}
+
+	/**
+	 * @brief 取消订阅
+	 * @param token `Subscribe` 返回的标识
+	 */
+	void VersionCatalog::Unsubscribe(size_t token) {
+		std::lock_guard lock(m_mutex);
+		m_listeners.erase(token);
+	}
+
+	/**
+	 * @brief 查找指定 ID 的版本
+	 * @param id 版本 ID
+	 * @return 已解析的版本信息，不存在时返回 nullptr
+	 */
+	std::shared_ptr<const VersionInfo> VersionCatalog::Find(const std::string &id) const {
+		std::lock_guard lock(m_mutex);
+		auto it = m_resolved.find(id);
+		return it != m_resolved.end() ? it->second : nullptr;
+	}
+
+	/**
+	 * @brief 获取当前所有版本（按 ID 排序）
+	 * @return 版本列表
+	 */
+	std::vector<std::shared_ptr<const VersionInfo>> VersionCatalog::GetVersions() const {
+		std::lock_guard lock(m_mutex);
+		std::vector<std::shared_ptr<const VersionInfo>> versions;
+		versions.reserve(m_resolved.size());
+		for (const auto &[id, info] : m_resolved) versions.push_back(info);
+		return versions;
+	}
+}
@@ -0,0 +1,155 @@
+#pragma once
+#include "VersionLocator.h"
+#include "Utils/IO/FileStamp.h"
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace PCL_CPP::Core::Launcher::Version {
+	/**
+	 * @brief 版本变更类型
+	 */
+	enum class VersionChangeType {
+		Added,   ///< 新增版本
+		Removed, ///< 版本被删除
+		Updated  ///< 版本自身或其继承链上的父版本发生变化
+	};
+
+	/**
+	 * @brief 版本变更事件
+	 */
+	struct VersionChangeEvent {
+		VersionChangeType Type;                  ///< 变更类型
+		std::string Id;                          ///< 版本 ID
+		std::shared_ptr<const VersionInfo> Version; ///< 变更后的版本信息（删除时为 nullptr）
+	};
+
+	/**
+	 * @brief 长期驻留的增量版本目录服务
+	 *
+	 * @details
+	 * 该类持有 versions 目录下所有版本的解析结果，并在目录发生变化时增量更新：
+	 * 1. **变更检测**：通过 `ReadDirectoryChangesW` 订阅目录变化通知；无法订阅时（如网络驱动器）退化为定时轮询。
+	 * 2. **增量解析**：只重新解析文件签名发生变化的版本 JSON，内容未变的“触碰”不会产生事件。
+	 * 3. **增量继承**：只重新解析发生变化的版本及其所有子孙版本的继承关系，其他版本的共享实例保持不变。
+	 * 4. **事件通知**：每轮更新以一批 `VersionChangeEvent` 通知订阅者。
+	 *
+	 * 所有公开方法均为线程安全。订阅回调在执行更新的线程上调用（后台监视时为监视线程），回调中不应调用 `Stop`。
+	 */
+	class VersionCatalog {
+		public:
+		using ChangeListener = std::function<void(const std::vector<VersionChangeEvent> &)>;
+
+		static constexpr std::chrono::milliseconds DefaultPollInterval { 2000 }; ///< 默认轮询间隔
+		static constexpr std::chrono::milliseconds DebounceDelay { 200 };        ///< 合并连续变更通知的静默时间
+
+		/**
+		 * @brief 构造函数
+		 * @param versionsRoot .minecraft/versions 目录路径
+		 */
+		explicit VersionCatalog(const std::filesystem::path &versionsRoot);
+		~VersionCatalog();
+
+		VersionCatalog(const VersionCatalog &) = delete;
+		VersionCatalog &operator=(const VersionCatalog &) = delete;
+
+		/**
+		 * @brief 检查整个 versions 目录并应用所有变化
+		 * @details 首次调用时会加载全部版本，此后只处理签名发生变化的版本。
+		 * @return 本轮产生的变更事件
+		 */
+		std::vector<VersionChangeEvent> Refresh();
+
+		/**
+		 * @brief 仅检查指定的版本目录并应用其变化
+		 * @param dirNames 版本目录名集合
+		 * @return 本轮产生的变更事件
+		 */
+		std::vector<VersionChangeEvent> Refresh(const std::set<std::filesystem::path> &dirNames);
+
+		/**
+		 * @brief 启动后台监视线程
+		 * @details 通常先调用一次 `Refresh` 加载全部版本，再启动监视。
+		 * @param forcePolling 为 true 时不订阅目录通知，直接使用轮询
+		 * @param pollInterval 轮询间隔
+		 * @return 成功启动（或已在运行）时返回 true
+		 */
+		bool Start(bool forcePolling = false, std::chrono::milliseconds pollInterval = DefaultPollInterval);
+
+		/**
+		 * @brief 停止后台监视线程并等待其退出
+		 */
+		void Stop();
+
+		/**
+		 * @brief 后台监视线程是否在运行
+		 */
+		bool IsRunning() const { return m_worker.joinable(); }
+
+		/**
+		 * @brief 订阅版本变更事件
+		 * @param listener 回调函数
+		 * @return 用于取消订阅的标识
+		 */
+		size_t Subscribe(ChangeListener listener);
+
+		/**
+		 * @brief 取消订阅
+		 * @param token `Subscribe` 返回的标识
+		 */
+		void Unsubscribe(size_t token);
+
+		/**
+		 * @brief 查找指定 ID 的版本
+		 * @param id 版本 ID
+		 * @return 已解析的版本信息，不存在时返回 nullptr
+		 */
+		std::shared_ptr<const VersionInfo> Find(const std::string &id) const;
+
+		/**
+		 * @brief 获取当前所有版本（按 ID 排序）
+		 */
+		std::vector<std::shared_ptr<const VersionInfo>> GetVersions() const;
+
+		/**
+		 * @brief 获取监视的 versions 目录
+		 */
+		const std::filesystem::path &GetRoot() const { return m_root; }
+
+		private:
+		/**
+		 * @brief 单个版本目录的解析结果
+		 */
+		struct Source {
+			Utils::FileStamp Stamp; ///< JSON 文件签名
+			VersionInfo Info;       ///< 仅含自身内容、尚未解析继承关系的版本信息
+		};
+
+		std::vector<VersionChangeEvent> Apply(const std::set<std::filesystem::path> &dirNames);
+		void Notify(const std::vector<VersionChangeEvent> &events);
+		void WatchLoop(std::stop_token stopToken);
+		void PollLoop(std::stop_token stopToken);
+
+		std::filesystem::path m_root;
+		std::chrono::milliseconds m_pollInterval = DefaultPollInterval;
+		bool m_forcePolling = false;
+
+		std::mutex m_refreshMutex;                      ///< 串行化更新过程，保护 m_sources
+		std::map<std::filesystem::path, Source> m_sources; ///< 目录名 -> 解析结果
+
+		mutable std::mutex m_mutex;                                              ///< 保护 m_resolved 与订阅者
+		std::map<std::string, std::shared_ptr<const VersionInfo>> m_resolved; ///< 版本 ID -> 已解析版本
+		std::map<size_t, ChangeListener> m_listeners;
+		size_t m_nextToken = 1;
+
+		void *m_stopEvent = nullptr; ///< 用于唤醒监视线程的事件句柄
+		std::jthread m_worker;
+	};
+}
@@ -0,0 +1,135 @@
+#include "pch.h"
+#include "App/Logging/AppLogger.h"
+#include "VersionIndex.h"
+#include "Utils/IO/BinaryIO.h"
+#include <fstream>
+#include <iterator>
+
+using namespace PCL_CPP::Core::Logging;
+using namespace PCL_CPP::Core::Utils;
+
+namespace PCL_CPP::Core::Launcher::Version {
+
+	static constexpr uint64_t IndexMagic = 0x58444E49564C4350ull; ///< 文件头魔数，小端序下为 "PCLVINDX"
+
+	/**
+	 * @brief 构造函数
+	 * @param versionsRoot .minecraft/versions 目录路径
+	 */
+	VersionIndex::VersionIndex(const std::filesystem::path &versionsRoot)
+		: m_indexPath(versionsRoot / FileName) { }
+
+	/**
+	 * @brief 从磁盘加载索引
+	 * @return 是否成功读取到有效索引
+	 */
+	bool VersionIndex::Load() {
+		m_entries.clear();
+		m_dirty = false;
+
+		std::ifstream file(m_indexPath, std::ios::binary);
+		if (!file.is_open()) return false;
+
+		std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		BinaryReader reader(data);
+
+		if (reader.Read<uint64_t>() != IndexMagic || reader.Read<uint32_t>() != FormatVersion) {
+			LOG_INFO("Version index {} is outdated or invalid, rebuilding.", m_indexPath.string());
+			m_dirty = true;
+			return false;
+		}
+
+		uint32_t count = reader.Read<uint32_t>();
+		std::map<std::string, VersionIndexEntry> entries;
+		for (uint32_t i = 0; i < count && reader.IsOk(); i++) {
+			std::string dirName = reader.ReadString();
+			VersionIndexEntry entry;
+			entry.Stamp.Size = reader.Read<uint64_t>();
+			entry.Stamp.ModifiedTime = reader.Read<int64_t>();
+			entry.ContentHash = reader.Read<uint64_t>();
+			entry.Id = reader.ReadString();
+			entry.Type = reader.ReadString();
+			entry.InheritsFrom = reader.ReadString();
+			entry.Jar = reader.ReadString();
+			entry.MainClass = reader.ReadString();
+			entry.AssetsIndex = reader.ReadString();
+			entries.emplace(std::move(dirName), std::move(entry));
+		}
+
+		if (!reader.IsOk()) {
+			LOG_WARNING("Version index {} is truncated, rebuilding.", m_indexPath.string());
+			m_dirty = true;
+			return false;
+		}
+
+		m_entries = std::move(entries);
+		LOG_DEBUG("Loaded version index with {} entries.", m_entries.size());
+		return true;
+	}
+
+	/**
+	 * @brief 如有修改则将索引保存到磁盘
+	 * @return 无需保存或保存成功时返回 true
+	 */
+	bool VersionIndex::Save() {
+		if (!m_dirty) return true;
+
+		BinaryWriter writer;
+		writer.Write<uint64_t>(IndexMagic);
+		writer.Write<uint32_t>(FormatVersion);
+		writer.Write<uint32_t>(static_cast<uint32_t>(m_entries.size()));
+		for (const auto &[dirName, entry] : m_entries) {
+			writer.WriteString(dirName);
+			writer.Write<uint64_t>(entry.Stamp.Size);
+			writer.Write<int64_t>(entry.Stamp.ModifiedTime);
+			writer.Write<uint64_t>(entry.ContentHash);
+			writer.WriteString(entry.Id);
+			writer.WriteString(entry.Type);
+			writer.WriteString(entry.InheritsFrom);
+			writer.WriteString(entry.Jar);
+			writer.WriteString(entry.MainClass);
+			writer.WriteString(entry.AssetsIndex);
+		}
+
+		if (!writer.SaveAtomically(m_indexPath)) return false;
+		m_dirty = false;
+		return true;
+	}
+
+	/**
+	 * @brief 查找与当前文件签名一致的条目
+	 * @param dirName 版本目录名
+	 * @param stamp JSON 文件的当前签名
+	 * @return 条目存在且签名一致时返回其指针，否则返回 nullptr
+	 */
+	const VersionIndexEntry *VersionIndex::Find(const std::string &dirName, const FileStamp &stamp) const {
+		auto it = m_entries.find(dirName);
+		if (it == m_entries.end() || it->second.Stamp != stamp) return nullptr;
+		return &it->second;
+	}
+
+	/**
+	 * @brief 新增或替换一个条目
+	 * @param dirName 版本目录名
+	 * @param entry 新的条目内容
+	 */
+	void VersionIndex::Update(const std::string &dirName, VersionIndexEntry entry) {
+		m_entries[dirName] = std::move(entry);
+		m_dirty = true;
+	}
+
+	/**
+	 * @brief 删除不在给定集合中的条目
+	 * @param dirNames 当前仍存在的版本目录名集合
+	 */
+	void VersionIndex::Retain(const std::set<std::string> &dirNames) {
+		for (auto it = m_entries.begin(); it != m_entries.end();) {
+			if (!dirNames.contains(it->first)) {
+				it = m_entries.erase(it);
+				m_dirty = true;
+			} else {
+				++it;
+			}
+		}
+	}
+}
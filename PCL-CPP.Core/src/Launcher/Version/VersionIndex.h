@@ -0,0 +1,96 @@
+#pragma once
+#include "Utils/IO/FileStamp.h"
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <set>
+#include <string>
+
+namespace PCL_CPP::Core::Launcher::Version {
+	/**
+	 * @brief 版本索引条目，对应 versions 目录下的一个版本 JSON
+	 */
+	struct VersionIndexEntry {
+		Utils::FileStamp Stamp;    ///< 建立索引时 JSON 文件的状态签名
+		uint64_t ContentHash = 0;  ///< JSON 文件内容哈希
+
+		std::string Id;           ///< 版本 ID
+		std::string Type;         ///< 版本类型
+		std::string InheritsFrom; ///< 继承自的父版本 ID
+		std::string Jar;          ///< 核心 Jar 文件名
+		std::string MainClass;    ///< 游戏主类
+		std::string AssetsIndex;  ///< 资源索引名称
+	};
+
+	/**
+	 * @brief 持久化的版本索引
+	 * 
+	 * @details 
+	 * 该类在 versions 目录中维护一个紧凑的二进制索引文件，缓存每个版本 JSON 的头部字段：
+	 * 1. **变更检测**：每个条目记录 JSON 的大小与修改时间，签名一致即视为未变化，无需再次打开文件。
+	 * 2. **逐条重建**：签名不一致或新增的版本由调用方重新解析后通过 `Update` 单独替换，不影响其他条目。
+	 * 3. **容错**：索引文件缺失、损坏或格式版本不符时视为空索引，不会影响版本扫描结果。
+	 * 4. **原子保存**：通过临时文件 + 重命名写入，中途崩溃不会留下损坏的索引。
+	 */
+	class VersionIndex {
+		public:
+		static constexpr const char *FileName = ".pcl-version-index"; ///< 索引文件名
+		static constexpr uint32_t FormatVersion = 1;                   ///< 索引格式版本
+
+		/**
+		 * @brief 构造函数
+		 * @param versionsRoot .minecraft/versions 目录路径
+		 */
+		explicit VersionIndex(const std::filesystem::path &versionsRoot);
+
+		/**
+		 * @brief 从磁盘加载索引
+		 * @return 是否成功读取到有效索引
+		 */
+		bool Load();
+
+		/**
+		 * @brief 如有修改则将索引保存到磁盘
+		 * @return 无需保存或保存成功时返回 true
+		 */
+		bool Save();
+
+		/**
+		 * @brief 查找与当前文件签名一致的条目
+		 * @param dirName 版本目录名
+		 * @param stamp JSON 文件的当前签名
+		 * @return 条目存在且签名一致时返回其指针，否则返回 nullptr
+		 */
+		const VersionIndexEntry *Find(const std::string &dirName, const Utils::FileStamp &stamp) const;
+
+		/**
+		 * @brief 新增或替换一个条目
+		 * @param dirName 版本目录名
+		 * @param entry 新的条目内容
+		 */
+		void Update(const std::string &dirName, VersionIndexEntry entry);
+
+		/**
+		 * @brief 删除不在给定集合中的条目（对应的版本目录已被删除）
+		 * @param dirNames 当前仍存在的版本目录名集合
+		 */
+		void Retain(const std::set<std::string> &dirNames);
+
+		/**
+		 * @brief 获取条目数量
+		 * @return 条目数量
+		 */
+		size_t Size() const { return m_entries.size(); }
+
+		/**
+		 * @brief 检查索引自加载以来是否被修改
+		 * @return 有未保存的修改时返回 true
+		 */
+		bool IsDirty() const { return m_dirty; }
+
+		private:
+		std::filesystem::path m_indexPath;                  ///< 索引文件路径
+		std::map<std::string, VersionIndexEntry> m_entries; ///< 目录名 -> 条目
+		bool m_dirty = false;                               ///< 是否有未保存的修改
+	};
+}
@@ -0,0 +1,183 @@
+#include "pch.h"
+#include "VersionJsonView.h"
+#include "VersionLocator.h"
+
+namespace PCL_CPP::Core::Launcher::Version {
+
+	/**
+	 * @brief 获取合并结果的元素数量
+	 * @return 元素数量
+	 */
+	size_t OverlayValue::Size() const {
+		size_t size = 0;
+		for (const nlohmann::json *segment : m_segments) size += segment->size();
+		return size;
+	}
+
+	/**
+	 * @brief 将合并结果平铺为独立的 JSON 值
+	 * @return 平铺后的 JSON 值；不存在时返回 null
+	 */
+	nlohmann::json OverlayValue::Flatten() const {
+		if (m_segments.empty()) return nullptr;
+		if (!m_isArray) return *m_segments.front();
+
+		nlohmann::json result = nlohmann::json::array();
+		result.get_ref<nlohmann::json::array_t &>().reserve(Size());
+		ForEach([&](const nlohmann::json &item) { result.push_back(item); });
+		return result;
+	}
+
+	/**
+	 * @brief 用新值整体替换合并结果
+	 * @param value 新值
+	 */
+	void OverlayValue::Assign(const nlohmann::json *value) {
+		m_segments.clear();
+		m_segments.push_back(value);
+		m_isArray = value->is_array();
+	}
+
+	/**
+	 * @brief 向数组形式的合并结果追加一段
+	 * @param segment 追加的分段
+	 */
+	void OverlayValue::Append(const nlohmann::json *segment) {
+		m_segments.push_back(segment);
+	}
+
+	/**
+	 * @brief 清空合并结果
+	 */
+	void OverlayValue::Reset() {
+		m_segments.clear();
+		m_isArray = false;
+	}
+
+	/**
+	 * @brief 根据版本信息及其 `Parent` 链构造视图
+	 * @param info 版本信息
+	 */
+	VersionJsonView::VersionJsonView(const VersionInfo &info) {
+		std::vector<const nlohmann::json *> layers;
+		for (const VersionInfo *p = &info; p != nullptr; p = p->Parent.get()) {
+			layers.push_back(&p->RawData);
+		}
+		for (auto it = layers.rbegin(); it != layers.rend(); ++it) {
+			ApplyLayer(**it);
+		}
+	}
+
+	/**
+	 * @brief 根据一组 JSON 层构造视图
+	 * @param layers 从根版本到目标版本排列的 JSON 对象
+	 */
+	VersionJsonView::VersionJsonView(const std::vector<const nlohmann::json *> &layers) {
+		for (const nlohmann::json *layer : layers) {
+			ApplyLayer(*layer);
+		}
+	}
+
+	/**
+	 * @brief 将一层 JSON 叠加到当前合并结果之上
+	 * @param layer 子版本的 JSON 对象
+	 */
+	void VersionJsonView::ApplyLayer(const nlohmann::json &layer) {
+		if (!layer.is_object()) return;
+
+		for (const auto &[key, val] : layer.items()) {
+			if (key == "libraries") {
+				// 库列表采取追加方式合并
+				if (m_libraries.IsArray() && val.is_array()) {
+					m_libraries.Append(&val);
+				} else {
+					m_libraries.Assign(&val);
+				}
+			} else if (key == "arguments") {
+				// 现代版参数对象分别追加 game 与 jvm
+				if (HasArgumentsObject() && val.is_object()) {
+					for (auto [name, slot] : { std::pair { "game", &m_gameArguments }, std::pair { "jvm", &m_jvmArguments } }) {
+						auto it = val.find(name);
+						if (it == val.end()) continue;
+						if (slot->IsArray()) {
+							slot->Append(&*it);
+						} else {
+							slot->Assign(&*it);
+						}
+					}
+				} else {
+					AssignArguments(val);
+				}
+			} else {
+				// 其他字段（包括旧版 minecraftArguments）直接覆盖
+				m_overrides.insert_or_assign(key, &val);
+			}
+		}
+	}
+
+	/**
+	 * @brief 用新值整体替换 arguments
+	 * @param value 新的 arguments 值
+	 */
+	void VersionJsonView::AssignArguments(const nlohmann::json &value) {
+		m_arguments = &value;
+		m_gameArguments.Reset();
+		m_jvmArguments.Reset();
+		if (!value.is_object()) return;
+
+		if (auto it = value.find("game"); it != value.end()) m_gameArguments.Assign(&*it);
+		if (auto it = value.find("jvm"); it != value.end()) m_jvmArguments.Assign(&*it);
+	}
+
+	/**
+	 * @brief 检查合并结果中是否存在指定字段
+	 * @param key 字段名
+	 * @return 存在时返回 true
+	 */
+	bool VersionJsonView::Contains(std::string_view key) const {
+		if (key == "libraries") return m_libraries.Exists();
+		if (key == "arguments") return m_arguments != nullptr;
+		return m_overrides.find(key) != m_overrides.end();
+	}
+
+	/**
+	 * @brief 查找按覆盖规则合并的字段
+	 * @param key 字段名
+	 * @return 生效的 JSON 值，不存在时返回 nullptr
+	 */
+	const nlohmann::json *VersionJsonView::Find(std::string_view key) const {
+		auto it = m_overrides.find(key);
+		return it != m_overrides.end() ? it->second : nullptr;
+	}
+
+	/**
+	 * @brief 将视图平铺为完整的 JSON 对象
+	 * @return 与逐级合并结果完全一致的 JSON 对象
+	 */
+	nlohmann::json VersionJsonView::Flatten() const {
+		nlohmann::json result = nlohmann::json::object();
+
+		for (const auto &[key, val] : m_overrides) {
+			result[key] = *val;
+		}
+
+		if (m_libraries.Exists()) {
+			result["libraries"] = m_libraries.Flatten();
+		}
+
+		if (m_arguments != nullptr) {
+			if (!m_arguments->is_object()) {
+				result["arguments"] = *m_arguments;
+			} else {
+				nlohmann::json &args = result["arguments"] = nlohmann::json::object();
+				for (const auto &[key, val] : m_arguments->items()) {
+					if (key != "game" && key != "jvm") args[key] = val;
+				}
+				if (m_gameArguments.Exists()) args["game"] = m_gameArguments.Flatten();
+				if (m_jvmArguments.Exists()) args["jvm"] = m_jvmArguments.Flatten();
+			}
+		}
+
+		return result;
+	}
+}
@@ -0,0 +1,148 @@
+#pragma once
+#include <cstddef>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace PCL_CPP::Core::Launcher::Version {
+	struct VersionInfo;
+
+	/**
+	 * @brief 叠加合并后的单个 JSON 值
+	 *
+	 * @details
+	 * 以分段的形式表示合并结果，每一段都直接引用某一层版本 JSON 中的节点：
+	 * - 合并结果为数组时，按从父到子的顺序保存各层贡献的数组段，遍历时依次展开。
+	 * - 合并结果为非数组值时，仅保存一段，即最终生效的那个值。
+	 */
+	class OverlayValue {
+		public:
+		/**
+		 * @brief 合并结果中是否存在该值
+		 */
+		bool Exists() const { return !m_segments.empty(); }
+
+		/**
+		 * @brief 合并结果是否为数组
+		 */
+		bool IsArray() const { return m_isArray; }
+
+		/**
+		 * @brief 获取合并结果的元素数量（与平铺后调用 `nlohmann::json::size()` 一致）
+		 */
+		size_t Size() const;
+
+		/**
+		 * @brief 获取组成合并结果的各个分段
+		 */
+		const std::vector<const nlohmann::json *> &Segments() const { return m_segments; }
+
+		/**
+		 * @brief 按顺序遍历合并结果中的每个元素
+		 * @details 遍历行为与对平铺后的 JSON 值执行范围 for 循环一致。
+		 * @param fn 元素回调，参数为 `const nlohmann::json &`
+		 */
+		template<typename Fn>
+		void ForEach(Fn &&fn) const {
+			for (const nlohmann::json *segment : m_segments) {
+				for (const auto &item : *segment) fn(item);
+			}
+		}
+
+		/**
+		 * @brief 将合并结果平铺为独立的 JSON 值
+		 * @return 平铺后的 JSON 值；不存在时返回 null
+		 */
+		nlohmann::json Flatten() const;
+
+		private:
+		friend class VersionJsonView;
+
+		void Assign(const nlohmann::json *value);
+		void Append(const nlohmann::json *segment);
+		void Reset();
+
+		std::vector<const nlohmann::json *> m_segments;
+		bool m_isArray = false;
+	};
+
+	/**
+	 * @brief 版本 JSON 继承链的只读叠加视图
+	 *
+	 * @details
+	 * 以不复制任何 JSON 节点的方式表示从根版本到目标版本逐级合并后的配置，合并规则与 Minecraft 一致：
+	 * 1. **`libraries`**：父子均为数组时追加，否则由子版本覆盖。
+	 * 2. **`arguments`**：父子均为对象时分别追加 `game` 与 `jvm`（父版本缺失或不是数组时直接替换），
+	 *    子版本 `arguments` 中的其他字段被忽略；否则由子版本整体覆盖。
+	 * 3. **其他字段**（包括 `minecraftArguments`）：由子版本覆盖。
+	 *
+	 * 视图只保存指向各层 JSON 的指针，需保证被引用的 `VersionInfo`（及其 `Parent` 链）在视图使用期间存活且不被修改。
+	 * 只有调用 `Flatten` 时才会生成完整的 JSON 树。
+	 */
+	class VersionJsonView {
+		public:
+		/**
+		 * @brief 根据版本信息及其 `Parent` 链构造视图
+		 * @param info 版本信息
+		 */
+		explicit VersionJsonView(const VersionInfo &info);
+
+		/**
+		 * @brief 根据一组 JSON 层构造视图
+		 * @param layers 从根版本到目标版本排列的 JSON 对象
+		 */
+		explicit VersionJsonView(const std::vector<const nlohmann::json *> &layers);
+
+		/**
+		 * @brief 检查合并结果中是否存在指定字段
+		 * @param key 字段名
+		 */
+		bool Contains(std::string_view key) const;
+
+		/**
+		 * @brief 查找按覆盖规则合并的字段
+		 * @details `libraries` 与 `arguments` 不适用，请使用对应的专用访问器。
+		 * @param key 字段名
+		 * @return 生效的 JSON 值，不存在时返回 nullptr
+		 */
+		const nlohmann::json *Find(std::string_view key) const;
+
+		/**
+		 * @brief 获取合并后的依赖库列表
+		 */
+		const OverlayValue &Libraries() const { return m_libraries; }
+
+		/**
+		 * @brief 合并后的 `arguments` 是否为对象
+		 */
+		bool HasArgumentsObject() const { return m_arguments != nullptr && m_arguments->is_object(); }
+
+		/**
+		 * @brief 获取合并后的 `arguments.game`
+		 */
+		const OverlayValue &GameArguments() const { return m_gameArguments; }
+
+		/**
+		 * @brief 获取合并后的 `arguments.jvm`
+		 */
+		const OverlayValue &JvmArguments() const { return m_jvmArguments; }
+
+		/**
+		 * @brief 将视图平铺为完整的 JSON 对象
+		 * @return 与逐级合并结果完全一致的 JSON 对象
+		 */
+		nlohmann::json Flatten() const;
+
+		private:
+		void ApplyLayer(const nlohmann::json &layer);
+		void AssignArguments(const nlohmann::json &value);
+
+		std::map<std::string, const nlohmann::json *, std::less<>> m_overrides; ///< 按覆盖规则合并的字段
+		OverlayValue m_libraries;                                               ///< libraries
+		const nlohmann::json *m_arguments = nullptr;                            ///< 最近一次整体生效的 arguments
+		OverlayValue m_gameArguments;                                           ///< arguments.game
+		OverlayValue m_jvmArguments;                                            ///< arguments.jvm
+	};
+}
@@ -1,20 +1,46 @@
 #include "pch.h"
 #include "App/Logging/AppLogger.h"
 #include "VersionLocator.h"
-#include <fstream>
+#include "VersionJsonView.h"
+#include "VersionCache.h"
+#include "VersionIndex.h"
+#include "Utils/Hashing/HashUtils.h"
+#include "Utils/Json/JsonLoader.h"
+#include "Utils/Threading/Parallel.h"
+#include <algorithm>
 #include <set>
 
 using namespace PCL_CPP::Core::Logging;
+using namespace PCL_CPP::Core::Utils;
 
 namespace PCL_CPP::Core::Launcher::Version {
 
 	/**
 	 * @brief 扫描并获取所有有效版本
 	 * @param versionsRoot .minecraft/versions 目录路径
-	 * @return 已处理完继承关系的有效版本列表
+	 * @param maxWorkers 最大解析线程数
+	 * @return 已处理完继承关系并平铺的有效版本列表
 	 */
-	std::vector<VersionInfo> VersionLocator::GetAllVersions(const std::filesystem::path &versionsRoot) {
+	std::vector<VersionInfo> VersionLocator::GetAllVersions(const std::filesystem::path &versionsRoot, size_t maxWorkers) {
+		auto shared = GetAllSharedVersions(versionsRoot, maxWorkers);
+
 		std::vector<VersionInfo> results;
+		results.reserve(shared.size());
+		for (const auto &info : shared) {
+			results.push_back(*info);
+			Flatten(results.back());
+		}
+		return results;
+	}
+
+	/**
+	 * @brief 扫描并获取所有有效版本的共享实例
+	 * @param versionsRoot .minecraft/versions 目录路径
+	 * @param maxWorkers 最大解析线程数
+	 * @return 按版本 ID 排序、叠加形式的共享版本列表
+	 */
+	std::vector<std::shared_ptr<const VersionInfo>> VersionLocator::GetAllSharedVersions(const std::filesystem::path &versionsRoot, size_t maxWorkers) {
+		std::vector<std::shared_ptr<const VersionInfo>> results;
 		std::map<std::string, VersionInfo> versionMap;
 
 		if (!std::filesystem::exists(versionsRoot)) {
@@ -22,39 +48,181 @@ namespace PCL_CPP::Core::Launcher::Version {
 			return results;
 		}
 
-		// 第一步：扫描目录并初步解析所有 JSON 文件
+		// 第一步：收集候选目录，并按路径排序以保证后续合并顺序确定
+		std::vector<std::filesystem::path> candidates;
 		for (const auto &entry : std::filesystem::directory_iterator(versionsRoot)) {
 			if (entry.is_directory()) {
-				std::string dirName = entry.path().filename().string();
-				std::filesystem::path jsonPath = entry.path() / (dirName + ".json");
+				candidates.push_back(entry.path());
+			}
+		}
+		std::sort(candidates.begin(), candidates.end());
 
-				if (std::filesystem::exists(jsonPath)) {
-					auto info = ParseVersionJson(jsonPath);
-					if (info) {
-						versionMap[info->Id] = *info;
-					}
-				}
+		// 第二步：并行检查并初步解析所有 JSON 文件，每个任务只写入自己的槽位
+		std::vector<std::optional<VersionInfo>> parsed(candidates.size());
+		Parallel::For(candidates.size(), maxWorkers, [&](size_t i) {
+			const auto &dir = candidates[i];
+			std::filesystem::path jsonPath = dir / (dir.filename().string() + ".json");
+
+			std::error_code ec;
+			if (std::filesystem::exists(jsonPath, ec)) {
+				parsed[i] = ParseVersionJson(jsonPath);
+			}
+		});
+
+		// 第三步：按排序后的顺序合并解析结果
+		for (auto &info : parsed) {
+			if (info) {
+				std::string id = info->Id;
+				versionMap[id] = std::move(*info);
 			}
 		}
 
 		LOG_INFO("Found {} potential versions.", versionMap.size());
 
-		// 第二步：递归处理版本继承关系
-		std::vector<std::string> visitingChain;
+		// 第四步：按拓扑顺序处理版本继承关系，子版本共享父版本实例
+		auto resolved = ResolveInheritance(std::move(versionMap));
 
+		results.reserve(resolved.size());
+		for (auto &[id, info] : resolved) {
+			results.push_back(std::move(info));
+		}
+
+		return results;
+	}
+
+	/**
+	 * @brief 快速列出所有版本的头部信息
+	 * @param versionsRoot .minecraft/versions 目录路径
+	 * @param maxWorkers 最大解析线程数
+	 * @return 按版本 ID 排序的头部信息列表
+	 */
+	std::vector<VersionInfo> VersionLocator::ListVersions(const std::filesystem::path &versionsRoot, size_t maxWorkers) {
+		std::vector<VersionInfo> results;
+		if (!std::filesystem::exists(versionsRoot)) {
+			LOG_WARNING("Versions root not found: {}", versionsRoot.string());
+			return results;
+		}
+
+		std::vector<std::filesystem::path> candidates;
+		for (const auto &entry : std::filesystem::directory_iterator(versionsRoot)) {
+			if (entry.is_directory()) {
+				candidates.push_back(entry.path());
+			}
+		}
+		std::sort(candidates.begin(), candidates.end());
+
+		VersionIndex index(versionsRoot);
+		index.Load();
+
+		// 每个候选目录对应一个槽位：命中索引时直接复制条目，否则重新解析并标记为待更新
+		struct Slot {
+			std::string DirName;
+			std::optional<FileStamp> Stamp;
+			std::optional<VersionIndexEntry> Entry;
+			bool IsStale = false;
+		};
+		std::vector<Slot> slots(candidates.size());
+
+		Parallel::For(candidates.size(), maxWorkers, [&](size_t i) {
+			Slot &slot = slots[i];
+			slot.DirName = candidates[i].filename().string();
+			std::filesystem::path jsonPath = candidates[i] / (slot.DirName + ".json");
+
+			slot.Stamp = FileStamp::Read(jsonPath);
+			if (!slot.Stamp) return;
+
+			if (const auto *cached = index.Find(slot.DirName, *slot.Stamp)) {
+				slot.Entry = *cached;
+				return;
+			}
+
+			auto info = ParseVersionHeader(jsonPath);
+			if (!info) return;
+
+			VersionIndexEntry entry;
+			entry.Stamp = *slot.Stamp;
+			entry.ContentHash = info->ContentHash;
+			entry.Id = info->Id;
+			entry.Type = info->Type;
+			entry.InheritsFrom = info->InheritsFrom;
+			entry.Jar = info->Jar;
+			entry.MainClass = info->MainClass;
+			entry.AssetsIndex = info->AssetsIndex;
+			slot.Entry = std::move(entry);
+			slot.IsStale = true;
+		});
+
+		// 在调用线程中逐条更新索引，并移除已不存在的版本
+		std::set<std::string> existing;
+		std::map<std::string, VersionInfo> versionMap;
+		size_t reparsed = 0;
+		for (auto &slot : slots) {
+			if (!slot.Entry) continue;
+			existing.insert(slot.DirName);
+			if (slot.IsStale) {
+				index.Update(slot.DirName, *slot.Entry);
+				reparsed++;
+			}
+
+			VersionInfo info;
+			info.Id = slot.Entry->Id;
+			info.Type = slot.Entry->Type;
+			info.InheritsFrom = slot.Entry->InheritsFrom;
+			info.Jar = slot.Entry->Jar;
+			info.MainClass = slot.Entry->MainClass;
+			info.AssetsIndex = slot.Entry->AssetsIndex;
+			info.RootPath = versionsRoot / slot.DirName;
+			info.JsonPath = info.RootPath / (slot.DirName + ".json");
+			info.ContentHash = slot.Entry->ContentHash;
+			info.IsHeaderOnly = true;
+			versionMap[info.Id] = std::move(info);
+		}
+		index.Retain(existing);
+		index.Save();
+
+		LOG_INFO("Listed {} versions ({} re-parsed, {} from index).", versionMap.size(), reparsed, versionMap.size() - reparsed);
+
+		// 沿继承链补全头部字段
 		for (auto &[id, info] : versionMap) {
-			visitingChain.clear();
-			ResolveInheritance(info, versionMap, visitingChain);
+			std::set<std::string> visited = {id};
+			std::string parentId = info.InheritsFrom;
+			while (!parentId.empty() && !visited.contains(parentId)) {
+				auto it = versionMap.find(parentId);
+				if (it == versionMap.end()) break;
+				const VersionInfo &parent = it->second;
+				if (info.Jar.empty()) info.Jar = parent.Jar;
+				if (info.MainClass.empty()) info.MainClass = parent.MainClass;
+				if (info.AssetsIndex.empty()) info.AssetsIndex = parent.AssetsIndex;
+				visited.insert(parentId);
+				parentId = parent.InheritsFrom;
+			}
 		}
 
 		results.reserve(versionMap.size());
-		for (const auto &[id, info] : versionMap) {
-			results.push_back(info);
+		for (auto &[id, info] : versionMap) {
+			results.push_back(std::move(info));
 		}
-
 		return results;
 	}
 
+	/**
+	 * @brief 为仅包含头部字段的版本加载完整配置
+	 * @param info 要加载的版本信息
+	 * @return 加载成功或无需加载时返回 true
+	 */
+	bool VersionLocator::Materialize(VersionInfo &info) {
+		if (!info.IsHeaderOnly) return true;
+
+		auto full = GetSharedVersion(info.RootPath.parent_path(), info.RootPath.filename().string());
+		if (!full) {
+			LOG_ERROR("Failed to materialize version {}", info.Id);
+			return false;
+		}
+
+		info = *full;
+		return true;
+	}
+
 	/**
 	 * @brief 获取指定 ID 的版本信息
 	 * @param versionsRoot .minecraft/versions 目录路径
@@ -62,20 +230,44 @@ namespace PCL_CPP::Core::Launcher::Version {
 	 * @return 成功则返回版本信息，否则返回 std::nullopt
 	 */
 	std::optional<VersionInfo> VersionLocator::GetVersion(const std::filesystem::path &versionsRoot, const std::string &id) {
+		auto shared = GetSharedVersion(versionsRoot, id);
+		if (!shared) return std::nullopt;
+		return *shared;
+	}
+
+	/**
+	 * @brief 获取指定 ID 的共享版本信息
+	 * @param versionsRoot .minecraft/versions 目录路径
+	 * @param id 版本 ID
+	 * @return 成功则返回共享的版本信息，否则返回 nullptr
+	 */
+	std::shared_ptr<const VersionInfo> VersionLocator::GetSharedVersion(const std::filesystem::path &versionsRoot, const std::string &id) {
 		std::filesystem::path targetDir = versionsRoot / id;
 		std::filesystem::path jsonPath = targetDir / (id + ".json");
 
+		// 继承链上所有文件均未变化时直接使用缓存
+		if (auto cached = Cache().Find(versionsRoot, id)) return cached;
+
+		// 签名需在解析前读取，以免遗漏解析过程中发生的修改
+		std::vector<VersionCache::ChainFile> chain;
+		chain.push_back({ jsonPath, FileStamp::Read(jsonPath) });
+
 		auto info = ParseVersionJson(jsonPath);
-		if (!info) return std::nullopt;
+		if (!info) return nullptr;
 
 		// 如果没有继承关系，直接返回
-		if (!info->IsInherited()) return info;
+		if (!info->IsInherited()) {
+			auto shared = std::make_shared<const VersionInfo>(std::move(*info));
+			Cache().Put(versionsRoot, id, shared, std::move(chain));
+			return shared;
+		}
 
 		// 构建临时上下文以处理继承
+		std::string targetId = info->Id;
 		std::map<std::string, VersionInfo> tempContext;
-		tempContext[info->Id] = *info;
+		tempContext[targetId] = std::move(*info);
 
-		std::string currentId = info->Id;
+		std::string currentId = targetId;
 		std::set<std::string> loaded; 
 		loaded.insert(currentId);
 
@@ -91,6 +283,7 @@ namespace PCL_CPP::Core::Launcher::Version {
 
 			// 尝试在同级目录下寻找并加载父版本
 			std::filesystem::path parentJson = versionsRoot / parentId / (parentId + ".json");
+			chain.push_back({ parentJson, FileStamp::Read(parentJson) });
 			auto parentInfo = ParseVersionJson(parentJson);
 
 			if (parentInfo) {
@@ -103,10 +296,53 @@ namespace PCL_CPP::Core::Launcher::Version {
 			}
 		}
 
-		std::vector<std::string> visitingChain;
-		ResolveInheritance(tempContext[id], tempContext, visitingChain);
+		auto resolved = ResolveInheritance(std::move(tempContext));
+
+		auto result = std::make_shared<VersionInfo>(*resolved[targetId]);
+		Flatten(*result);
+
+		Cache().Put(versionsRoot, id, result, std::move(chain));
+		return result;
+	}
+
+	/**
+	 * @brief 获取 `GetVersion` 使用的进程内缓存
+	 * @return 全局版本缓存
+	 */
+	VersionCache &VersionLocator::Cache() {
+		static VersionCache cache;
+		return cache;
+	}
+
+	/**
+	 * @brief 将叠加形式的版本平铺为完整的 JSON 配置
+	 * @param info 要平铺的版本信息
+	 */
+	void VersionLocator::Flatten(VersionInfo &info) {
+		if (!info.Parent) return;
+
+		// 清空 Parent 后无法再沿继承链计算，必须在此之前记录
+		info.ResolvedHash = GetResolvedHash(info);
+		info.RawData = VersionJsonView(info).Flatten();
+		info.Parent.reset();
+	}
 
-		return tempContext[id];
+	/**
+	 * @brief 计算继承链的组合哈希
+	 * @param info 已解析的版本信息
+	 * @return 组合哈希，无法确定时返回 0
+	 */
+	uint64_t VersionLocator::GetResolvedHash(const VersionInfo &info) {
+		if (info.ResolvedHash != 0) return info.ResolvedHash;
+
+		uint64_t hash = HashUtils::Fnv1a64(info.JsonPath.string());
+		for (const VersionInfo *layer = &info; layer; layer = layer->Parent.get()) {
+			if (layer->ContentHash == 0) return 0;
+			hash = HashUtils::Combine(hash, layer->ContentHash);
+			if (layer != &info && layer->ResolvedHash != 0) return HashUtils::Combine(hash, layer->ResolvedHash);
+			if (layer->IsInherited() && !layer->Parent) return 0;
+		}
+		return hash;
 	}
 
 	/**
@@ -116,11 +352,10 @@ namespace PCL_CPP::Core::Launcher::Version {
 	 */
 	std::optional<VersionInfo> VersionLocator::ParseVersionJson(const std::filesystem::path &jsonPath) {
 		try {
-			std::ifstream file(jsonPath);
-			if (!file.is_open()) return std::nullopt;
+			if (!std::filesystem::exists(jsonPath)) return std::nullopt;
 
-			nlohmann::json j;
-			file >> j;
+			uint64_t contentHash = 0;
+			nlohmann::json j = JsonLoader::ParseFile(jsonPath, &contentHash);
 
 			VersionInfo info;
 			info.Id = j.value("id", "Unknown");
@@ -131,7 +366,8 @@ namespace PCL_CPP::Core::Launcher::Version {
 			info.AssetsIndex = j.value("assets", "");
 			info.RootPath = jsonPath.parent_path();
 			info.JsonPath = jsonPath;
-			info.RawData = j;
+			info.ContentHash = contentHash;
+			info.RawData = std::move(j);
 
 			// 如果未指定 Jar 文件名且没有继承关系，则默认与 ID 相同
 			if (info.Jar.empty() && info.InheritsFrom.empty()) {
@@ -146,103 +382,203 @@ namespace PCL_CPP::Core::Launcher::Version {
 	}
 
 	/**
-	 * @brief 递归处理版本继承关系
-	 * @param target 目标版本信息
-	 * @param context 可用的版本上下文映射
-	 * @param visitingChain 用于循环继承检测的链
+	 * @brief 版本头部字段的 SAX 处理器
+	 * @details 
+	 * 仅记录顶层对象中的字符串字段，以下情况返回 false 以提前结束解析：
+	 * - 六个字段全部找到；
+	 * - 顶层对象结束（不再处理其后的内容）；
+	 * - 继承版本进入顶层的 `libraries` 数组，且 ID、类型、主类与继承来源均已找到。
+	 *   加载器生成的 JSON 通常把 `libraries` 放在最后，其余字段由父版本提供；
+	 *   原版 JSON 的 `mainClass` 与 `type` 位于 `libraries` 之后，不满足条件，仍会完整解析。
 	 */
-	void VersionLocator::ResolveInheritance(VersionInfo &target, std::map<std::string, VersionInfo> &context, std::vector<std::string>& visitingChain) {
-		// 无需继承或已处理完毕
-		if (!target.IsInherited() || target.IsResolved) {
-			target.IsResolved = true;
-			return;
+	class VersionHeaderSax : public nlohmann::json::json_sax_t {
+		public:
+		std::optional<std::string> Id, Type, InheritsFrom, Jar, MainClass, Assets; ///< 收集到的字段
+		bool IsCompleted = false; ///< 是否因字段收集完毕而提前结束
+		bool HasError = false;    ///< 是否发生解析错误
+		std::string ErrorMessage; ///< 解析错误信息
+
+		bool null() override { return Skip(); }
+		bool boolean(bool) override { return Skip(); }
+		bool number_integer(number_integer_t) override { return Skip(); }
+		bool number_unsigned(number_unsigned_t) override { return Skip(); }
+		bool number_float(number_float_t, const string_t &) override { return Skip(); }
+		bool binary(binary_t &) override { return Skip(); }
+
+		bool string(string_t &val) override {
+			if (m_depth == 1 && m_target != nullptr) {
+				*m_target = std::move(val);
+				m_target = nullptr;
+				if (Id && Type && InheritsFrom && Jar && MainClass && Assets) {
+					IsCompleted = true;
+					return false;
+				}
+			}
+			m_target = nullptr;
+			return true;
 		}
 
-		// 循环继承检测
-		for (const auto& v : visitingChain) {
-			if (v == target.Id) {
-				LOG_ERROR("Circular inheritance detected: {} in chain", target.Id);
-				return;
+		bool start_object(std::size_t) override {
+			m_depth++;
+			m_target = nullptr;
+			return true;
+		}
+
+		bool key(string_t &val) override {
+			m_target = nullptr;
+			m_isLibrariesKey = false;
+			if (m_depth != 1) return true;
+			if (val == "libraries") m_isLibrariesKey = true;
+			if (val == "id") m_target = &Id;
+			else if (val == "type") m_target = &Type;
+			else if (val == "inheritsFrom") m_target = &InheritsFrom;
+			else if (val == "jar") m_target = &Jar;
+			else if (val == "mainClass") m_target = &MainClass;
+			else if (val == "assets") m_target = &Assets;
+			return true;
+		}
+
+		bool end_object() override {
+			m_depth--;
+			if (m_depth == 0) {
+				IsCompleted = true;
+				return false;
 			}
+			return true;
 		}
-		visitingChain.push_back(target.Id);
 
-		// 查找父版本
-		auto it = context.find(target.InheritsFrom);
-		if (it == context.end()) {
-			LOG_WARNING("Version {} inherits from {}, but parent not found in context.", target.Id, target.InheritsFrom);
-			target.IsResolved = true;
-			visitingChain.pop_back();
-			return;
+		bool start_array(std::size_t) override {
+			if (m_depth == 1 && m_isLibrariesKey && Id && Type && MainClass && InheritsFrom) {
+				IsCompleted = true;
+				return false;
+			}
+			m_depth++;
+			m_target = nullptr;
+			m_isLibrariesKey = false;
+			return true;
 		}
 
-		VersionInfo& parent = it->second;
+		bool end_array() override {
+			m_depth--;
+			return true;
+		}
 
-		// 递归先处理父版本的继承
-		ResolveInheritance(parent, context, visitingChain);
+		bool parse_error(std::size_t, const std::string &, const nlohmann::json::exception &ex) override {
+			HasError = true;
+			ErrorMessage = ex.what();
+			return false;
+		}
 
-		// 将父版本的数据合并到当前版本
-		MergeJson(target.RawData, parent.RawData);
+		private:
+		bool Skip() {
+			m_target = nullptr;
+			return true;
+		}
 
-		// 补全缺失的关键信息
-		if (target.Jar.empty()) target.Jar = parent.Jar;
-		if (target.MainClass.empty()) target.MainClass = parent.MainClass;
-		if (target.AssetsIndex.empty()) target.AssetsIndex = parent.AssetsIndex;
+		int m_depth = 0; ///< 当前嵌套深度（顶层对象内为 1）
+		std::optional<std::string> *m_target = nullptr; ///< 当前键对应的待写入字段
+		bool m_isLibrariesKey = false; ///< 当前键是否为顶层的 libraries
+	};
 
-		target.IsResolved = true;
-		visitingChain.pop_back();
+	/**
+	 * @brief 以 SAX 方式仅解析单个 JSON 文件的头部字段
+	 * @param jsonPath JSON 文件路径
+	 * @return 仅包含头部字段的版本信息
+	 */
+	std::optional<VersionInfo> VersionLocator::ParseVersionHeader(const std::filesystem::path &jsonPath) {
+		try {
+			if (!std::filesystem::exists(jsonPath)) return std::nullopt;
+
+			VersionHeaderSax sax;
+			uint64_t contentHash = 0;
+			JsonLoader::SaxParseFile(jsonPath, sax, &contentHash);
+			if (sax.HasError) {
+				LOG_ERROR("Failed to parse version json {}: {}", jsonPath.string(), sax.ErrorMessage);
+				return std::nullopt;
+			}
+
+			VersionInfo info;
+			info.Id = sax.Id.value_or("Unknown");
+			info.Type = sax.Type.value_or("release");
+			info.InheritsFrom = sax.InheritsFrom.value_or("");
+			info.Jar = sax.Jar.value_or("");
+			info.MainClass = sax.MainClass.value_or("");
+			info.AssetsIndex = sax.Assets.value_or("");
+			info.RootPath = jsonPath.parent_path();
+			info.JsonPath = jsonPath;
+			info.ContentHash = contentHash;
+			info.IsHeaderOnly = true;
+
+			if (info.Jar.empty() && info.InheritsFrom.empty()) {
+				info.Jar = info.Id;
+			}
+
+			return info;
+		} catch (const std::exception &e) {
+			LOG_ERROR("Failed to parse version json {}: {}", jsonPath.string(), e.what());
+			return std::nullopt;
+		}
 	}
 
 	/**
-	 * @brief 合并两个 JSON 对象（遵循 Minecraft 解析规则）
-	 * @param target 目标 JSON 对象（将被修改）
-	 * @param source 来源 JSON 对象
+	 * @brief 按拓扑顺序解析一组版本的继承关系
+	 * @param versions 版本 ID -> 仅含自身内容的版本信息（会被移动）
+	 * @return 版本 ID -> 已解析的共享版本信息
 	 */
-	void VersionLocator::MergeJson(nlohmann::json &target, const nlohmann::json &source){
-
-		nlohmann::json result = source; 
+	std::map<std::string, std::shared_ptr<const VersionInfo>> VersionLocator::ResolveInheritance(std::map<std::string, VersionInfo> &&versions) {
+		std::map<std::string, std::shared_ptr<const VersionInfo>> resolved;
+		ResolveInheritance(std::move(versions), resolved);
+		return resolved;
+	}
 
-		for (auto &[key, val] : target.items()) {
-			if (key == "libraries") {
-				// 库列表采取追加方式合并
-				if (result.contains("libraries") && result["libraries"].is_array() && val.is_array()) {
-					for (const auto &lib : val) {
-						result["libraries"].push_back(lib);
-					}
-				} else {
-					result[key] = val;
+	/**
+	 * @brief 在已解析版本的基础上解析一组版本的继承关系
+	 * @param versions 版本 ID -> 待解析的版本信息（会被移动）
+	 * @param resolved 版本 ID -> 已解析的共享版本信息
+	 */
+	void VersionLocator::ResolveInheritance(std::map<std::string, VersionInfo> &&versions, std::map<std::string, std::shared_ptr<const VersionInfo>> &resolved) {
+		for (const auto &[startId, startInfo] : versions) {
+			if (resolved.contains(startId)) continue;
+
+			// 沿继承链向上回溯，收集尚未解析的版本
+			std::vector<std::string> chain;
+			std::set<std::string> onChain;
+			std::string currentId = startId;
+			while (!resolved.contains(currentId)) {
+				auto it = versions.find(currentId);
+				if (it == versions.end()) break; // 父版本缺失
+				if (onChain.contains(currentId)) {
+					LOG_ERROR("Circular inheritance detected: {} in chain", currentId);
+					break;
 				}
-			} else if (key == "minecraftArguments") {
-				// 旧版参数直接覆盖
-				result[key] = val;
-			} else if (key == "arguments") {
-				// 现代版参数对象递归合并
-				if (result.contains("arguments") && result["arguments"].is_object() && val.is_object()) {
-					if (val.contains("game")) {
-						if (!result["arguments"].contains("game") || !result["arguments"]["game"].is_array()) {
-							result["arguments"]["game"] = val["game"];
-						} else {
-							nlohmann::json &gameArgs = result["arguments"]["game"];
-							for (auto &arg : val["game"]) gameArgs.push_back(arg);
-						}
-					}
-					if (val.contains("jvm")) {
-						if (!result["arguments"].contains("jvm") || !result["arguments"]["jvm"].is_array()) {
-							result["arguments"]["jvm"] = val["jvm"];
-						} else {
-							nlohmann::json &jvmArgs = result["arguments"]["jvm"];
-							for (auto &arg : val["jvm"]) jvmArgs.push_back(arg);
-						}
+				chain.push_back(currentId);
+				onChain.insert(currentId);
+				if (!it->second.IsInherited()) break;
+				currentId = it->second.InheritsFrom;
+			}
+
+			// 从祖先到子孙依次解析，父版本解析完成后即被冻结为共享实例
+			for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+				VersionInfo &info = versions.at(*it);
+
+				if (info.IsInherited()) {
+					auto parentIt = resolved.find(info.InheritsFrom);
+					if (parentIt != resolved.end()) {
+						const auto &parent = parentIt->second;
+						info.Parent = parent;
+
+						// 补全缺失的关键信息
+						if (info.Jar.empty()) info.Jar = parent->Jar;
+						if (info.MainClass.empty()) info.MainClass = parent->MainClass;
+						if (info.AssetsIndex.empty()) info.AssetsIndex = parent->AssetsIndex;
+					} else if (!versions.contains(info.InheritsFrom)) {
+						LOG_WARNING("Version {} inherits from {}, but parent not found in context.", info.Id, info.InheritsFrom);
 					}
-				} else {
-					result[key] = val;
 				}
-			} else {
-				// 其他字段直接覆盖
-				result[key] = val;
+
+				info.IsResolved = true;
+				resolved[*it] = std::make_shared<const VersionInfo>(std::move(info));
 			}
 		}
-
-		target = result;
 	}
 }
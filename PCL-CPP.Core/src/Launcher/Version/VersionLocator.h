@@ -1,11 +1,15 @@
 #pragma once
+#include <cstdint>
 #include <filesystem>
 #include <map>
+#include <memory>
 #include <nlohmann/json.hpp>
 #include <optional>
 #include <vector>
 
 namespace PCL_CPP::Core::Launcher::Version {
+	class VersionCache;
+
 	/**
 	 * @brief 游戏版本信息结构体
 	 */
@@ -20,9 +24,21 @@ namespace PCL_CPP::Core::Launcher::Version {
 		std::filesystem::path RootPath; ///< 版本根目录
 		std::filesystem::path JsonPath; ///< 版本 JSON 文件路径
 
-		nlohmann::json RawData; ///< 原始 JSON 配置数据
+		/**
+		 * @brief JSON 配置数据
+		 * @details 
+		 * - `Parent` 为空时，RawData 为完整（已合并继承链）的配置。
+		 * - `Parent` 非空时，RawData 仅为当前版本 JSON 自身的内容，完整配置为父版本与其叠加的结果，
+		 *   需要平铺的 JSON 树时可调用 `VersionLocator::Flatten`。
+		 */
+		nlohmann::json RawData;
+		uint64_t ContentHash = 0; ///< JSON 文件内容哈希 (FNV-1a 64)
+		uint64_t ResolvedHash = 0; ///< 平铺前记录的继承链组合哈希，平铺后 `Parent` 为空时仍可据此识别父版本的变化，见 `VersionLocator::GetResolvedHash`
+
+		std::shared_ptr<const VersionInfo> Parent; ///< 已解析完毕的父版本（共享、不可变），多个子版本共用同一实例
 
 		bool IsResolved = false; ///< 是否已处理完继承关系
+		bool IsHeaderOnly = false; ///< 是否仅包含头部字段（此时 RawData 为空）
 
 		/**
 		 * @brief 检查当前版本是否为继承版本
@@ -38,8 +54,10 @@ namespace PCL_CPP::Core::Launcher::Version {
 	 * 该类实现了 Minecraft 的多版本管理逻辑：
 	 * 1. **版本发现**：通过扫描 `.minecraft/versions` 目录，识别符合 `目录名/目录名.json` 结构的有效版本。
 	 * 2. **继承处理 (Inheritance)**：支持版本间的配置继承（如 OptiFine 继承原版）。
-	 *    - **递归解析**：如果版本 A 继承自 B，则先解析 B，再将 A 的配置合并到 B 之上。
-	 *    - **循环检测**：通过维护访问链，防止 A->B->A 这样的死循环继承。
+	 *    - **拓扑解析**：按父版本先于子版本的顺序一次性解析所有版本，每个版本只解析一次。
+	 *    - **共享父版本**：子版本通过 `Parent` 引用已解析完毕的不可变父版本，而不是复制父版本的 JSON 树，
+	 *      因此大量加载器版本继承同一原版时，内存不会随子版本数量增长。
+	 *    - **循环检测**：沿继承链回溯时检测 A->B->A 这样的死循环继承。
 	 * 3. **配置合并 (JSON Merge)**：
 	 *    - **数组追加**：对于 `libraries` 等字段，子版本会将其依赖追加到父版本列表中。
 	 *    - **字段覆盖**：对于 `mainClass`、`jar` 等单一属性，子版本会覆盖父版本的值。
@@ -51,11 +69,77 @@ namespace PCL_CPP::Core::Launcher::Version {
 		 * @brief 扫描并获取所有有效版本
 		 * @details 
 		 * 遍历版本根目录，对每个子目录尝试解析其 JSON。解析后会全局解决继承关系，
-		 * 确保返回的每个 `VersionInfo` 都包含了完整的、合并后的配置。
+		 * 继承版本与 `GetVersion` 一样被平铺：`RawData` 包含合并后的完整配置，`Parent` 为空。
+		 * 只需读取时应使用 `GetAllSharedVersions`，继承版本之间共享父版本实例而不复制合并结果。
+		 * 
+		 * 并行扫描：
+		 * - 先收集所有子目录并按路径排序，再交由有界工作线程池并行检查和解析各自的 JSON。
+		 * - 解析结果按排序后的顺序写回 `versionMap`，因此输出与线程调度无关，是确定的。
+		 * - 继承关系的处理仍在调用线程中完成。
 		 * @param versionsRoot .minecraft/versions 目录路径
-		 * @return 已处理完继承关系的有效版本列表
+		 * @param maxWorkers 最大解析线程数（0 表示使用硬件并发数，1 表示在调用线程中顺序扫描）
+		 * @return 已处理完继承关系并平铺的有效版本列表
+		 */
+		static std::vector<VersionInfo> GetAllVersions(const std::filesystem::path &versionsRoot, size_t maxWorkers = 0);
+
+		/**
+		 * @brief 扫描并获取所有有效版本的共享实例
+		 * @details 
+		 * 扫描方式与 `GetAllVersions` 相同，但不平铺继承版本：
+		 * 继承版本的 `Parent` 指向共享的已解析父版本，`RawData` 仅保留自身内容，需要通过 `VersionJsonView` 读取合并后的字段。
+		 * @param versionsRoot .minecraft/versions 目录路径
+		 * @param maxWorkers 最大解析线程数（0 表示使用硬件并发数，1 表示在调用线程中顺序扫描）
+		 * @return 按版本 ID 排序、叠加形式的共享版本列表
+		 */
+		static std::vector<std::shared_ptr<const VersionInfo>> GetAllSharedVersions(const std::filesystem::path &versionsRoot, size_t maxWorkers = 0);
+
+		/**
+		 * @brief 快速列出所有版本的头部信息
+		 * @details 
+		 * 与 `GetAllVersions` 不同，该函数只提供 Id、Type、InheritsFrom、Jar、MainClass、AssetsIndex 等头部字段，
+		 * 返回的 `VersionInfo` 的 `IsHeaderOnly` 为 true 且 `RawData` 为空，适用于界面中的版本列表。
+		 * 需要完整配置时（例如启动游戏），可通过 `Materialize` 按需加载。
+		 * 
+		 * 实现细节：
+		 * - 借助 `VersionIndex` 持久化索引，大小和修改时间均未变化的 JSON 不会被再次打开。
+		 * - 新增或发生变化的 JSON 会被并行地以 SAX 方式提取头部字段（不构建 DOM），并逐条更新到索引中；
+		 *   已删除的版本会从索引中移除。
+		 * - Jar、MainClass、AssetsIndex 为空时沿继承链从父版本补全。
+		 * @param versionsRoot .minecraft/versions 目录路径
+		 * @param maxWorkers 最大解析线程数（0 表示使用硬件并发数）
+		 * @return 按版本 ID 排序的头部信息列表
+		 */
+		static std::vector<VersionInfo> ListVersions(const std::filesystem::path &versionsRoot, size_t maxWorkers = 0);
+
+		/**
+		 * @brief 为仅包含头部字段的版本加载完整配置
+		 * @details 
+		 * 对 `IsHeaderOnly` 为 true 的版本，按其所在目录重新读取 JSON 并处理完整的继承链，
+		 * 随后用完整结果替换 `info`。对已完整加载的版本不做任何操作。
+		 * @param info 要加载的版本信息
+		 * @return 加载成功或无需加载时返回 true
+		 */
+		static bool Materialize(VersionInfo &info);
+
+		/**
+		 * @brief 将叠加形式的版本平铺为完整的 JSON 配置
+		 * @details 
+		 * 通过 `VersionJsonView` 将整条 `Parent` 链合并为完整的 JSON 树，结果写回 `info.RawData`，并清空 `info.Parent`。
+		 * 清空前先将继承链的组合哈希记录到 `info.ResolvedHash`。
+		 * 对 `Parent` 为空的版本不做任何操作。只有真正需要平铺 JSON 树的调用方才应调用此函数。
+		 * @param info 要平铺的版本信息
+		 */
+		static void Flatten(VersionInfo &info);
+
+		/**
+		 * @brief 计算继承链的组合哈希
+		 * @details 
+		 * 组合版本 JSON 路径与 `Parent` 链上每一层的内容哈希，任一 JSON 变化都会得到不同的值，可用作规划结果等缓存的键。
+		 * 已记录 `ResolvedHash`（例如已被 `Flatten` 平铺）的层直接使用记录的值。
+		 * @param info 已解析的版本信息
+		 * @return 组合哈希；任一层缺少内容哈希，或继承版本既没有 `Parent` 也没有记录的哈希（父版本变化无法反映到哈希中）时返回 0
 		 */
-		static std::vector<VersionInfo> GetAllVersions(const std::filesystem::path &versionsRoot);
+		static uint64_t GetResolvedHash(const VersionInfo &info);
 
 		/**
 		 * @brief 获取指定 ID 的版本信息
@@ -64,7 +148,10 @@ namespace PCL_CPP::Core::Launcher::Version {
 		 * 如果该版本声明了 `inheritsFrom`，该函数会：
 		 * 1. 在同级目录下查找父版本的 JSON。
 		 * 2. 递归加载整条继承链上的所有版本。
-		 * 3. 按照从父到子的顺序执行 `MergeJson`。
+		 * 3. 解析继承关系后调用 `Flatten`，因此返回的 `RawData` 总是完整的平铺配置。
+		 * 
+		 * 结果会写入 `Cache()`，继承链上的文件均未变化时，后续调用直接从内存返回。
+		 * 返回值是缓存条目的副本（包括完整的 JSON 树），只需读取时应使用 `GetSharedVersion` 以避免复制。
 		 * 
 		 * @param versionsRoot .minecraft/versions 目录路径
 		 * @param id 版本 ID
@@ -72,39 +159,67 @@ namespace PCL_CPP::Core::Launcher::Version {
 		 */
 		static std::optional<VersionInfo> GetVersion(const std::filesystem::path &versionsRoot, const std::string &id);
 
+		/**
+		 * @brief 获取指定 ID 的共享版本信息
+		 * @details 
+		 * 加载与缓存逻辑与 `GetVersion` 相同，但直接返回缓存中的不可变实例，命中缓存时不复制任何数据。
+		 * 适用于只读取版本信息的频繁调用方，例如 `CompiledVersion::Compile` 为仅含头部字段的版本加载完整配置。
+		 * @param versionsRoot .minecraft/versions 目录路径
+		 * @param id 版本 ID
+		 * @return 成功则返回共享的版本信息，否则返回 nullptr
+		 */
+		static std::shared_ptr<const VersionInfo> GetSharedVersion(const std::filesystem::path &versionsRoot, const std::string &id);
+
+		/**
+		 * @brief 获取 `GetVersion` 使用的进程内缓存
+		 * @return 全局版本缓存
+		 */
+		static VersionCache &Cache();
+
 		private:
+		friend class VersionCatalog;
+		friend class MultiRootCatalog;
+
 		/**
 		 * @brief 解析单个 JSON 文件（不处理继承）
 		 * @details 
 		 * 负责基础字段的映射（Id, Type, Jar 等）以及原始 JSON 数据的存储。
+		 * 文件通过 `JsonLoader` 以内存映射方式读取，在解析的同时计算内容哈希。
 		 * @param jsonPath JSON 文件路径
 		 * @return 解析出的版本信息
 		 */
 		static std::optional<VersionInfo> ParseVersionJson(const std::filesystem::path &jsonPath);
 
 		/**
-		 * @brief 递归处理版本继承关系
+		 * @brief 以 SAX 方式仅解析单个 JSON 文件的头部字段
 		 * @details 
-		 * 核心算法逻辑：
-		 * - 检查 `IsResolved` 标志以避免重复处理。
-		 * - 使用 `visitingChain` 进行深度优先搜索中的环检测。
-		 * - 找到父版本后，递归调用自身，随后调用 `MergeJson` 将结果合并到当前对象。
-		 * @param target 目标版本信息
-		 * @param context 可用的版本上下文映射
-		 * @param visitingChain 用于循环继承检测的链
+		 * 只在顶层对象中收集 id、type、inheritsFrom、jar、mainClass、assets 六个字段，
+		 * 其余子树（libraries、arguments 等）仅被词法扫描而不会构建 DOM。
+		 * 六个字段全部找到、顶层对象结束，或继承版本在已找到 ID、类型与主类后进入顶层的 `libraries` 时停止解析。
+		 * 内容哈希仍按整个文件计算。
+		 * @param jsonPath JSON 文件路径
+		 * @return 仅包含头部字段的版本信息
 		 */
-		static void ResolveInheritance(VersionInfo &target, std::map<std::string, VersionInfo> &context, std::vector<std::string>& visitingChain);
+		static std::optional<VersionInfo> ParseVersionHeader(const std::filesystem::path &jsonPath);
 
 		/**
-		 * @brief 合并两个 JSON 对象（遵循 Minecraft 解析规则）
+		 * @brief 按拓扑顺序解析一组版本的继承关系
 		 * @details 
-		 * 合并逻辑：
-		 * - **Libraries**：将 source 的库列表作为基础，追加 target 的库。
-		 * - **Arguments**：对 `game` 和 `jvm` 数组执行追加操作。
-		 * - **其他字段**：target 的值覆盖 source。
-		 * @param target 目标 JSON 对象（将被修改）
-		 * @param source 来源 JSON 对象
+		 * 核心算法逻辑：
+		 * - 对每个尚未解析的版本，沿 `inheritsFrom` 向上回溯，直到遇到已解析的祖先、缺失的父版本或环。
+		 * - 再沿回溯路径从祖先到子孙依次解析：子版本的 `Parent` 指向父版本已冻结的共享实例，并补全缺失的头部字段。
+		 * - 每个版本只被解析一次，总代价与版本数量成正比，且不会复制任何 JSON 树。
+		 * @param versions 版本 ID -> 仅含自身内容的版本信息（会被移动）
+		 * @return 版本 ID -> 已解析的共享版本信息
+		 */
+		static std::map<std::string, std::shared_ptr<const VersionInfo>> ResolveInheritance(std::map<std::string, VersionInfo> &&versions);
+
+		/**
+		 * @brief 在已解析版本的基础上解析一组版本的继承关系
+		 * @details 供增量更新使用：`resolved` 中已有的版本被视为可直接引用的父版本，新解析的版本会被加入其中。
+		 * @param versions 版本 ID -> 待解析的版本信息（会被移动）
+		 * @param resolved 版本 ID -> 已解析的共享版本信息
 		 */
-		static void MergeJson(nlohmann::json &target, const nlohmann::json &source);
+		static void ResolveInheritance(std::map<std::string, VersionInfo> &&versions, std::map<std::string, std::shared_ptr<const VersionInfo>> &resolved);
 	};
 }
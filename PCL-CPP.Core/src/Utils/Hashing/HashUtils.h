@@ -0,0 +1,43 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+
+namespace PCL_CPP::Core::Utils {
+	/**
+	 * @brief 轻量哈希工具类
+	 * 
+	 * @details 
+	 * 提供非加密用途的快速哈希，用于缓存键、内容去重和变更检测。
+	 * 需要抵抗碰撞或与外部校验值比对的场景（如文件完整性校验）不应使用本类。
+	 */
+	class HashUtils {
+		public:
+		static constexpr uint64_t Fnv1aOffset = 0xcbf29ce484222325ull; ///< FNV-1a 64 位初始值
+		static constexpr uint64_t Fnv1aPrime = 0x100000001b3ull;       ///< FNV-1a 64 位乘数
+
+		/**
+		 * @brief 计算 FNV-1a 64 位哈希
+		 * @param data 输入数据
+		 * @param seed 初始值，可传入上一段数据的哈希以实现增量计算
+		 * @return 哈希值
+		 */
+		static constexpr uint64_t Fnv1a64(std::string_view data, uint64_t seed = Fnv1aOffset) noexcept {
+			uint64_t hash = seed;
+			for (unsigned char c : data) {
+				hash ^= c;
+				hash *= Fnv1aPrime;
+			}
+			return hash;
+		}
+
+		/**
+		 * @brief 将一个值混入已有哈希
+		 * @param seed 已有哈希
+		 * @param value 要混入的值
+		 * @return 混合后的哈希
+		 */
+		static constexpr uint64_t Combine(uint64_t seed, uint64_t value) noexcept {
+			return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+		}
+	};
+}
@@ -0,0 +1,149 @@
+#include "pch.h"
+#include "Sha1.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace PCL_CPP::Core::Utils {
+
+	/**
+	 * @brief 重置为初始状态
+	 */
+	void Sha1::Reset() noexcept {
+		m_state = { 0x67452301u, 0xEFCDAB89u, 0x98BADCFEu, 0x10325476u, 0xC3D2E1F0u };
+		m_bufferSize = 0;
+		m_length = 0;
+	}
+
+	/**
+	 * @brief 追加输入数据
+	 * @param data 输入数据
+	 */
+	void Sha1::Update(std::span<const std::byte> data) noexcept {
+		const auto *input = reinterpret_cast<const uint8_t *>(data.data());
+		size_t size = data.size();
+		m_length += size;
+
+		// 先补齐上次剩余的不完整分组
+		if (m_bufferSize > 0) {
+			size_t take = std::min(size, m_buffer.size() - m_bufferSize);
+			std::memcpy(m_buffer.data() + m_bufferSize, input, take);
+			m_bufferSize += take;
+			input += take;
+			size -= take;
+			if (m_bufferSize < m_buffer.size()) return;
+			Transform(m_buffer.data());
+			m_bufferSize = 0;
+		}
+
+		// 完整分组直接在输入上处理，不经过缓冲区
+		for (; size >= 64; input += 64, size -= 64) Transform(input);
+
+		std::memcpy(m_buffer.data(), input, size);
+		m_bufferSize = size;
+	}
+
+	/**
+	 * @brief 结束计算并返回摘要
+	 * @return 摘要
+	 */
+	Sha1::Digest Sha1::Finish() noexcept {
+		uint64_t bitLength = m_length * 8;
+
+		// 填充：0x80，若干 0，最后 8 字节为大端序的消息位长度
+		m_buffer[m_bufferSize++] = 0x80;
+		if (m_bufferSize > 56) {
+			std::memset(m_buffer.data() + m_bufferSize, 0, m_buffer.size() - m_bufferSize);
+			Transform(m_buffer.data());
+			m_bufferSize = 0;
+		}
+		std::memset(m_buffer.data() + m_bufferSize, 0, 56 - m_bufferSize);
+		for (int i = 0; i < 8; i++) m_buffer[63 - i] = static_cast<uint8_t>(bitLength >> (i * 8));
+		Transform(m_buffer.data());
+
+		Digest digest;
+		for (size_t i = 0; i < m_state.size(); i++) {
+			for (int b = 0; b < 4; b++) digest[i * 4 + b] = static_cast<uint8_t>(m_state[i] >> (24 - b * 8));
+		}
+		Reset();
+		return digest;
+	}
+
+	/**
+	 * @brief 处理一个 64 字节分组
+	 * @param block 分组数据
+	 */
+	void Sha1::Transform(const uint8_t *block) noexcept {
+		uint32_t w[80];
+		for (int i = 0; i < 16; i++) {
+			w[i] = (uint32_t(block[i * 4]) << 24) | (uint32_t(block[i * 4 + 1]) << 16) | (uint32_t(block[i * 4 + 2]) << 8) | uint32_t(block[i * 4 + 3]);
+		}
+		for (int i = 16; i < 80; i++) w[i] = std::rotl(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+		uint32_t a = m_state[0], b = m_state[1], c = m_state[2], d = m_state[3], e = m_state[4];
+		for (int i = 0; i < 80; i++) {
+			uint32_t f, k;
+			if (i < 20) {
+				f = (b & c) | (~b & d);
+				k = 0x5A827999u;
+			} else if (i < 40) {
+				f = b ^ c ^ d;
+				k = 0x6ED9EBA1u;
+			} else if (i < 60) {
+				f = (b & c) | (b & d) | (c & d);
+				k = 0x8F1BBCDCu;
+			} else {
+				f = b ^ c ^ d;
+				k = 0xCA62C1D6u;
+			}
+			uint32_t temp = std::rotl(a, 5) + f + e + k + w[i];
+			e = d;
+			d = c;
+			c = std::rotl(b, 30);
+			b = a;
+			a = temp;
+		}
+
+		m_state[0] += a;
+		m_state[1] += b;
+		m_state[2] += c;
+		m_state[3] += d;
+		m_state[4] += e;
+	}
+
+	/**
+	 * @brief 将摘要格式化为 40 位小写十六进制字符串
+	 * @param digest 摘要
+	 * @return 十六进制字符串
+	 */
+	std::string Sha1::ToHex(const Digest &digest) {
+		static constexpr char Hex[] = "0123456789abcdef";
+		std::string result(digest.size() * 2, '\0');
+		for (size_t i = 0; i < digest.size(); i++) {
+			result[i * 2] = Hex[digest[i] >> 4];
+			result[i * 2 + 1] = Hex[digest[i] & 0xF];
+		}
+		return result;
+	}
+
+	/**
+	 * @brief 比较摘要与十六进制校验值（不区分大小写）
+	 * @param digest 摘要
+	 * @param hex 十六进制校验值
+	 * @return 一致时返回 true
+	 */
+	bool Sha1::Matches(const Digest &digest, std::string_view hex) noexcept {
+		if (hex.size() != digest.size() * 2) return false;
+		auto nibble = [](char c) -> int {
+			if (c >= '0' && c <= '9') return c - '0';
+			if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+			if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+			return -1;
+		};
+		for (size_t i = 0; i < digest.size(); i++) {
+			int high = nibble(hex[i * 2]), low = nibble(hex[i * 2 + 1]);
+			if (high < 0 || low < 0 || ((high << 4) | low) != digest[i]) return false;
+		}
+		return true;
+	}
+}
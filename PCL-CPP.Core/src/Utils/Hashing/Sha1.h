@@ -0,0 +1,86 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace PCL_CPP::Core::Utils {
+	/**
+	 * @brief SHA-1 摘要计算器
+	 *
+	 * @details
+	 * 用于与版本配置、资源索引中声明的 SHA-1 校验值比对。支持增量输入，
+	 * 可直接对内存映射的文件内容调用 `Update`，不需要额外的读取缓冲区。
+	 */
+	class Sha1 {
+		public:
+		using Digest = std::array<uint8_t, 20>; ///< 20 字节摘要
+
+		Sha1() { Reset(); }
+
+		/**
+		 * @brief 重置为初始状态
+		 */
+		void Reset() noexcept;
+
+		/**
+		 * @brief 追加输入数据
+		 * @param data 输入数据
+		 */
+		void Update(std::span<const std::byte> data) noexcept;
+
+		/**
+		 * @brief 追加输入数据
+		 * @param data 输入数据
+		 */
+		void Update(std::string_view data) noexcept {
+			Update(std::as_bytes(std::span(data.data(), data.size())));
+		}
+
+		/**
+		 * @brief 结束计算并返回摘要
+		 * @details 调用后对象回到初始状态，可继续计算下一段数据。
+		 * @return 摘要
+		 */
+		Digest Finish() noexcept;
+
+		/**
+		 * @brief 将摘要格式化为 40 位小写十六进制字符串
+		 * @param digest 摘要
+		 * @return 十六进制字符串
+		 */
+		static std::string ToHex(const Digest &digest);
+
+		/**
+		 * @brief 比较摘要与十六进制校验值（不区分大小写）
+		 * @param digest 摘要
+		 * @param hex 十六进制校验值
+		 * @return 一致时返回 true
+		 */
+		static bool Matches(const Digest &digest, std::string_view hex) noexcept;
+
+		/**
+		 * @brief 计算一段数据的十六进制摘要
+		 * @param data 输入数据
+		 * @return 十六进制字符串
+		 */
+		static std::string HashHex(std::string_view data) {
+			Sha1 sha;
+			sha.Update(data);
+			return ToHex(sha.Finish());
+		}
+
+		private:
+		/**
+		 * @brief 处理一个 64 字节分组
+		 */
+		void Transform(const uint8_t *block) noexcept;
+
+		std::array<uint32_t, 5> m_state {};
+		std::array<uint8_t, 64> m_buffer {};
+		size_t m_bufferSize = 0; ///< 缓冲区中尚未处理的字节数
+		uint64_t m_length = 0;   ///< 已输入的总字节数
+	};
+}
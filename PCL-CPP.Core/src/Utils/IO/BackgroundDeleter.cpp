@@ -0,0 +1,134 @@
+#include "pch.h"
+#include "App/Logging/AppLogger.h"
+#include "BackgroundDeleter.h"
+#include <vector>
+
+using namespace PCL_CPP::Core::Logging;
+
+namespace PCL_CPP::Core::Utils {
+
+	/**
+	 * @brief 析构函数，停止删除并等待工作线程退出
+	 */
+	BackgroundDeleter::~BackgroundDeleter() {
+		Shutdown();
+	}
+
+	/**
+	 * @brief 获取进程内共享的删除器
+	 * @return 全局删除器
+	 */
+	BackgroundDeleter &BackgroundDeleter::Global() {
+		// 故意不析构：静态析构阶段 join 工作线程可能与加载器锁死锁
+		static BackgroundDeleter *deleter = new BackgroundDeleter();
+		return *deleter;
+	}
+
+	/**
+	 * @brief 停止删除并等待工作线程退出
+	 */
+	void BackgroundDeleter::Shutdown() {
+		std::thread worker;
+		{
+			std::lock_guard lock(m_mutex);
+			m_stop = true;
+			m_queue.clear();
+			worker = std::move(m_worker);
+		}
+		if (worker.joinable()) worker.join();
+	}
+
+	/**
+	 * @brief 将文件或目录加入删除队列
+	 * @param path 要删除的路径
+	 */
+	void BackgroundDeleter::Enqueue(std::filesystem::path path) {
+		std::lock_guard lock(m_mutex);
+		if (m_stop) return;
+		m_queue.push_back(std::move(path));
+		if (m_running) return;
+
+		// 上一个工作线程已在队列清空后退出主循环，回收后启动新的线程
+		if (m_worker.joinable()) m_worker.join();
+		m_running = true;
+		m_worker = std::thread(&BackgroundDeleter::WorkerLoop, this);
+	}
+
+	/**
+	 * @brief 等待队列中的所有路径处理完毕
+	 * @param timeout 最长等待时间
+	 * @return 在超时前处理完毕时返回 true
+	 */
+	bool BackgroundDeleter::WaitIdle(std::chrono::milliseconds timeout) {
+		std::unique_lock lock(m_mutex);
+		return m_idle.wait_for(lock, timeout, [this] { return m_queue.empty() && !m_busy; });
+	}
+
+	uint64_t BackgroundDeleter::Deleted() const {
+		std::lock_guard lock(m_mutex);
+		return m_deleted;
+	}
+
+	/**
+	 * @brief 工作线程主循环
+	 */
+	void BackgroundDeleter::WorkerLoop() {
+		// 后台处理模式同时降低 CPU 与 I/O 优先级
+		SetThreadPriority(GetCurrentThread(), THREAD_MODE_BACKGROUND_BEGIN);
+
+		std::unique_lock lock(m_mutex);
+		while (!m_stop && !m_queue.empty()) {
+			auto path = std::move(m_queue.front());
+			m_queue.pop_front();
+			m_busy = true;
+			lock.unlock();
+
+			bool removed = Remove(path);
+
+			lock.lock();
+			m_busy = false;
+			if (removed) m_deleted++;
+		}
+
+		// 队列已清空或已停止：退出线程，之后的入队会启动新的线程
+		m_running = false;
+		m_idle.notify_all();
+	}
+
+	/**
+	 * @brief 删除单个路径
+	 * @param path 要删除的路径
+	 * @return 完整删除时返回 true
+	 */
+	bool BackgroundDeleter::Remove(const std::filesystem::path &path) {
+		std::error_code ec;
+		auto status = std::filesystem::symlink_status(path, ec);
+		if (status.type() == std::filesystem::file_type::not_found) return true;
+		if (ec) return false;
+
+		if (status.type() == std::filesystem::file_type::directory) {
+			// 先列出再逐项删除，每项之间检查停止标志
+			std::vector<std::filesystem::path> children;
+			for (const auto &entry : std::filesystem::directory_iterator(path, ec)) children.push_back(entry.path());
+
+			bool complete = !ec;
+			for (const auto &child : children) {
+				if (m_stop) return false;
+				std::error_code childError;
+				std::filesystem::remove_all(child, childError);
+				if (childError) {
+					LOG_DEBUG("Failed to delete {}: {}", child.string(), childError.message());
+					complete = false;
+				}
+			}
+			if (!complete) return false;
+		}
+
+		std::filesystem::remove(path, ec);
+		if (ec) {
+			LOG_DEBUG("Failed to delete {}: {}", path.string(), ec.message());
+			return false;
+		}
+		return true;
+	}
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+
+namespace PCL_CPP::Core::Utils {
+	/**
+	 * @brief 后台目录删除器
+	 *
+	 * @details
+	 * 在单个低优先级后台线程上删除文件与目录，调用方只需承担入队的开销：
+	 * 1. **低优先级**：工作线程进入后台处理模式（`THREAD_MODE_BACKGROUND_BEGIN`），同时降低 CPU 与磁盘 I/O 优先级，不与启动流程争抢资源。
+	 * 2. **按需启动**：入队时才创建工作线程，队列清空后线程即退出，空闲时不保留任何线程。
+	 * 3. **可中断**：`Shutdown`（以及析构）停止删除并等待线程退出，逐项删除之间检查停止标志，不会被大目录阻塞；
+	 *    未删除完的目录由调用方在下次运行时重新入队。
+	 * 4. **不在静态析构中等待**：`Global` 返回的删除器永不析构。静态析构阶段等待线程可能与加载器锁死锁，
+	 *    需要在退出前停止删除的程序应在主动退出流程中调用 `Shutdown`；否则进程退出时由系统终止仍在删除的线程。
+	 *
+	 * 删除失败（例如文件仍被其他进程占用）只记录日志，不重试。
+	 */
+	class BackgroundDeleter {
+		public:
+		BackgroundDeleter() = default;
+		~BackgroundDeleter();
+
+		BackgroundDeleter(const BackgroundDeleter &) = delete;
+		BackgroundDeleter &operator=(const BackgroundDeleter &) = delete;
+
+		/**
+		 * @brief 获取进程内共享的删除器
+		 * @return 全局删除器
+		 */
+		static BackgroundDeleter &Global();
+
+		/**
+		 * @brief 将文件或目录加入删除队列
+		 * @param path 要删除的路径
+		 */
+		void Enqueue(std::filesystem::path path);
+
+		/**
+		 * @brief 停止删除并等待工作线程退出
+		 * @details 队列中尚未处理的路径被丢弃，之后的 `Enqueue` 不再生效。可重复调用。
+		 */
+		void Shutdown();
+
+		/**
+		 * @brief 等待队列中的所有路径处理完毕
+		 * @param timeout 最长等待时间
+		 * @return 在超时前处理完毕时返回 true
+		 */
+		bool WaitIdle(std::chrono::milliseconds timeout);
+
+		uint64_t Deleted() const; ///< 已完整删除的路径数量
+
+		private:
+		/**
+		 * @brief 工作线程主循环
+		 */
+		void WorkerLoop();
+
+		/**
+		 * @brief 删除单个路径
+		 * @param path 要删除的路径
+		 * @return 完整删除时返回 true
+		 */
+		bool Remove(const std::filesystem::path &path);
+
+		mutable std::mutex m_mutex;
+		std::condition_variable m_idle;   ///< 队列已处理完毕
+		std::deque<std::filesystem::path> m_queue;
+		std::thread m_worker;
+		bool m_running = false;           ///< 工作线程尚未退出主循环
+		bool m_busy = false;              ///< 工作线程正在删除某个路径
+		std::atomic<bool> m_stop = false;
+		uint64_t m_deleted = 0;
+	};
+}
@@ -0,0 +1,51 @@
+#include "pch.h"
+#include "App/Logging/AppLogger.h"
+#include "BinaryIO.h"
+#include <atomic>
+#include <fstream>
+
+using namespace PCL_CPP::Core::Logging;
+
+namespace PCL_CPP::Core::Utils {
+
+	/**
+	 * @brief 将缓冲区原子地保存到文件
+	 * @param path 目标文件路径
+	 * @return 是否保存成功
+	 */
+	bool BinaryWriter::SaveAtomically(const std::filesystem::path &path) const {
+		static std::atomic<uint32_t> counter = 0;
+
+		std::error_code ec;
+		if (path.has_parent_path()) {
+			std::filesystem::create_directories(path.parent_path(), ec);
+		}
+
+		// 临时文件名带上进程内计数器，避免多个线程同时保存时互相覆盖
+		std::filesystem::path tempPath = path;
+		tempPath += ".tmp" + std::to_string(GetCurrentProcessId()) + "-" + std::to_string(counter.fetch_add(1));
+
+		{
+			std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+			if (!file.is_open()) {
+				LOG_WARNING("Failed to open temp file for writing: {}", tempPath.string());
+				return false;
+			}
+			file.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+			if (!file) {
+				LOG_WARNING("Failed to write temp file: {}", tempPath.string());
+				file.close();
+				std::filesystem::remove(tempPath, ec);
+				return false;
+			}
+		}
+
+		std::filesystem::rename(tempPath, path, ec);
+		if (ec) {
+			LOG_WARNING("Failed to replace {}: {}", path.string(), ec.message());
+			std::filesystem::remove(tempPath, ec);
+			return false;
+		}
+		return true;
+	}
+}
@@ -0,0 +1,124 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace PCL_CPP::Core::Utils {
+	/**
+	 * @brief 二进制写入器
+	 * 
+	 * @details 
+	 * 将数据按本机字节序追加到内存缓冲区，用于生成各类缓存索引文件。
+	 * 字符串以 `uint32` 长度前缀 + 原始字节的形式写入。
+	 */
+	class BinaryWriter {
+		public:
+		/**
+		 * @brief 写入一个平凡类型的值
+		 * @tparam T 值类型（整数、枚举等）
+		 * @param value 要写入的值
+		 */
+		template <typename T>
+		void Write(T value) {
+			static_assert(std::is_trivially_copyable_v<T>);
+			m_buffer.append(reinterpret_cast<const char *>(&value), sizeof(T));
+		}
+
+		/**
+		 * @brief 写入带长度前缀的字符串
+		 * @param str 字符串内容
+		 */
+		void WriteString(std::string_view str) {
+			Write<uint32_t>(static_cast<uint32_t>(str.size()));
+			m_buffer.append(str);
+		}
+
+		/**
+		 * @brief 获取已写入的全部数据
+		 * @return 缓冲区内容
+		 */
+		const std::string &GetBuffer() const { return m_buffer; }
+
+		/**
+		 * @brief 将缓冲区原子地保存到文件
+		 * @details 
+		 * 先写入同目录下的临时文件，再重命名覆盖目标文件。
+		 * 读者因此只会看到完整的旧文件或完整的新文件，不会读到写了一半的内容。
+		 * @param path 目标文件路径
+		 * @return 是否保存成功
+		 */
+		bool SaveAtomically(const std::filesystem::path &path) const;
+
+		private:
+		std::string m_buffer; ///< 数据缓冲区
+	};
+
+	/**
+	 * @brief 二进制读取器
+	 * 
+	 * @details 
+	 * 与 `BinaryWriter` 对应的读取端。任何越界读取都会使读取器进入失败状态，
+	 * 之后的读取均返回默认值，调用方只需在最后检查一次 `IsOk()`。
+	 */
+	class BinaryReader {
+		public:
+		/**
+		 * @brief 构造函数
+		 * @param data 要读取的数据（读取器不持有数据，调用方需保证其生命周期）
+		 */
+		explicit BinaryReader(std::string_view data) : m_data(data) { }
+
+		/**
+		 * @brief 读取一个平凡类型的值
+		 * @tparam T 值类型
+		 * @return 读取到的值，失败时返回默认值
+		 */
+		template <typename T>
+		T Read() {
+			static_assert(std::is_trivially_copyable_v<T>);
+			T value {};
+			if (!m_ok || m_data.size() - m_pos < sizeof(T)) {
+				m_ok = false;
+				return value;
+			}
+			std::memcpy(&value, m_data.data() + m_pos, sizeof(T));
+			m_pos += sizeof(T);
+			return value;
+		}
+
+		/**
+		 * @brief 读取带长度前缀的字符串
+		 * @return 读取到的字符串，失败时返回空字符串
+		 */
+		std::string ReadString() {
+			uint32_t length = Read<uint32_t>();
+			if (!m_ok || m_data.size() - m_pos < length) {
+				m_ok = false;
+				return {};
+			}
+			std::string str(m_data.substr(m_pos, length));
+			m_pos += length;
+			return str;
+		}
+
+		/**
+		 * @brief 检查到目前为止的读取是否全部成功
+		 * @return 未发生越界时返回 true
+		 */
+		bool IsOk() const { return m_ok; }
+
+		/**
+		 * @brief 检查是否已读取到数据末尾
+		 * @return 没有剩余数据时返回 true
+		 */
+		bool IsEnd() const { return m_pos >= m_data.size(); }
+
+		private:
+		std::string_view m_data; ///< 数据视图
+		size_t m_pos = 0;        ///< 当前读取位置
+		bool m_ok = true;        ///< 读取状态
+	};
+}
@@ -0,0 +1,43 @@
+#include "pch.h"
+#include "FileStamp.h"
+
+namespace PCL_CPP::Core::Utils {
+
+	/**
+	 * @brief 读取指定文件的状态签名
+	 * @param path 文件路径
+	 * @return 文件存在且为普通文件时返回签名，否则返回 std::nullopt
+	 */
+	std::optional<FileStamp> FileStamp::Read(const std::filesystem::path &path) noexcept {
+		// 快速路径：一次系统调用同时取得属性、大小与修改时间
+		// FILETIME 与 MSVC 的 file_time_type 同为 1601 年起的 100ns 计数，与下方回退路径的结果一致
+		WIN32_FILE_ATTRIBUTE_DATA data;
+		if (GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &data)) {
+			if (!(data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)) {
+				if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) return std::nullopt;
+
+				FileStamp stamp;
+				stamp.Size = (static_cast<uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+				stamp.ModifiedTime = static_cast<int64_t>((static_cast<uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime);
+				return stamp;
+			}
+		} else if (DWORD error = GetLastError(); error == ERROR_FILE_NOT_FOUND || error == ERROR_PATH_NOT_FOUND) {
+			return std::nullopt;
+		}
+
+		// 符号链接等重解析点需要跟随到目标文件
+		std::error_code ec;
+		auto status = std::filesystem::status(path, ec);
+		if (ec || !std::filesystem::is_regular_file(status)) return std::nullopt;
+
+		FileStamp stamp;
+		stamp.Size = std::filesystem::file_size(path, ec);
+		if (ec) return std::nullopt;
+
+		auto time = std::filesystem::last_write_time(path, ec);
+		if (ec) return std::nullopt;
+		stamp.ModifiedTime = static_cast<int64_t>(time.time_since_epoch().count());
+
+		return stamp;
+	}
+}
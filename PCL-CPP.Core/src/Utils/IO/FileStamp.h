@@ -0,0 +1,27 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+
+namespace PCL_CPP::Core::Utils {
+	/**
+	 * @brief 文件状态签名（大小 + 修改时间）
+	 * 
+	 * @details 
+	 * 用于在不读取文件内容的前提下判断文件是否发生变化。
+	 * 获取签名只需要一次 stat 调用，适合在缓存命中检查中频繁使用。
+	 */
+	struct FileStamp {
+		uint64_t Size = 0;          ///< 文件大小（字节）
+		int64_t ModifiedTime = 0;   ///< 最后修改时间（file_time_type 的原始计数）
+
+		/**
+		 * @brief 读取指定文件的状态签名
+		 * @param path 文件路径
+		 * @return 文件存在且为普通文件时返回签名，否则返回 std::nullopt
+		 */
+		static std::optional<FileStamp> Read(const std::filesystem::path &path) noexcept;
+
+		bool operator==(const FileStamp &) const = default;
+	};
+}
@@ -0,0 +1,114 @@
+#include "pch.h"
+#include "App/Logging/AppLogger.h"
+#include "MappedFile.h"
+
+using namespace PCL_CPP::Core::Logging;
+
+namespace PCL_CPP::Core::Utils {
+
+	/**
+	 * @brief 析构函数，解除映射
+	 */
+	MappedFile::~MappedFile() {
+		Close();
+	}
+
+	/**
+	 * @brief 移动构造函数
+	 * @param other 被移动的对象
+	 */
+	MappedFile::MappedFile(MappedFile &&other) noexcept
+		: m_data(other.m_data), m_size(other.m_size), m_isOpen(other.m_isOpen) {
+		other.m_data = nullptr;
+		other.m_size = 0;
+		other.m_isOpen = false;
+	}
+
+	/**
+	 * @brief 移动赋值运算符
+	 * @param other 被移动的对象
+	 * @return 当前对象引用
+	 */
+	MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+		if (this != &other) {
+			Close();
+			m_data = other.m_data;
+			m_size = other.m_size;
+			m_isOpen = other.m_isOpen;
+			other.m_data = nullptr;
+			other.m_size = 0;
+			other.m_isOpen = false;
+		}
+		return *this;
+	}
+
+	/**
+	 * @brief 以只读方式映射文件
+	 * @param path 文件路径
+	 * @return 是否映射成功
+	 */
+	bool MappedFile::Open(const std::filesystem::path &path) {
+		Close();
+
+		HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+								  NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+		if (file == INVALID_HANDLE_VALUE) {
+			LOG_DEBUG("CreateFile failed for {} ({})", path.string(), GetLastError());
+			return false;
+		}
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize)) {
+			CloseHandle(file);
+			return false;
+		}
+
+		// 空文件无法创建映射，直接视为成功打开的空视图
+		if (fileSize.QuadPart == 0) {
+			CloseHandle(file);
+			m_isOpen = true;
+			return true;
+		}
+
+		if (static_cast<unsigned long long>(fileSize.QuadPart) > static_cast<unsigned long long>(SIZE_MAX)) {
+			LOG_WARNING("File too large to map: {}", path.string());
+			CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (mapping == NULL) {
+			LOG_DEBUG("CreateFileMapping failed for {} ({})", path.string(), GetLastError());
+			CloseHandle(file);
+			return false;
+		}
+
+		void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+		// 视图会持有映射对象的引用，句柄可以立即关闭
+		CloseHandle(mapping);
+		CloseHandle(file);
+
+		if (view == nullptr) {
+			LOG_DEBUG("MapViewOfFile failed for {} ({})", path.string(), GetLastError());
+			return false;
+		}
+
+		m_data = static_cast<const std::byte *>(view);
+		m_size = static_cast<size_t>(fileSize.QuadPart);
+		m_isOpen = true;
+		return true;
+	}
+
+	/**
+	 * @brief 解除映射
+	 */
+	void MappedFile::Close() noexcept {
+		if (m_data != nullptr) {
+			UnmapViewOfFile(m_data);
+		}
+		m_data = nullptr;
+		m_size = 0;
+		m_isOpen = false;
+	}
+}
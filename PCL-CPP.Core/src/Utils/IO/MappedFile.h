@@ -0,0 +1,77 @@
+#pragma once
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string_view>
+
+namespace PCL_CPP::Core::Utils {
+	/**
+	 * @brief 只读内存映射文件
+	 * 
+	 * @details 
+	 * 通过 `CreateFileMappingW` / `MapViewOfFile` 将整个文件映射到进程地址空间：
+	 * 1. **零拷贝**：文件内容直接以连续内存的形式提供给解析器，无需经过流缓冲区。
+	 * 2. **按需分页**：只有实际访问到的页面才会由系统从磁盘读入。
+	 * 3. **RAII**：对象析构时自动解除映射；对象只能移动，不能复制。
+	 * 
+	 * 空文件无法被映射，此时 `Open` 仍返回 true，但 `Size()` 为 0。
+	 */
+	class MappedFile {
+		public:
+		MappedFile() = default;
+		~MappedFile();
+
+		MappedFile(const MappedFile &) = delete;
+		MappedFile &operator=(const MappedFile &) = delete;
+		MappedFile(MappedFile &&other) noexcept;
+		MappedFile &operator=(MappedFile &&other) noexcept;
+
+		/**
+		 * @brief 以只读方式映射文件
+		 * @details 映射期间文件仍允许被其他进程读取、写入或删除。
+		 * @param path 文件路径
+		 * @return 是否映射成功
+		 */
+		bool Open(const std::filesystem::path &path);
+
+		/**
+		 * @brief 解除映射
+		 */
+		void Close() noexcept;
+
+		/**
+		 * @brief 检查是否已成功打开
+		 * @return 已打开时返回 true
+		 */
+		bool IsOpen() const { return m_isOpen; }
+
+		/**
+		 * @brief 获取映射的数据指针
+		 * @return 数据指针，空文件时为 nullptr
+		 */
+		const std::byte *Data() const { return m_data; }
+
+		/**
+		 * @brief 获取文件大小
+		 * @return 文件大小（字节）
+		 */
+		size_t Size() const { return m_size; }
+
+		/**
+		 * @brief 以字节序列的形式访问文件内容
+		 * @return 字节视图
+		 */
+		std::span<const std::byte> Bytes() const { return {m_data, m_size}; }
+
+		/**
+		 * @brief 以字符序列的形式访问文件内容
+		 * @return 字符串视图
+		 */
+		std::string_view View() const { return {reinterpret_cast<const char *>(m_data), m_size}; }
+
+		private:
+		const std::byte *m_data = nullptr; ///< 映射视图的起始地址
+		size_t m_size = 0;                 ///< 文件大小
+		bool m_isOpen = false;             ///< 是否已打开
+	};
+}
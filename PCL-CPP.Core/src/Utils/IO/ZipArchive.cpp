@@ -0,0 +1,316 @@
+#include "pch.h"
+#include "App/Logging/AppLogger.h"
+#include "ZipArchive.h"
+#include <cstring>
+
+// miniz 优化预处理指令：只使用 Inflate 与 CRC-32，压缩包结构由 ZipArchive 自行解析
+#define MINIZ_NO_TIME
+#define MINIZ_NO_ZLIB_APIS
+#define MINIZ_NO_ARCHIVE_APIS
+
+#include <miniz/miniz.h>
+
+using namespace PCL_CPP::Core::Logging;
+
+namespace PCL_CPP::Core::Utils {
+
+	static constexpr uint32_t LocalHeaderSignature = 0x04034b50;   ///< 本地文件头签名
+	static constexpr uint32_t CentralHeaderSignature = 0x02014b50; ///< 中央目录文件头签名
+	static constexpr uint32_t EndOfDirectorySignature = 0x06054b50; ///< 中央目录结束记录签名
+
+	static constexpr size_t LocalHeaderSize = 30;     ///< 本地文件头的固定部分长度
+	static constexpr size_t CentralHeaderSize = 46;   ///< 中央目录文件头的固定部分长度
+	static constexpr size_t EndOfDirectorySize = 22;  ///< 中央目录结束记录的固定部分长度
+	static constexpr size_t MaxCommentSize = 0xFFFF;  ///< 压缩包注释的最大长度
+
+	/**
+	 * @brief 读取小端 16 位整数
+	 */
+	static uint16_t ReadU16(const std::byte *p) {
+		uint16_t value;
+		std::memcpy(&value, p, sizeof(value));
+		return value;
+	}
+
+	/**
+	 * @brief 读取小端 32 位整数
+	 */
+	static uint32_t ReadU32(const std::byte *p) {
+		uint32_t value;
+		std::memcpy(&value, p, sizeof(value));
+		return value;
+	}
+
+	/**
+	 * @brief 构造函数
+	 * @param capacity 最大条目数
+	 */
+	ZipDirectoryCache::ZipDirectoryCache(size_t capacity)
+		: m_capacity(capacity) { }
+
+	/**
+	 * @brief 生成缓存键
+	 * @param path 压缩包路径
+	 * @return 缓存键
+	 */
+	std::string ZipDirectoryCache::MakeKey(const std::filesystem::path &path) {
+		return path.lexically_normal().generic_string();
+	}
+
+	/**
+	 * @brief 查找缓存的条目表
+	 * @param path 压缩包路径
+	 * @param stamp 压缩包当前的状态签名
+	 * @return 签名一致时返回条目表，否则返回 nullptr
+	 */
+	std::shared_ptr<const std::vector<ZipEntry>> ZipDirectoryCache::Find(const std::filesystem::path &path, const FileStamp &stamp) {
+		std::lock_guard lock(m_mutex);
+
+		auto it = m_lookup.find(MakeKey(path));
+		if (it == m_lookup.end()) {
+			m_misses++;
+			return nullptr;
+		}
+
+		// 压缩包被替换后签名随之变化，旧的条目表不再可用
+		auto entry = it->second;
+		if (entry->Stamp != stamp) {
+			m_lookup.erase(it);
+			m_entries.erase(entry);
+			m_misses++;
+			return nullptr;
+		}
+
+		m_entries.splice(m_entries.begin(), m_entries, entry);
+		m_hits++;
+		return entry->Entries;
+	}
+
+	/**
+	 * @brief 写入条目表
+	 * @param path 压缩包路径
+	 * @param stamp 解析时的状态签名
+	 * @param entries 条目表
+	 */
+	void ZipDirectoryCache::Put(const std::filesystem::path &path, const FileStamp &stamp, std::shared_ptr<const std::vector<ZipEntry>> entries) {
+		std::lock_guard lock(m_mutex);
+		if (m_capacity == 0) return;
+
+		std::string key = MakeKey(path);
+		auto it = m_lookup.find(key);
+		if (it != m_lookup.end()) {
+			m_entries.erase(it->second);
+			m_lookup.erase(it);
+		}
+
+		m_entries.push_front({ key, stamp, std::move(entries) });
+		m_lookup.emplace(std::move(key), m_entries.begin());
+		while (m_entries.size() > m_capacity) {
+			m_lookup.erase(m_entries.back().Key);
+			m_entries.pop_back();
+		}
+	}
+
+	/**
+	 * @brief 清空缓存并重置统计
+	 */
+	void ZipDirectoryCache::Clear() {
+		std::lock_guard lock(m_mutex);
+		m_entries.clear();
+		m_lookup.clear();
+		m_hits = 0;
+		m_misses = 0;
+	}
+
+	size_t ZipDirectoryCache::Size() const {
+		std::lock_guard lock(m_mutex);
+		return m_entries.size();
+	}
+
+	uint64_t ZipDirectoryCache::Hits() const {
+		std::lock_guard lock(m_mutex);
+		return m_hits;
+	}
+
+	uint64_t ZipDirectoryCache::Misses() const {
+		std::lock_guard lock(m_mutex);
+		return m_misses;
+	}
+
+	/**
+	 * @brief 打开压缩包
+	 * @param path 压缩包路径
+	 * @return 是否成功打开并解析中央目录
+	 */
+	bool ZipArchive::Open(const std::filesystem::path &path) {
+		Close();
+
+		auto stamp = FileStamp::Read(path);
+		if (!stamp || !m_file.Open(path)) return false;
+		m_path = path;
+
+		// 签名读取之后文件仍可能被替换，映射大小与签名一致时才使用缓存
+		bool cacheable = m_file.Size() == stamp->Size;
+		if (cacheable) m_entries = Cache().Find(path, *stamp);
+		if (!m_entries) {
+			m_entries = ParseDirectory();
+			if (!m_entries) {
+				LOG_ERROR("Failed to read zip directory: {}", path.string());
+				Close();
+				return false;
+			}
+			if (cacheable) Cache().Put(path, *stamp, m_entries);
+		}
+		return true;
+	}
+
+	/**
+	 * @brief 关闭压缩包
+	 */
+	void ZipArchive::Close() noexcept {
+		m_entries.reset();
+		m_file.Close();
+		m_path.clear();
+	}
+
+	/**
+	 * @brief 获取条目的文件名
+	 * @param entry 条目
+	 * @return 指向映射区域的文件名视图
+	 */
+	std::string_view ZipArchive::GetName(const ZipEntry &entry) const {
+		return m_file.View().substr(entry.NameOffset, entry.NameLength);
+	}
+
+	/**
+	 * @brief 按文件名查找条目
+	 * @param name 完整文件名（含目录）
+	 * @return 找到时返回条目，否则返回 nullptr
+	 */
+	const ZipEntry *ZipArchive::Find(std::string_view name) const {
+		for (const auto &entry : GetEntries()) {
+			if (entry.NameLength == name.size() && GetName(entry) == name) return &entry;
+		}
+		return nullptr;
+	}
+
+	/**
+	 * @brief 获取条目在压缩包中的原始（未解压）数据
+	 * @param entry 条目
+	 * @return 原始数据视图，本地文件头损坏时返回 std::nullopt
+	 */
+	std::optional<std::span<const std::byte>> ZipArchive::GetRawData(const ZipEntry &entry) const {
+		auto data = m_file.Bytes();
+		uint64_t offset = entry.LocalHeaderOffset;
+		if (offset + LocalHeaderSize > data.size() || ReadU32(data.data() + offset) != LocalHeaderSignature) return std::nullopt;
+
+		// 本地文件头中的扩展字段长度可能与中央目录不同，以本地文件头为准
+		uint64_t start = offset + LocalHeaderSize + ReadU16(data.data() + offset + 26) + ReadU16(data.data() + offset + 28);
+		if (start + entry.CompressedSize > data.size()) return std::nullopt;
+		return data.subspan(static_cast<size_t>(start), static_cast<size_t>(entry.CompressedSize));
+	}
+
+	/**
+	 * @brief 读取条目内容
+	 * @param entry 条目
+	 * @param buffer 解压缓冲区，按需增长，可在多次调用之间复用
+	 * @return 条目内容，数据损坏或压缩方式不受支持时返回 std::nullopt
+	 */
+	std::optional<std::span<const std::byte>> ZipArchive::Read(const ZipEntry &entry, std::vector<std::byte> &buffer) const {
+		// 不支持加密条目
+		if (entry.Flags & 0x1) return std::nullopt;
+
+		auto raw = GetRawData(entry);
+		if (!raw) return std::nullopt;
+
+		std::span<const std::byte> content;
+		if (entry.Method == ZipEntry::MethodStored) {
+			if (raw->size() != entry.UncompressedSize) return std::nullopt;
+			content = *raw;
+		} else if (entry.Method == ZipEntry::MethodDeflated) {
+			size_t size = static_cast<size_t>(entry.UncompressedSize);
+			if (size != 0) {
+				if (buffer.size() < size) buffer.resize(size);
+				size_t written = tinfl_decompress_mem_to_mem(buffer.data(), size, raw->data(), raw->size(), 0);
+				if (written != size) return std::nullopt;
+				content = { buffer.data(), size };
+			}
+		} else {
+			return std::nullopt;
+		}
+
+		if (mz_crc32(MZ_CRC32_INIT, reinterpret_cast<const unsigned char *>(content.data()), content.size()) != entry.Crc32) return std::nullopt;
+		return content;
+	}
+
+	/**
+	 * @brief 获取 `Open` 使用的进程内目录缓存
+	 * @return 全局目录缓存
+	 */
+	ZipDirectoryCache &ZipArchive::Cache() {
+		static ZipDirectoryCache cache;
+		return cache;
+	}
+
+	/**
+	 * @brief 解析中央目录
+	 * @return 条目表，格式错误时返回 nullptr
+	 */
+	std::shared_ptr<const std::vector<ZipEntry>> ZipArchive::ParseDirectory() const {
+		auto data = m_file.Bytes();
+		if (data.size() < EndOfDirectorySize) return nullptr;
+
+		// 中央目录结束记录位于文件末尾，其后最多跟随 64 KiB 的注释，从后向前查找签名
+		size_t lowest = data.size() > EndOfDirectorySize + MaxCommentSize ? data.size() - EndOfDirectorySize - MaxCommentSize : 0;
+		std::optional<size_t> eocd;
+		for (size_t pos = data.size() - EndOfDirectorySize + 1; pos-- > lowest;) {
+			if (ReadU32(data.data() + pos) == EndOfDirectorySignature) {
+				eocd = pos;
+				break;
+			}
+		}
+		if (!eocd) return nullptr;
+
+		const std::byte *record = data.data() + *eocd;
+		uint16_t disk = ReadU16(record + 4);
+		uint16_t directoryDisk = ReadU16(record + 6);
+		uint16_t count = ReadU16(record + 10);
+		uint32_t directorySize = ReadU32(record + 12);
+		uint32_t directoryOffset = ReadU32(record + 16);
+		if (disk != 0 || directoryDisk != 0) {
+			LOG_DEBUG("Multi-disk zip is not supported: {}", m_path.string());
+			return nullptr;
+		}
+		if (count == 0xFFFF || directorySize == 0xFFFFFFFF || directoryOffset == 0xFFFFFFFF) {
+			LOG_DEBUG("ZIP64 archive is not supported: {}", m_path.string());
+			return nullptr;
+		}
+		if (static_cast<uint64_t>(directoryOffset) + directorySize > *eocd) return nullptr;
+
+		auto entries = std::make_shared<std::vector<ZipEntry>>();
+		entries->reserve(count);
+		size_t pos = directoryOffset;
+		size_t end = static_cast<size_t>(directoryOffset) + directorySize;
+		for (uint16_t i = 0; i < count; i++) {
+			if (pos + CentralHeaderSize > end) return nullptr;
+			const std::byte *header = data.data() + pos;
+			if (ReadU32(header) != CentralHeaderSignature) return nullptr;
+
+			ZipEntry entry;
+			entry.Flags = ReadU16(header + 8);
+			entry.Method = ReadU16(header + 10);
+			entry.Crc32 = ReadU32(header + 16);
+			entry.CompressedSize = ReadU32(header + 20);
+			entry.UncompressedSize = ReadU32(header + 24);
+			entry.NameLength = ReadU16(header + 28);
+			entry.LocalHeaderOffset = ReadU32(header + 42);
+			entry.NameOffset = pos + CentralHeaderSize;
+
+			size_t next = pos + CentralHeaderSize + entry.NameLength + ReadU16(header + 30) + ReadU16(header + 32);
+			if (next > end) return nullptr;
+			entries->push_back(entry);
+			pos = next;
+		}
+		return entries;
+	}
+}
@@ -0,0 +1,184 @@
+#pragma once
+#include "MappedFile.h"
+#include "FileStamp.h"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace PCL_CPP::Core::Utils {
+	/**
+	 * @brief 中央目录中的一个条目
+	 * @details 只记录偏移与长度，不持有任何数据；文件名通过 `ZipArchive::GetName` 以视图的形式访问。
+	 */
+	struct ZipEntry {
+		uint64_t NameOffset = 0;        ///< 文件名在压缩包中的偏移
+		uint16_t NameLength = 0;        ///< 文件名长度
+		uint16_t Flags = 0;             ///< 通用标志位
+		uint16_t Method = 0;            ///< 压缩方式（0 为存储，8 为 Deflate）
+		uint32_t Crc32 = 0;             ///< 解压后数据的 CRC-32
+		uint64_t CompressedSize = 0;    ///< 压缩后大小
+		uint64_t UncompressedSize = 0;  ///< 解压后大小
+		uint64_t LocalHeaderOffset = 0; ///< 本地文件头的偏移
+
+		static constexpr uint16_t MethodStored = 0;   ///< 存储（未压缩）
+		static constexpr uint16_t MethodDeflated = 8; ///< Deflate 压缩
+	};
+
+	/**
+	 * @brief 已解析的中央目录的有界 LRU 缓存
+	 *
+	 * @details
+	 * 以（规范化路径, 状态签名）为键缓存中央目录的解析结果。同一个 Jar 被反复打开时，
+	 * 签名未变化即可直接复用条目表，跳过中央目录的查找与解析。所有方法均可并发调用。
+	 */
+	class ZipDirectoryCache {
+		public:
+		static constexpr size_t DefaultCapacity = 256; ///< 默认容量
+
+		/**
+		 * @brief 构造函数
+		 * @param capacity 最大条目数
+		 */
+		explicit ZipDirectoryCache(size_t capacity = DefaultCapacity);
+
+		/**
+		 * @brief 查找缓存的条目表
+		 * @param path 压缩包路径
+		 * @param stamp 压缩包当前的状态签名
+		 * @return 签名一致时返回条目表，否则返回 nullptr
+		 */
+		std::shared_ptr<const std::vector<ZipEntry>> Find(const std::filesystem::path &path, const FileStamp &stamp);
+
+		/**
+		 * @brief 写入条目表
+		 * @param path 压缩包路径
+		 * @param stamp 解析时的状态签名
+		 * @param entries 条目表
+		 */
+		void Put(const std::filesystem::path &path, const FileStamp &stamp, std::shared_ptr<const std::vector<ZipEntry>> entries);
+
+		/**
+		 * @brief 清空缓存并重置统计
+		 */
+		void Clear();
+
+		size_t Size() const;      ///< 当前条目数
+		uint64_t Hits() const;    ///< 命中次数
+		uint64_t Misses() const;  ///< 未命中次数（包括签名不一致）
+
+		private:
+		struct Entry {
+			std::string Key;
+			FileStamp Stamp;
+			std::shared_ptr<const std::vector<ZipEntry>> Entries;
+		};
+
+		static std::string MakeKey(const std::filesystem::path &path);
+
+		mutable std::mutex m_mutex;
+		size_t m_capacity;
+		std::list<Entry> m_entries; ///< 按最近使用排序，表头为最近使用
+		std::unordered_map<std::string, std::list<Entry>::iterator> m_lookup;
+		uint64_t m_hits = 0;
+		uint64_t m_misses = 0;
+	};
+
+	/**
+	 * @brief 基于内存映射的只读 Zip 读取器
+	 *
+	 * @details
+	 * 1. **零拷贝**：整个压缩包通过 `MappedFile` 映射，文件名以指向映射区域的 `std::string_view` 提供，
+	 *    存储方式的条目直接以 `std::span` 返回映射区域中的数据。
+	 * 2. **按需解压**：Deflate 条目只在 `Read` 时解压到调用方提供的缓冲区，并校验 CRC-32。
+	 * 3. **目录缓存**：中央目录的解析结果写入 `Cache()`，再次打开未变化的压缩包时跳过解析。
+	 *
+	 * 不支持 ZIP64、分卷与加密条目；Jar 与整合包中的压缩包均不会用到这些特性。
+	 */
+	class ZipArchive {
+		public:
+		/**
+		 * @brief 打开压缩包
+		 * @param path 压缩包路径
+		 * @return 是否成功打开并解析中央目录
+		 */
+		bool Open(const std::filesystem::path &path);
+
+		/**
+		 * @brief 关闭压缩包
+		 */
+		void Close() noexcept;
+
+		/**
+		 * @brief 检查是否已成功打开
+		 * @return 已打开时返回 true
+		 */
+		bool IsOpen() const { return m_file.IsOpen() && m_entries; }
+
+		/**
+		 * @brief 获取条目数量
+		 */
+		size_t GetEntryCount() const { return m_entries ? m_entries->size() : 0; }
+
+		/**
+		 * @brief 获取全部条目
+		 */
+		std::span<const ZipEntry> GetEntries() const { return m_entries ? std::span<const ZipEntry>(*m_entries) : std::span<const ZipEntry>(); }
+
+		/**
+		 * @brief 获取条目的文件名
+		 * @param entry 条目
+		 * @return 指向映射区域的文件名视图
+		 */
+		std::string_view GetName(const ZipEntry &entry) const;
+
+		/**
+		 * @brief 按文件名查找条目
+		 * @param name 完整文件名（含目录）
+		 * @return 找到时返回条目，否则返回 nullptr
+		 */
+		const ZipEntry *Find(std::string_view name) const;
+
+		/**
+		 * @brief 获取条目在压缩包中的原始（未解压）数据
+		 * @param entry 条目
+		 * @return 原始数据视图，本地文件头损坏时返回 std::nullopt
+		 */
+		std::optional<std::span<const std::byte>> GetRawData(const ZipEntry &entry) const;
+
+		/**
+		 * @brief 读取条目内容
+		 * @details 存储方式的条目直接返回映射区域的视图，不使用 `buffer`；Deflate 条目解压到 `buffer` 中。
+		 *          返回的视图在压缩包关闭或 `buffer` 被修改之前有效。
+		 * @param entry 条目
+		 * @param buffer 解压缓冲区，按需增长，可在多次调用之间复用
+		 * @return 条目内容，数据损坏或压缩方式不受支持时返回 std::nullopt
+		 */
+		std::optional<std::span<const std::byte>> Read(const ZipEntry &entry, std::vector<std::byte> &buffer) const;
+
+		/**
+		 * @brief 获取 `Open` 使用的进程内目录缓存
+		 * @return 全局目录缓存
+		 */
+		static ZipDirectoryCache &Cache();
+
+		private:
+		/**
+		 * @brief 解析中央目录
+		 * @return 条目表，格式错误时返回 nullptr
+		 */
+		std::shared_ptr<const std::vector<ZipEntry>> ParseDirectory() const;
+
+		MappedFile m_file;
+		std::filesystem::path m_path;
+		std::shared_ptr<const std::vector<ZipEntry>> m_entries;
+	};
+}
@@ -0,0 +1,70 @@
+#include "pch.h"
+#include "App/Logging/AppLogger.h"
+#include "JsonLoader.h"
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+using namespace PCL_CPP::Core::Logging;
+
+namespace PCL_CPP::Core::Utils {
+
+	/**
+	 * @brief 加载并解析 JSON 文件
+	 * @param path 文件路径
+	 * @param contentHash 可选，非空时写入文件内容的哈希
+	 * @return 解析后的 JSON 对象
+	 */
+	nlohmann::json JsonLoader::ParseFile(const std::filesystem::path &path, uint64_t *contentHash) {
+		MappedFile mapped;
+		if (mapped.Open(path)) {
+			if (contentHash) *contentHash = HashUtils::Fnv1a64(mapped.View());
+			return ParseBuffer(mapped.View());
+		}
+
+		// 映射失败，回退到读入内存后解析
+		LOG_DEBUG("Memory mapping unavailable for {}, falling back to stream.", path.string());
+		if (contentHash) {
+			std::string content = ReadAll(path);
+			*contentHash = HashUtils::Fnv1a64(content);
+			return ParseBuffer(content);
+		}
+		return ParseStream(path);
+	}
+
+	/**
+	 * @brief 将整个文件读入内存
+	 * @param path 文件路径
+	 * @return 文件内容
+	 */
+	std::string JsonLoader::ReadAll(const std::filesystem::path &path) {
+		std::ifstream file(path, std::ios::binary);
+		if (!file.is_open()) throw std::runtime_error("Cannot open file: " + path.string());
+		return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	}
+
+	/**
+	 * @brief 解析内存中的 JSON 文本
+	 * @param data JSON 文本
+	 * @return 解析后的 JSON 对象
+	 */
+	nlohmann::json JsonLoader::ParseBuffer(std::string_view data) {
+		// 使用指针区间构造输入适配器，解析器直接按字节遍历连续内存
+		const char *begin = data.data();
+		return nlohmann::json::parse(begin, begin + data.size());
+	}
+
+	/**
+	 * @brief 使用流式提取解析 JSON 文件
+	 * @param path 文件路径
+	 * @return 解析后的 JSON 对象
+	 */
+	nlohmann::json JsonLoader::ParseStream(const std::filesystem::path &path) {
+		std::ifstream file(path);
+		if (!file.is_open()) throw std::runtime_error("Cannot open file: " + path.string());
+
+		nlohmann::json j;
+		file >> j;
+		return j;
+	}
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include "Utils/Hashing/HashUtils.h"
+#include "Utils/IO/MappedFile.h"
+#include <cstdint>
+#include <filesystem>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <string_view>
+
+namespace PCL_CPP::Core::Utils {
+	/**
+	 * @brief JSON 文件加载器
+	 * 
+	 * @details 
+	 * Core 中读取 JSON 文件的统一入口：
+	 * 1. **快速路径**：通过 `MappedFile` 将文件映射为连续内存，再交给 nlohmann 的连续内存输入适配器解析。
+	 *    与 `std::ifstream >> json` 相比，省去了流对象逐字符提取（sentry、虚函数调用、缓冲区检查）的开销。
+	 * 2. **回退路径**：映射失败时（例如文件被独占打开或位于不支持映射的文件系统上）回退到流式解析。
+	 * 3. **内容哈希**：可在同一次读取中顺带计算文件内容的 FNV-1a 哈希，供缓存与去重使用。
+	 * 4. **SAX 模式**：只需要少量字段时可使用 `SaxParseFile`，不构建 DOM，且处理器可随时提前结束解析。
+	 * 
+	 * 解析失败时抛出 `nlohmann::json::exception`，文件无法打开时抛出 `std::runtime_error`，
+	 * 与原先 `ifstream` 写法的异常处理方式保持一致。
+	 */
+	class JsonLoader {
+		public:
+		/**
+		 * @brief 加载并解析 JSON 文件
+		 * @param path 文件路径
+		 * @param contentHash 可选，非空时写入文件内容的哈希
+		 * @return 解析后的 JSON 对象
+		 */
+		static nlohmann::json ParseFile(const std::filesystem::path &path, uint64_t *contentHash = nullptr);
+
+		/**
+		 * @brief 以 SAX 方式解析 JSON 文件
+		 * @details 
+		 * 文件读取方式与 `ParseFile` 相同（优先内存映射）。处理器的任意回调返回 false 都会立即停止解析，
+		 * 此时返回值为 false；处理器需要自行记录停止原因以区分“提前结束”和“解析错误”。
+		 * @tparam SaxHandler 满足 nlohmann SAX 接口的处理器类型
+		 * @param path 文件路径
+		 * @param handler SAX 处理器
+		 * @param contentHash 可选，非空时写入文件内容的哈希
+		 * @return 完整解析到文件末尾时返回 true
+		 */
+		template <typename SaxHandler>
+		static bool SaxParseFile(const std::filesystem::path &path, SaxHandler &handler, uint64_t *contentHash = nullptr) {
+			MappedFile mapped;
+			std::string fallback;
+			std::string_view data;
+			if (mapped.Open(path)) {
+				data = mapped.View();
+			} else {
+				fallback = ReadAll(path);
+				data = fallback;
+			}
+
+			if (contentHash) *contentHash = HashUtils::Fnv1a64(data);
+			const char *begin = data.data();
+			return nlohmann::json::sax_parse(begin, begin + data.size(), &handler);
+		}
+
+		/**
+		 * @brief 将整个文件读入内存
+		 * @param path 文件路径
+		 * @return 文件内容
+		 */
+		static std::string ReadAll(const std::filesystem::path &path);
+
+		/**
+		 * @brief 解析内存中的 JSON 文本
+		 * @param data JSON 文本
+		 * @return 解析后的 JSON 对象
+		 */
+		static nlohmann::json ParseBuffer(std::string_view data);
+
+		/**
+		 * @brief 使用流式提取解析 JSON 文件（回退路径）
+		 * @param path 文件路径
+		 * @return 解析后的 JSON 对象
+		 */
+		static nlohmann::json ParseStream(const std::filesystem::path &path);
+	};
+}
@@ -0,0 +1,76 @@
+#include "pch.h"
+#include "StringPool.h"
+#include <mutex>
+
+namespace PCL_CPP::Core::Utils {
+
+	/**
+	 * @brief 获取全局字符串池
+	 */
+	StringPool &StringPool::Global() {
+		static StringPool pool;
+		return pool;
+	}
+
+	/**
+	 * @brief 驻留字符串
+	 * @param text 字符串内容
+	 * @return 对应的句柄，内容相同时总是返回同一个句柄
+	 */
+	InternedString StringPool::Intern(std::string_view text) {
+		if (text.empty()) return InternedString();
+
+		{
+			std::shared_lock lock(m_mutex);
+			auto it = m_index.find(text);
+			if (it != m_index.end()) return InternedString(it->second);
+		}
+
+		std::unique_lock lock(m_mutex);
+		// 获取独占锁期间可能已有其他线程插入了相同内容
+		auto it = m_index.find(text);
+		if (it != m_index.end()) return InternedString(it->second);
+
+		auto &entry = m_entries.emplace_back();
+		entry.Text.assign(text);
+		entry.Id = static_cast<uint32_t>(m_entries.size());
+		if (entry.Text.capacity() > std::string().capacity()) m_textBytes += entry.Text.capacity() + 1;
+
+		m_index.emplace(entry.Text, &entry);
+		return InternedString(&entry);
+	}
+
+	/**
+	 * @brief 查找已驻留的字符串，不插入新字符串
+	 * @param text 字符串内容
+	 * @return 已驻留时返回句柄，否则返回 std::nullopt
+	 */
+	std::optional<InternedString> StringPool::Find(std::string_view text) const {
+		if (text.empty()) return InternedString();
+
+		std::shared_lock lock(m_mutex);
+		auto it = m_index.find(text);
+		if (it == m_index.end()) return std::nullopt;
+		return InternedString(it->second);
+	}
+
+	size_t StringPool::Size() const {
+		std::shared_lock lock(m_mutex);
+		return m_entries.size();
+	}
+
+	/**
+	 * @brief 估算字符串池占用的堆内存
+	 * @return 字符串副本与索引占用的字节数
+	 */
+	size_t StringPool::MemoryUsage() const {
+		std::shared_lock lock(m_mutex);
+
+		// 索引节点：键、值与 next 指针，外加缓存的哈希值
+		constexpr size_t nodeBytes = sizeof(std::string_view) + sizeof(void *) * 2 + sizeof(size_t);
+		return m_entries.size() * sizeof(InternedString::Entry)
+			+ m_textBytes
+			+ m_index.size() * nodeBytes
+			+ m_index.bucket_count() * sizeof(void *);
+	}
+}
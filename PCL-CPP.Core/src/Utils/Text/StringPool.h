@@ -0,0 +1,126 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace PCL_CPP::Core::Utils {
+	class StringPool;
+
+	/**
+	 * @brief 驻留字符串句柄
+	 *
+	 * @details
+	 * 指向 `StringPool` 中唯一一份字符串副本的句柄，大小与一个指针相同，可随意复制。
+	 * 同一字符串池中内容相同的字符串总是得到同一个句柄，因此比较与哈希只需比较指针，与字符串长度无关。
+	 * 默认构造的句柄表示空字符串，与 `Intern("")` 的结果相等。
+	 */
+	class InternedString {
+		public:
+		/**
+		 * @brief 基于句柄地址的哈希函数，可用于无序容器
+		 */
+		struct Hash {
+			size_t operator()(const InternedString &s) const noexcept {
+				return std::hash<const void *>{}(s.m_entry);
+			}
+		};
+
+		InternedString() = default;
+
+		/**
+		 * @brief 获取字符串内容
+		 */
+		std::string_view View() const noexcept { return m_entry ? std::string_view(m_entry->Text) : std::string_view(); }
+
+		/**
+		 * @brief 获取字符串内容的副本
+		 */
+		std::string Str() const { return std::string(View()); }
+
+		/**
+		 * @brief 获取所属字符串池内的唯一编号
+		 * @return 编号，空字符串为 0，其余从 1 开始连续分配
+		 */
+		uint32_t Id() const noexcept { return m_entry ? m_entry->Id : 0; }
+
+		/**
+		 * @brief 检查是否为空字符串
+		 */
+		bool Empty() const noexcept { return m_entry == nullptr; }
+
+		bool operator==(const InternedString &other) const noexcept { return m_entry == other.m_entry; }
+
+		private:
+		friend class StringPool;
+
+		struct Entry {
+			std::string Text;
+			uint32_t Id = 0;
+		};
+
+		explicit InternedString(const Entry *entry) : m_entry(entry) { }
+
+		const Entry *m_entry = nullptr;
+	};
+
+	/**
+	 * @brief 字符串驻留池
+	 *
+	 * @details
+	 * 为大量重复出现的字符串（库坐标、下载地址、规则中的系统名称与功能开关等）只保存一份副本：
+	 * 1. **句柄比较**：`Intern` 返回的 `InternedString` 以指针相等代替逐字符比较。
+	 * 2. **稳定地址**：字符串一经驻留便不会移动或释放，句柄在字符串池的整个生命周期内有效。
+	 * 3. **线程安全**：查找使用共享锁，仅在插入新字符串时使用独占锁。
+	 *
+	 * 驻留池只增不减，适合保存数量有限、反复出现的元数据，不应用于一次性的大字符串。
+	 * 全局共享的实例通过 `Global()` 获取，不同实例之间的句柄不可比较。
+	 */
+	class StringPool {
+		public:
+		StringPool() = default;
+		StringPool(const StringPool &) = delete;
+		StringPool &operator=(const StringPool &) = delete;
+
+		/**
+		 * @brief 获取全局字符串池
+		 */
+		static StringPool &Global();
+
+		/**
+		 * @brief 驻留字符串
+		 * @param text 字符串内容
+		 * @return 对应的句柄，内容相同时总是返回同一个句柄
+		 */
+		InternedString Intern(std::string_view text);
+
+		/**
+		 * @brief 查找已驻留的字符串，不插入新字符串
+		 * @param text 字符串内容
+		 * @return 已驻留时返回句柄，否则返回 std::nullopt
+		 */
+		std::optional<InternedString> Find(std::string_view text) const;
+
+		/**
+		 * @brief 获取已驻留的字符串数量（不含空字符串）
+		 */
+		size_t Size() const;
+
+		/**
+		 * @brief 估算字符串池占用的堆内存
+		 * @return 字符串副本与索引占用的字节数
+		 */
+		size_t MemoryUsage() const;
+
+		private:
+		mutable std::shared_mutex m_mutex;
+		std::deque<InternedString::Entry> m_entries;                                 ///< 字符串副本，deque 保证插入时已有元素地址不变
+		std::unordered_map<std::string_view, const InternedString::Entry *> m_index; ///< 内容 -> 副本，键指向副本自身的字符
+		size_t m_textBytes = 0;                                                      ///< 字符串副本额外占用的堆内存
+	};
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace PCL_CPP::Core::Utils {
+	/**
+	 * @brief 并行执行工具类
+	 * 
+	 * @details 
+	 * 提供基于有界工作线程池的数据并行原语：
+	 * 1. **有界并发**：工作线程数量不超过 `maxWorkers`（为 0 时取硬件并发数），也不超过任务数量。
+	 * 2. **动态分发**：各线程通过原子计数器领取下一个下标，耗时不均的任务也能自动负载均衡。
+	 * 3. **异常传递**：任意任务抛出的第一个异常会在所有线程结束后于调用线程中重新抛出。
+	 */
+	class Parallel {
+		public:
+		/**
+		 * @brief 计算实际使用的工作线程数量
+		 * @param maxWorkers 期望的最大线程数（0 表示使用硬件并发数）
+		 * @param taskCount 任务总数
+		 * @return 实际线程数，至少为 1
+		 */
+		static size_t ResolveWorkerCount(size_t maxWorkers, size_t taskCount) {
+			size_t workers = maxWorkers;
+			if (workers == 0) {
+				workers = std::max<size_t>(1, std::thread::hardware_concurrency());
+			}
+			return std::max<size_t>(1, std::min(workers, taskCount));
+		}
+
+		/**
+		 * @brief 并行执行 `fn(0) ... fn(count - 1)`
+		 * @details 
+		 * 当只需要一个工作线程时直接在调用线程中顺序执行，避免创建线程的开销。
+		 * 调用返回时所有任务均已完成。
+		 * @param count 任务数量
+		 * @param maxWorkers 最大工作线程数（0 表示使用硬件并发数）
+		 * @param fn 任务函数，参数为任务下标
+		 */
+		template <typename Fn>
+		static void For(size_t count, size_t maxWorkers, Fn &&fn) {
+			if (count == 0) return;
+
+			size_t workers = ResolveWorkerCount(maxWorkers, count);
+			if (workers == 1) {
+				for (size_t i = 0; i < count; i++) fn(i);
+				return;
+			}
+
+			std::atomic<size_t> next = 0;
+			std::exception_ptr firstError;
+			std::mutex errorMutex;
+
+			auto worker = [&]() {
+				size_t i;
+				while ((i = next.fetch_add(1, std::memory_order_relaxed)) < count) {
+					try {
+						fn(i);
+					} catch (...) {
+						std::lock_guard lock(errorMutex);
+						if (!firstError) firstError = std::current_exception();
+					}
+				}
+			};
+
+			{
+				std::vector<std::jthread> threads;
+				threads.reserve(workers - 1);
+				for (size_t t = 1; t < workers; t++) threads.emplace_back(worker);
+				worker(); // 调用线程也参与执行
+			}
+
+			if (firstError) std::rethrow_exception(firstError);
+		}
+	};
+}
@@ -0,0 +1,160 @@
+#include "pch.h"
+#include "TaskGraph.h"
+#include "Parallel.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace PCL_CPP::Core::Utils {
+
+	/**
+	 * @brief 添加任务
+	 * @param name 任务名称
+	 * @param fn 任务函数，返回 false 表示失败
+	 * @param dependencies 依赖的任务，必须是已添加的任务
+	 * @return 任务 ID
+	 */
+	TaskGraph::TaskId TaskGraph::Add(std::string name, std::function<bool()> fn, std::vector<TaskId> dependencies) {
+		TaskId id = m_tasks.size();
+		for (TaskId dependency : dependencies) {
+			if (dependency >= id) throw std::invalid_argument("Task '" + name + "' depends on an unknown task");
+		}
+
+		// 重复的依赖只计一次，否则完成计数会出错
+		std::sort(dependencies.begin(), dependencies.end());
+		dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+		for (TaskId dependency : dependencies) m_dependents[dependency].push_back(id);
+
+		TaskInfo info;
+		info.Name = std::move(name);
+		info.Dependencies = std::move(dependencies);
+		m_tasks.push_back(std::move(info));
+		m_functions.push_back(std::move(fn));
+		m_dependents.emplace_back();
+		return id;
+	}
+
+	/**
+	 * @brief 执行所有任务
+	 * @param maxWorkers 最大工作线程数（0 表示使用硬件并发数）
+	 * @return 所有任务均成功时返回 true
+	 */
+	bool TaskGraph::Run(size_t maxWorkers) {
+		size_t count = m_tasks.size();
+		if (count == 0) return true;
+
+		std::vector<size_t> remaining(count);
+		std::vector<bool> blocked(count, false);
+		std::deque<TaskId> ready;
+		for (TaskId id = 0; id < count; id++) {
+			auto &task = m_tasks[id];
+			task.Status = TaskStatus::Pending;
+			task.Start = task.End = {};
+			task.Error = nullptr;
+			remaining[id] = task.Dependencies.size();
+			if (remaining[id] == 0) ready.push_back(id);
+		}
+
+		std::mutex mutex;
+		std::condition_variable cv;
+		size_t finished = 0;
+		bool allSucceeded = true;
+		auto start = Clock::now();
+
+		// 记录任务完成并释放其后继（调用时需持有锁）；被跳过的后继在此处直接完成，不进入就绪队列
+		auto complete = [&](TaskId id, bool succeeded) {
+			std::vector<std::pair<TaskId, bool>> pending { { id, succeeded } };
+			while (!pending.empty()) {
+				auto [current, ok] = pending.back();
+				pending.pop_back();
+				finished++;
+				if (!ok) allSucceeded = false;
+
+				for (TaskId next : m_dependents[current]) {
+					if (!ok) blocked[next] = true;
+					if (--remaining[next] > 0) continue;
+					if (blocked[next]) {
+						auto &skipped = m_tasks[next];
+						skipped.Status = TaskStatus::Skipped;
+						skipped.Start = skipped.End = Clock::now() - start;
+						pending.push_back({ next, false });
+					} else {
+						ready.push_back(next);
+					}
+				}
+			}
+		};
+
+		auto worker = [&]() {
+			std::unique_lock lock(mutex);
+			while (true) {
+				cv.wait(lock, [&] { return !ready.empty() || finished == count; });
+				if (ready.empty()) return;
+
+				TaskId id = ready.front();
+				ready.pop_front();
+				lock.unlock();
+
+				// 任务记录只由执行它的线程写入
+				auto &task = m_tasks[id];
+				task.Start = Clock::now() - start;
+				bool ok = false;
+				try {
+					ok = m_functions[id]();
+				} catch (...) {
+					task.Error = std::current_exception();
+				}
+				task.End = Clock::now() - start;
+				task.Status = ok ? TaskStatus::Succeeded : TaskStatus::Failed;
+
+				lock.lock();
+				complete(id, ok);
+				cv.notify_all();
+			}
+		};
+
+		size_t workers = Parallel::ResolveWorkerCount(maxWorkers, count);
+		{
+			std::vector<std::jthread> threads;
+			threads.reserve(workers - 1);
+			for (size_t t = 1; t < workers; t++) threads.emplace_back(worker);
+			worker(); // 调用线程也参与执行
+		}
+		return allSucceeded;
+	}
+
+	/**
+	 * @brief 获取以指定任务结尾的关键路径
+	 * @param sink 路径终点
+	 * @return 从起点到 `sink` 的任务 ID 序列
+	 */
+	std::vector<TaskGraph::TaskId> TaskGraph::GetCriticalPath(TaskId sink) const {
+		std::vector<TaskId> path;
+		for (TaskId current = sink;;) {
+			path.push_back(current);
+			const auto &dependencies = m_tasks[current].Dependencies;
+			if (dependencies.empty()) break;
+			current = *std::max_element(dependencies.begin(), dependencies.end(), [&](TaskId a, TaskId b) {
+				return m_tasks[a].End < m_tasks[b].End;
+			});
+		}
+		std::reverse(path.begin(), path.end());
+		return path;
+	}
+
+	/**
+	 * @brief 获取整个图的关键路径
+	 * @return 以最晚结束的任务为终点的关键路径，图为空时返回空列表
+	 */
+	std::vector<TaskGraph::TaskId> TaskGraph::GetCriticalPath() const {
+		if (m_tasks.empty()) return {};
+		auto last = std::max_element(m_tasks.begin(), m_tasks.end(), [](const TaskInfo &a, const TaskInfo &b) {
+			return a.End < b.End;
+		});
+		return GetCriticalPath(static_cast<TaskId>(last - m_tasks.begin()));
+	}
+}
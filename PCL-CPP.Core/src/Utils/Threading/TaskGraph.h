@@ -0,0 +1,106 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace PCL_CPP::Core::Utils {
+	/**
+	 * @brief 任务执行状态
+	 */
+	enum class TaskStatus {
+		Pending,   ///< 尚未执行
+		Succeeded, ///< 执行成功
+		Failed,    ///< 任务返回 false 或抛出异常
+		Skipped    ///< 某个依赖未成功，任务未执行
+	};
+
+	/**
+	 * @brief 有依赖关系的任务图
+	 *
+	 * @details
+	 * 以有向无环图描述一组任务，并在有界工作线程池上执行：
+	 * 1. **依赖调度**：任务的所有依赖成功完成后立即进入就绪队列，不等待同一“阶段”的其他任务。
+	 * 2. **失败传播**：任务返回 false 或抛出异常时标记为失败，所有直接或间接依赖它的任务被跳过；无关的任务照常执行。
+	 * 3. **耗时记录**：记录每个任务相对于 `Run` 开始时刻的起止时间，并可从任意任务反推关键路径。
+	 *
+	 * 依赖只能引用已添加的任务，因此图在构造上即无环。图可以重复执行，每次执行都会覆盖上次的记录。
+	 */
+	class TaskGraph {
+		public:
+		using TaskId = size_t;
+		using Clock = std::chrono::steady_clock;
+
+		/**
+		 * @brief 单个任务的执行记录
+		 */
+		struct TaskInfo {
+			std::string Name;                      ///< 任务名称
+			std::vector<TaskId> Dependencies;      ///< 依赖的任务
+			TaskStatus Status = TaskStatus::Pending; ///< 执行状态
+			Clock::duration Start {};              ///< 开始时间（相对于 `Run` 开始）
+			Clock::duration End {};                ///< 结束时间（相对于 `Run` 开始）
+			std::exception_ptr Error;              ///< 任务抛出的异常
+
+			/**
+			 * @brief 获取任务耗时
+			 */
+			Clock::duration Duration() const { return End - Start; }
+		};
+
+		/**
+		 * @brief 添加任务
+		 * @param name 任务名称
+		 * @param fn 任务函数，返回 false 表示失败
+		 * @param dependencies 依赖的任务，必须是已添加的任务
+		 * @return 任务 ID
+		 * @throws std::invalid_argument 依赖引用了不存在的任务
+		 */
+		TaskId Add(std::string name, std::function<bool()> fn, std::vector<TaskId> dependencies = {});
+
+		/**
+		 * @brief 执行所有任务
+		 * @details
+		 * 调用线程也参与执行，返回时所有任务均已完成或被跳过。任务抛出的异常不会传出，
+		 * 可通过 `GetTask(id).Error` 获取。
+		 * @param maxWorkers 最大工作线程数（0 表示使用硬件并发数）
+		 * @return 所有任务均成功时返回 true
+		 */
+		bool Run(size_t maxWorkers = 0);
+
+		/**
+		 * @brief 获取任务的执行记录
+		 * @param id 任务 ID
+		 * @return 执行记录
+		 */
+		const TaskInfo &GetTask(TaskId id) const { return m_tasks[id]; }
+
+		/**
+		 * @brief 获取任务数量
+		 */
+		size_t Size() const { return m_tasks.size(); }
+
+		/**
+		 * @brief 获取以指定任务结尾的关键路径
+		 * @details
+		 * 从 `sink` 出发，每一步回溯到最晚结束的依赖（即实际决定该任务何时能够开始的依赖），
+		 * 直到没有依赖的任务为止。路径上各任务的耗时之和加上排队等待时间即为 `sink` 的结束时间。
+		 * @param sink 路径终点
+		 * @return 从起点到 `sink` 的任务 ID 序列
+		 */
+		std::vector<TaskId> GetCriticalPath(TaskId sink) const;
+
+		/**
+		 * @brief 获取整个图的关键路径
+		 * @return 以最晚结束的任务为终点的关键路径，图为空时返回空列表
+		 */
+		std::vector<TaskId> GetCriticalPath() const;
+
+		private:
+		std::vector<TaskInfo> m_tasks;
+		std::vector<std::function<bool()>> m_functions;
+		std::vector<std::vector<TaskId>> m_dependents; ///< 每个任务的直接后继
+	};
+}
@@ -0,0 +1,687 @@
+#include "pch.h"
+#include "Launcher/Launch/FileVerifier.h"
+#include "Launcher/Launch/LaunchPlanner.h"
+#include "Launcher/Launch/NativesUtils.h"
+#include "Launcher/Version/ArgumentTemplate.h"
+#include "Launcher/Version/CompiledVersion.h"
+#include "Launcher/Version/InternedLibrary.h"
+#include "Launcher/Version/MavenCoordinate.h"
+#include "Launcher/Version/MultiRootCatalog.h"
+#include "Launcher/Version/RuleEngine.h"
+#include "Launcher/Version/VersionJsonView.h"
+#include "Launcher/Version/VersionLocator.h"
+#include "Utils/Hashing/Sha1.h"
+#include "Utils/Json/JsonLoader.h"
+#include "Utils/Text/StringPool.h"
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <thread>
+
+#define MINIZ_NO_TIME
+#define MINIZ_NO_ZLIB_APIS
+#include <miniz/miniz.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace PCL_CPP::Core::Launcher::Launch;
+using namespace PCL_CPP::Core::Launcher::Version;
+using namespace PCL_CPP::Core::Utils;
+
+namespace PCLCPPTest {
+	/**
+	 * @brief 性能基准测试
+	 * @details 
+	 * 基准测试使用合成数据，仅输出耗时与吞吐量供人工比较，断言只校验结果正确性，
+	 * 不对具体耗时做硬性要求，避免在负载不同的机器上产生误报。
+	 */
+	TEST_CLASS(BenchmarkTest) {
+	public:
+	std::filesystem::path benchRoot = "BenchData";
+
+	TEST_METHOD_INITIALIZE(Setup) {
+		if (std::filesystem::exists(benchRoot)) std::filesystem::remove_all(benchRoot);
+		std::filesystem::create_directories(benchRoot);
+	}
+
+	TEST_METHOD_CLEANUP(Cleanup) {
+		std::error_code ec;
+		std::filesystem::remove_all(benchRoot, ec);
+	}
+
+	/**
+	 * @brief 生成合成版本目录树
+	 * @details 每 10 个版本中有 1 个原版，其余版本继承自最近的原版，模拟加载器版本大量共享父版本的场景。
+	 * @param root 版本根目录
+	 * @param count 版本数量
+	 * @param libsPerVersion 每个版本的依赖库数量
+	 */
+	static void GenerateVersionTree(const std::filesystem::path &root, size_t count, size_t libsPerVersion) {
+		for (size_t i = 0; i < count; i++) {
+			bool vanilla = (i % 10 == 0);
+			std::string id = vanilla ? std::format("1.{}.0", i / 10) : std::format("1.{}.0-loader-{}", i / 10, i % 10);
+
+			nlohmann::json libs = nlohmann::json::array();
+			for (size_t l = 0; l < libsPerVersion; l++) {
+				std::string name = std::format("org.example.group{}:artifact{}:{}.0", l % 7, l, i);
+				libs.push_back({
+					{"name", name},
+					{"downloads", {{"artifact", {
+						{"path", std::format("org/example/artifact{}/{}.0/artifact{}-{}.0.jar", l, i, l, i)},
+						{"sha1", "0000000000000000000000000000000000000000"},
+						{"size", 1024},
+						{"url", "https://libraries.minecraft.net/"}
+					}}}}
+				});
+			}
+
+			nlohmann::json j = {
+				{"id", id},
+				{"type", "release"},
+				{"mainClass", vanilla ? "net.minecraft.client.main.Main" : "cpw.mods.bootstraplauncher.BootstrapLauncher"},
+				{"libraries", libs},
+				{"arguments", {{"game", {"--username", "${auth_player_name}", "--version", "${version_name}"}}, {"jvm", {"-cp", "${classpath}"}}}}
+			};
+			if (vanilla) {
+				j["assets"] = "1.0";
+			} else {
+				j["inheritsFrom"] = std::format("1.{}.0", i / 10);
+			}
+
+			std::filesystem::create_directories(root / id);
+			std::ofstream(root / id / (id + ".json")) << j.dump(2);
+		}
+	}
+
+	/**
+	 * @brief 并行版本扫描的线程数扩展性
+	 */
+	TEST_METHOD(BenchParallelVersionScan) {
+		constexpr size_t versionCount = 1000;
+		GenerateVersionTree(benchRoot, versionCount, 40);
+
+		size_t hw = std::max<size_t>(1, std::thread::hardware_concurrency());
+		std::vector<size_t> workerCounts = {1, 2, 4, hw};
+		std::sort(workerCounts.begin(), workerCounts.end());
+		workerCounts.erase(std::unique(workerCounts.begin(), workerCounts.end()), workerCounts.end());
+
+		double baselineMs = 0;
+		for (size_t workers : workerCounts) {
+			auto start = std::chrono::steady_clock::now();
+			auto versions = VersionLocator::GetAllVersions(benchRoot, workers);
+			double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+			Assert::AreEqual(versionCount, versions.size(), L"All synthetic versions should be found");
+			if (workers == 1) baselineMs = ms;
+
+			Logger::WriteMessage(std::format("GetAllVersions workers={:>3}: {:>9.2f} ms, {:>9.1f} versions/s, speedup {:.2f}x\n",
+											 workers, ms, versionCount * 1000.0 / ms, baselineMs / ms).c_str());
+		}
+	}
+
+	/**
+	 * @brief 版本索引对冷启动列出版本的加速效果
+	 */
+	TEST_METHOD(BenchVersionIndexListing) {
+		constexpr size_t versionCount = 1000;
+		GenerateVersionTree(benchRoot, versionCount, 40);
+
+		auto start = std::chrono::steady_clock::now();
+		auto fullScan = VersionLocator::GetAllVersions(benchRoot);
+		double fullMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		start = std::chrono::steady_clock::now();
+		auto buildIndex = VersionLocator::ListVersions(benchRoot);
+		double buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		start = std::chrono::steady_clock::now();
+		auto fromIndex = VersionLocator::ListVersions(benchRoot);
+		double warmMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		Assert::AreEqual(versionCount, fullScan.size());
+		Assert::AreEqual(versionCount, fromIndex.size());
+		for (size_t i = 0; i < versionCount; i++) {
+			Assert::AreEqual(fullScan[i].Id, fromIndex[i].Id);
+			Assert::AreEqual(fullScan[i].MainClass, fromIndex[i].MainClass);
+		}
+
+		Logger::WriteMessage(std::format("GetAllVersions (full parse): {:>9.2f} ms\n", fullMs).c_str());
+		Logger::WriteMessage(std::format("ListVersions (build index):  {:>9.2f} ms\n", buildMs).c_str());
+		Logger::WriteMessage(std::format("ListVersions (warm index):   {:>9.2f} ms\n", warmMs).c_str());
+	}
+
+	/**
+	 * @brief 内存映射解析与流式解析的对比
+	 */
+	TEST_METHOD(BenchJsonLoader) {
+		std::filesystem::path assetsDir = TEST_ASSETS_DIR;
+
+		// 合成一个包含 4000 个对象的资源索引
+		nlohmann::json objects = nlohmann::json::object();
+		for (size_t i = 0; i < 4000; i++) {
+			std::string hash = std::format("{:040x}", i * 2654435761ull);
+			objects[std::format("minecraft/sounds/ambient/cave/cave{}.ogg", i)] = {{"hash", hash}, {"size", 10000 + i}};
+		}
+		std::filesystem::path assetIndex = benchRoot / "asset-index.json";
+		std::ofstream(assetIndex) << nlohmann::json({{"objects", objects}}).dump();
+
+		std::vector<std::filesystem::path> files = {assetsDir / "1.18.2.json", assetsDir / "1.18.2-OptiFine.json", assetIndex};
+		constexpr int iterations = 30;
+
+		for (const auto &file : files) {
+			auto start = std::chrono::steady_clock::now();
+			for (int i = 0; i < iterations; i++) JsonLoader::ParseStream(file);
+			double streamMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+			start = std::chrono::steady_clock::now();
+			for (int i = 0; i < iterations; i++) JsonLoader::ParseFile(file);
+			double mappedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+			Assert::IsTrue(JsonLoader::ParseStream(file) == JsonLoader::ParseFile(file));
+			Logger::WriteMessage(std::format("{:<24} stream {:>8.3f} ms, mapped {:>8.3f} ms, speedup {:.2f}x\n",
+											 file.filename().string(), streamMs, mappedMs, streamMs / mappedMs).c_str());
+		}
+	}
+
+	/**
+	 * @brief 多根目录去重扫描与逐个根目录扫描的对比
+	 */
+	TEST_METHOD(BenchMultiRootScan) {
+		constexpr size_t rootCount = 6;
+		std::vector<std::filesystem::path> roots;
+		for (size_t r = 0; r < rootCount; r++) {
+			roots.push_back(benchRoot / std::format("team{}", r));
+			GenerateVersionTree(roots.back(), 100, 40);
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		size_t separateCount = 0;
+		for (const auto &root : roots) separateCount += VersionLocator::GetAllVersions(root).size();
+		double separateMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		MultiRootCatalog catalog(roots);
+		start = std::chrono::steady_clock::now();
+		catalog.Scan();
+		double coldMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		start = std::chrono::steady_clock::now();
+		catalog.Scan();
+		double warmMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		const auto &stats = catalog.GetStats();
+		Assert::AreEqual(separateCount, catalog.GetVersions().size());
+		Assert::AreEqual((size_t) 100, stats.UniqueContents);
+		Logger::WriteMessage(std::format("{} roots x 100 versions: separate {:>9.2f} ms, multi-root cold {:>9.2f} ms, warm {:>9.2f} ms\n",
+										 rootCount, separateMs, coldMs, warmMs).c_str());
+		Assert::AreEqual((size_t) 0, stats.ParsedFiles);
+		Logger::WriteMessage(std::format("files {}, unique contents {}, resolved instances {}\n",
+										 stats.VersionFiles, stats.UniqueContents, stats.UniqueVersions).c_str());
+	}
+
+	/**
+	 * @brief 复用编译模型与每次从 VersionInfo 规划的对比
+	 */
+	TEST_METHOD(BenchCompiledPlan) {
+		std::filesystem::path assetsDir = TEST_ASSETS_DIR;
+		std::filesystem::create_directories(benchRoot / "1.18.2");
+		std::filesystem::copy_file(assetsDir / "1.18.2.json", benchRoot / "1.18.2/1.18.2.json");
+		auto version = VersionLocator::GetVersion(benchRoot, "1.18.2");
+		Assert::IsTrue(version.has_value());
+
+		LaunchContext ctx;
+		ctx.GameRoot = benchRoot;
+		ctx.NativesDir = benchRoot / "natives";
+		constexpr int iterations = 200;
+
+		size_t rawArgs = 0;
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; i++) rawArgs += LaunchPlanner(*version, ctx).Plan().Arguments.size();
+		double rawUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+		auto compiled = CompiledVersion::Compile(*version);
+		size_t compiledArgs = 0;
+		start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; i++) compiledArgs += LaunchPlanner(compiled, ctx).Plan().Arguments.size();
+		double compiledUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+		Assert::AreEqual(rawArgs, compiledArgs);
+		Logger::WriteMessage(std::format("Plan from VersionInfo {:>9.2f} us, from CompiledVersion {:>9.2f} us, speedup {:.2f}x\n",
+										 rawUs, compiledUs, rawUs / compiledUs).c_str());
+	}
+
+	/**
+	 * @brief 深继承链的叠加视图与平铺合并对比
+	 */
+	TEST_METHOD(BenchOverlayMerge) {
+		// 模拟 原版 -> Forge -> 整合包 -> 用户自定义 的四层继承链
+		const size_t libsPerLayer[] = {60, 40, 20, 5};
+		std::vector<nlohmann::json> layers;
+		for (size_t depth = 0; depth < std::size(libsPerLayer); depth++) {
+			nlohmann::json libs = nlohmann::json::array();
+			for (size_t l = 0; l < libsPerLayer[depth]; l++) {
+				libs.push_back({{"name", std::format("org.layer{}:artifact{}:1.0", depth, l)}, {"downloads", {{"artifact", {{"path", "p"}, {"sha1", "s"}, {"size", l}}}}}});
+			}
+			nlohmann::json args = {{"game", {"--layer", std::to_string(depth)}}, {"jvm", {"-Dlayer=" + std::to_string(depth)}}};
+			layers.push_back({{"id", std::format("layer{}", depth)}, {"libraries", libs}, {"arguments", args}});
+		}
+
+		std::vector<std::shared_ptr<const VersionInfo>> chain;
+		for (auto &layer : layers) {
+			VersionInfo info;
+			info.RawData = layer;
+			if (!chain.empty()) info.Parent = chain.back();
+			chain.push_back(std::make_shared<const VersionInfo>(std::move(info)));
+		}
+		const VersionInfo &leaf = *chain.back();
+		constexpr int iterations = 2000;
+
+		size_t viewCount = 0;
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; i++) {
+			VersionJsonView view(leaf);
+			view.Libraries().ForEach([&](const nlohmann::json &) { viewCount++; });
+		}
+		double viewUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+		size_t flatCount = 0;
+		start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; i++) {
+			VersionInfo copy = leaf;
+			VersionLocator::Flatten(copy);
+			for (const auto &lib : copy.RawData["libraries"]) { (void) lib; flatCount++; }
+		}
+		double flatUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+		Assert::AreEqual(flatCount, viewCount);
+		Assert::AreEqual((size_t) 125 * iterations, viewCount);
+		Logger::WriteMessage(std::format("Overlay view {:>9.2f} us, flatten {:>9.2f} us, speedup {:.2f}x\n", viewUs, flatUs, flatUs / viewUs).c_str());
+	}
+
+	/**
+	 * @brief 估算字符串占用的堆内存（短字符串优化范围内为 0）
+	 */
+	static size_t HeapBytes(const std::string &s) {
+		return s.capacity() > std::string().capacity() ? s.capacity() + 1 : 0;
+	}
+
+	/**
+	 * @brief 估算 std::map 节点的大小（左/右/父指针与颜色标记 + 元素）
+	 */
+	template <typename K, typename V>
+	static constexpr size_t MapNodeBytes = sizeof(void *) * 4 + sizeof(std::pair<const K, V>);
+
+	static size_t HeapBytes(const FileInfo &info) {
+		return HeapBytes(info.Path) + HeapBytes(info.Sha1) + HeapBytes(info.Url);
+	}
+
+	static size_t HeapBytes(const Library &lib) {
+		size_t bytes = HeapBytes(lib.Name);
+		if (lib.Artifact) bytes += HeapBytes(*lib.Artifact);
+		for (const auto &[key, info] : lib.Classifiers) bytes += MapNodeBytes<std::string, FileInfo> + HeapBytes(key) + HeapBytes(info);
+		for (const auto &[os, classifier] : lib.Natives) bytes += MapNodeBytes<std::string, std::string> + HeapBytes(os) + HeapBytes(classifier);
+		if (lib.Extract) {
+			bytes += lib.Extract->Exclude.capacity() * sizeof(std::string);
+			for (const auto &item : lib.Extract->Exclude) bytes += HeapBytes(item);
+		}
+		bytes += lib.Rules.capacity() * sizeof(Rule);
+		for (const auto &rule : lib.Rules) {
+			if (rule.OsName) bytes += HeapBytes(*rule.OsName);
+			if (rule.OsVersion) bytes += HeapBytes(*rule.OsVersion);
+			if (rule.OsArch) bytes += HeapBytes(*rule.OsArch);
+			for (const auto &[key, value] : rule.Features) bytes += MapNodeBytes<std::string, bool> + HeapBytes(key);
+		}
+		return bytes;
+	}
+
+	static size_t HeapBytes(const InternedLibrary &lib) {
+		size_t bytes = lib.Classifiers.capacity() * sizeof(lib.Classifiers[0]) + lib.Natives.capacity() * sizeof(lib.Natives[0]);
+		if (lib.Extract) bytes += lib.Extract->capacity() * sizeof(InternedString);
+		bytes += lib.Rules.capacity() * sizeof(InternedRule);
+		for (const auto &rule : lib.Rules) bytes += rule.Features.capacity() * sizeof(rule.Features[0]);
+		return bytes;
+	}
+
+	/**
+	 * @brief 500 个版本的依赖库在驻留前后的内存占用对比
+	 * @details 
+	 * 50 个原版各引用 40 个库（按 5 代游戏版本轮换库版本，LWJGL 带 Natives 与规则），
+	 * 450 个加载器版本各引用 15 个库，模拟真实目录中同一批库坐标与下载地址在大量版本中重复出现的情况。
+	 */
+	TEST_METHOD(BenchInternedLibraryMemory) {
+		auto makeFile = [](const std::string &path, size_t size) {
+			return nlohmann::json { {"path", path}, {"sha1", std::format("{:040x}", std::hash<std::string>{}(path))}, {"size", size},
+								   {"url", "https://libraries.minecraft.net/" + path} };
+		};
+		auto makeLibrary = [&](const std::string &group, const std::string &artifact, const std::string &version, bool native) {
+			std::string base = group;
+			std::replace(base.begin(), base.end(), '.', '/');
+			base += std::format("/{}/{}/{}-{}", artifact, version, artifact, version);
+
+			nlohmann::json lib = { {"name", std::format("{}:{}:{}", group, artifact, version)} };
+			lib["downloads"]["artifact"] = makeFile(base + ".jar", 4096);
+			if (native) {
+				for (const char *os : {"windows", "linux", "osx"}) {
+					lib["downloads"]["classifiers"][std::format("natives-{}", os)] = makeFile(std::format("{}-natives-{}.jar", base, os), 1024);
+					lib["natives"][os] = std::format("natives-{}", os);
+				}
+				lib["extract"]["exclude"] = {"META-INF/"};
+				lib["rules"] = { {{"action", "allow"}}, {{"action", "disallow"}, {"os", {{"name", "osx"}}}} };
+			}
+			return lib;
+		};
+
+		std::vector<Library> plain;
+		for (size_t v = 0; v < 500; v++) {
+			bool vanilla = v % 10 == 0;
+			size_t generation = (v / 10) % 5;
+			size_t libCount = vanilla ? 40 : 15;
+			for (size_t l = 0; l < libCount; l++) {
+				nlohmann::json lib = vanilla
+					? makeLibrary(l < 8 ? "bench.intern.lwjgl" : "bench.intern.mojang", std::format("lib{}", l), std::format("3.{}.0", generation), l < 8)
+					: makeLibrary("bench.intern.loader", std::format("lib{}", l), std::format("0.{}.{}", generation, v % 3), false);
+				plain.push_back(Library::Parse(lib));
+			}
+		}
+
+		size_t plainBytes = plain.capacity() * sizeof(Library);
+		for (const auto &lib : plain) plainBytes += HeapBytes(lib);
+
+		size_t poolBefore = StringPool::Global().MemoryUsage();
+		auto start = std::chrono::steady_clock::now();
+		std::vector<InternedLibrary> interned;
+		interned.reserve(plain.size());
+		for (const auto &lib : plain) interned.push_back(InternedLibrary::From(lib));
+		double internMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		size_t poolBytes = StringPool::Global().MemoryUsage() - poolBefore;
+		size_t internedBytes = interned.capacity() * sizeof(InternedLibrary) + poolBytes;
+		for (const auto &lib : interned) internedBytes += HeapBytes(lib);
+
+		// 按名称比较：驻留后为指针比较
+		size_t plainMatches = 0, internedMatches = 0;
+		start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < plain.size(); i++) plainMatches += plain[i].Name == plain[i % 40].Name;
+		double plainCmpUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+		start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < interned.size(); i++) internedMatches += interned[i].Name == interned[i % 40].Name;
+		double internedCmpUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+		Assert::AreEqual(plainMatches, internedMatches);
+		Assert::IsTrue(internedBytes < plainBytes);
+		Logger::WriteMessage(std::format("{} libraries across 500 versions: std::string {:>9.1f} KiB, interned {:>9.1f} KiB (pool {:.1f} KiB), ratio {:.2f}x\n",
+										 plain.size(), plainBytes / 1024.0, internedBytes / 1024.0, poolBytes / 1024.0, (double) plainBytes / internedBytes).c_str());
+		Logger::WriteMessage(std::format("intern {:>7.2f} ms, name compare std::string {:>8.2f} us, interned {:>8.2f} us\n",
+										 internMs, plainCmpUs, internedCmpUs).c_str());
+	}
+
+	/**
+	 * @brief 编译规则与逐条 Rule::IsMatch 的库过滤对比
+	 * @details 模拟约 300 个库的整合包版本，其中三分之一带有系统或功能开关规则。
+	 */
+	TEST_METHOD(BenchRuleEngine) {
+		std::vector<Library> libs;
+		for (size_t i = 0; i < 300; i++) {
+			nlohmann::json lib = { {"name", std::format("bench.rules:lib{}:1.0", i)} };
+			switch (i % 6) {
+				case 0: lib["rules"] = { {{"action", "allow"}}, {{"action", "disallow"}, {"os", {{"name", "osx"}}}} }; break;
+				case 1: lib["rules"] = { {{"action", "allow"}, {"os", {{"name", "windows"}, {"version", "^10\\."}}}} }; break;
+				case 2: lib["rules"] = { {{"action", "allow"}, {"features", {{"has_custom_resolution", true}}}} }; break;
+				default: break;
+			}
+			libs.push_back(Library::Parse(lib));
+		}
+		std::map<std::string, bool> features = { {"is_demo_user", false}, {"has_custom_resolution", true} };
+		constexpr int iterations = 200;
+
+		size_t ruleActive = 0;
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; i++) {
+			for (const auto &lib : libs) ruleActive += lib.IsActive(features);
+		}
+		double ruleUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+		size_t compiledActive = 0;
+		start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; i++) {
+			// 每次规划构建一次环境快照，计入耗时
+			auto environment = RuleEnvironment::Current(features);
+			for (const auto &lib : libs) compiledActive += lib.IsActive(environment);
+		}
+		double compiledUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+		Assert::AreEqual(ruleActive, compiledActive);
+		Logger::WriteMessage(std::format("Filter {} libraries: Rule::IsMatch {:>9.2f} us, compiled {:>9.2f} us, speedup {:.2f}x\n",
+										 libs.size(), ruleUs, compiledUs, ruleUs / compiledUs).c_str());
+	}
+
+	/**
+	 * @brief 批量解析依赖库路径与逐个构造 std::filesystem::path 的对比
+	 * @details 模拟约 400 个库的整合包，其中部分带有分类器。
+	 */
+	TEST_METHOD(BenchLibraryPathResolve) {
+		std::vector<std::string> names;
+		for (size_t i = 0; i < 400; i++) {
+			names.push_back(i % 5 == 0 ? std::format("org.example.group{}:artifact{}:{}.0.{}:natives-windows", i % 13, i, i % 7, i)
+										: std::format("org.example.group{}:artifact{}:{}.0.{}", i % 13, i, i % 7, i));
+		}
+		std::vector<std::string_view> views(names.begin(), names.end());
+		std::filesystem::path librariesDir = std::filesystem::path("C:/Games/.minecraft") / "libraries";
+		constexpr int iterations = 200;
+
+		size_t pathBytes = 0;
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; i++) {
+			for (const auto &name : names) {
+				auto coordinate = MavenCoordinate::Parse(name);
+				pathBytes += (librariesDir / MavenUtils::GetPath(name, "jar", std::string(coordinate->Classifier))).string().size();
+			}
+		}
+		double pathUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+		size_t arenaBytes = 0;
+		start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; i++) {
+			auto arena = LibraryPathArena::Resolve(librariesDir.string(), views);
+			for (size_t j = 0; j < arena.Size(); j++) arenaBytes += arena[j].size();
+		}
+		double arenaUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+		Assert::AreEqual(pathBytes, arenaBytes);
+		Logger::WriteMessage(std::format("Resolve {} library paths: filesystem::path {:>9.2f} us, arena {:>9.2f} us, speedup {:.2f}x\n",
+										 names.size(), pathUs, arenaUs, pathUs / arenaUs).c_str());
+	}
+
+	/**
+	 * @brief 预编译参数模板与逐键 find / replace 的替换对比
+	 * @details 模拟一个现代版本的约 40 个参数与 16 个替换键。
+	 */
+	TEST_METHOD(BenchArgumentRender) {
+		std::map<std::string, std::string> subs;
+		for (const char *key : { "auth_player_name", "auth_uuid", "auth_access_token", "user_type", "version_name", "version_type",
+								 "assets_index_name", "game_directory", "assets_root", "natives_directory", "library_directory",
+								 "classpath_separator", "launcher_name", "launcher_version", "resolution_width", "resolution_height" }) {
+			subs[key] = std::format("value-of-{}", key);
+		}
+		subs["classpath"] = std::string(32 * 1024, 'c');
+
+		std::vector<std::string> values;
+		for (size_t i = 0; i < 10; i++) {
+			values.push_back("--username");
+			values.push_back("${auth_player_name}");
+			values.push_back(std::format("-Dlib{}=${{library_directory}}/lib{}.jar${{classpath_separator}}${{game_directory}}", i, i));
+			values.push_back(i == 0 ? "${classpath}" : std::format("-Dflag{}=true", i));
+		}
+		constexpr int iterations = 500;
+
+		size_t replaceBytes = 0;
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; i++) {
+			for (std::string value : values) {
+				for (const auto &[key, val] : subs) {
+					std::string placeholder = "${" + key + "}";
+					size_t pos = 0;
+					while ((pos = value.find(placeholder, pos)) != std::string::npos) {
+						value.replace(pos, placeholder.length(), val);
+						pos += val.length();
+					}
+				}
+				replaceBytes += value.size();
+			}
+		}
+		double replaceUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+		std::vector<ArgumentTemplate> templates;
+		for (const auto &value : values) templates.push_back(ArgumentTemplate::Compile(value));
+		size_t templateBytes = 0;
+		start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; i++) {
+			// 每次规划构建一次替换表，计入耗时
+			SubstitutionTable table(subs);
+			for (const auto &tmpl : templates) templateBytes += tmpl.Render(table).size();
+		}
+		double templateUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+		Assert::AreEqual(replaceBytes, templateBytes);
+		Logger::WriteMessage(std::format("Render {} arguments: find/replace {:>9.2f} us, template {:>9.2f} us, speedup {:.2f}x\n",
+										 values.size(), replaceUs, templateUs, replaceUs / templateUs).c_str());
+	}
+
+	/**
+	 * @brief 规划骨架缓存下的重复启动规划
+	 * @details 模拟约 300 个库的加载器版本，每次规划切换账号，首次规划后只需重新渲染认证信息与分辨率。
+	 */
+	TEST_METHOD(BenchRelaunchPlan) {
+		GenerateVersionTree(benchRoot, 2, 300);
+		auto version = VersionLocator::GetVersion(benchRoot, "1.0.0-loader-1");
+		Assert::IsTrue(version.has_value());
+		auto compiled = CompiledVersion::Compile(*version);
+
+		LaunchContext ctx;
+		ctx.GameRoot = benchRoot;
+		ctx.NativesDir = benchRoot / "natives";
+		constexpr int iterations = 200;
+
+		size_t coldArgs = 0;
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; i++) {
+			ctx.Auth.PlayerName = std::format("Player{}", i);
+			coldArgs += LaunchPlanner(compiled, ctx).Plan().Arguments.size();
+		}
+		double coldUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+		ctx.SkeletonCache = std::make_shared<PlanSkeletonCache>();
+		size_t cachedArgs = 0;
+		start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; i++) {
+			ctx.Auth.PlayerName = std::format("Player{}", i);
+			cachedArgs += LaunchPlanner(compiled, ctx).Plan().Arguments.size();
+		}
+		double cachedUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+		Assert::AreEqual(coldArgs, cachedArgs);
+		Assert::AreEqual((uint64_t) iterations - 1, ctx.SkeletonCache->Hits());
+		Logger::WriteMessage(std::format("Relaunch plan ({} libraries): full {:>9.2f} us, skeleton cache {:>9.2f} us, speedup {:.2f}x\n",
+										 compiled->Libraries.size(), coldUs, cachedUs, coldUs / cachedUs).c_str());
+	}
+
+	/**
+	 * @brief 启动文件完整性校验
+	 * @details 模拟 300 个 256 KiB 的依赖库：首次校验需要计算全部 SHA-1，记录命中后每个文件只需一次 stat。
+	 */
+	TEST_METHOD(BenchVerifyLaunchFiles) {
+		constexpr size_t fileCount = 300;
+		constexpr size_t fileSize = 256 * 1024;
+
+		std::vector<LaunchFile> files;
+		std::string content(fileSize, '\0');
+		for (size_t i = 0; i < fileCount; i++) {
+			for (size_t b = 0; b < content.size(); b++) content[b] = static_cast<char>((b * 31 + i) & 0xFF);
+			auto path = benchRoot / "libraries" / std::format("lib{}.jar", i);
+			std::filesystem::create_directories(path.parent_path());
+			std::ofstream(path, std::ios::binary).write(content.data(), content.size());
+			files.push_back({ path, Sha1::HashHex(content), content.size() });
+		}
+
+		VerifiedFileCache cache(benchRoot / "verified.bin");
+		auto start = std::chrono::steady_clock::now();
+		auto cold = FileVerifier::Verify(files, &cache);
+		double coldMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		start = std::chrono::steady_clock::now();
+		auto warm = FileVerifier::Verify(files, &cache);
+		double warmMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		Assert::IsTrue(cold.IsOk() && warm.IsOk());
+		Assert::AreEqual(fileCount, cold.Hashed);
+		Assert::AreEqual(fileCount, warm.CacheHits);
+		double totalMb = fileCount * fileSize / (1024.0 * 1024.0);
+		Logger::WriteMessage(std::format("Verify {} files ({:.1f} MB): cold {:>8.2f} ms ({:.1f} MB/s), warm cache {:>8.2f} ms ({:.2f} us/file)\n",
+										 fileCount, totalMb, coldMs, totalMb / (coldMs / 1000.0), warmMs, warmMs * 1000.0 / fileCount).c_str());
+	}
+
+	/**
+	 * @brief Natives 批量并行提取
+	 * @details 模拟 LWJGL 的 8 个 Native 库 Jar，每个包含 4 个约 768 KiB 的 dll 与 200 个 .class 条目，
+	 *          比较逐个提取与不同线程数下批量提取的吞吐量。
+	 */
+	TEST_METHOD(BenchNativesExtract) {
+		constexpr size_t jarCount = 8;
+		constexpr size_t dllsPerJar = 4;
+		constexpr size_t dllSize = 768 * 1024;
+		constexpr size_t classesPerJar = 200;
+
+		std::vector<NativesExtractJob> jobs;
+		std::string content(dllSize, '\0');
+		for (size_t j = 0; j < jarCount; j++) {
+			auto jarPath = benchRoot / "natives" / std::format("lwjgl-module{}-natives-windows.jar", j);
+			std::filesystem::create_directories(jarPath.parent_path());
+
+			mz_zip_archive zip;
+			memset(&zip, 0, sizeof(zip));
+			Assert::IsTrue(mz_zip_writer_init_file(&zip, jarPath.string().c_str(), 0));
+			for (size_t c = 0; c < classesPerJar; c++) {
+				std::string name = std::format("org/lwjgl/module{}/Class{}.class", j, c);
+				mz_zip_writer_add_mem(&zip, name.c_str(), name.data(), name.size(), MZ_DEFAULT_COMPRESSION);
+			}
+			for (size_t d = 0; d < dllsPerJar; d++) {
+				// 半随机内容，压缩率接近真实的二进制文件
+				uint32_t seed = static_cast<uint32_t>(j * 131 + d);
+				for (size_t b = 0; b < content.size(); b++) {
+					seed = seed * 1103515245 + 12345;
+					content[b] = (b & 1) ? static_cast<char>(seed >> 24) : static_cast<char>(b & 0x0F);
+				}
+				std::string name = std::format("windows/x64/org/lwjgl/lwjgl_module{}_{}.dll", j, d);
+				mz_zip_writer_add_mem(&zip, name.c_str(), content.data(), content.size(), MZ_DEFAULT_COMPRESSION);
+			}
+			mz_zip_writer_add_mem(&zip, "META-INF/MANIFEST.MF", "Manifest-Version: 1.0\n", 22, MZ_DEFAULT_COMPRESSION);
+			mz_zip_writer_finalize_archive(&zip);
+			mz_zip_writer_end(&zip);
+			jobs.push_back({ jarPath, {}, { "META-INF/" } });
+		}
+
+		double totalMb = jarCount * dllsPerJar * dllSize / (1024.0 * 1024.0);
+		size_t totalFiles = jarCount * dllsPerJar;
+
+		auto serialDir = benchRoot / "serial";
+		auto start = std::chrono::steady_clock::now();
+		for (const auto &job : jobs) Assert::IsTrue(NativesUtils::Extract(job.JarPath, serialDir, job.Exclude));
+		double serialMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		Logger::WriteMessage(std::format("Extract natives sequential: {:>8.2f} ms ({:.1f} MB/s, {:.0f} files/s)\n",
+										 serialMs, totalMb / (serialMs / 1000.0), totalFiles / (serialMs / 1000.0)).c_str());
+
+		for (size_t workers : { 1, 2, 4, 8 }) {
+			auto dir = benchRoot / std::format("batch{}", workers);
+			for (auto &job : jobs) job.TargetDir = dir;
+
+			start = std::chrono::steady_clock::now();
+			auto result = NativesUtils::ExtractBatch(jobs, workers);
+			double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+			Assert::IsTrue(result.AllSucceeded());
+			Assert::AreEqual(totalFiles, result.Files);
+			Logger::WriteMessage(std::format("Extract natives batch ({} workers): {:>8.2f} ms ({:.1f} MB/s, {:.0f} files/s)\n",
+											 workers, ms, totalMb / (ms / 1000.0), totalFiles / (ms / 1000.0)).c_str());
+		}
+	}
+	};
+}
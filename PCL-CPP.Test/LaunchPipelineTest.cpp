@@ -0,0 +1,249 @@
+#include "pch.h"
+#include "Launcher/Launch/FileVerifier.h"
+#include "Launcher/Launch/LaunchPipeline.h"
+#include "Launcher/Version/CompiledVersion.h"
+#include "Launcher/Version/VersionLocator.h"
+#include "Utils/Hashing/Sha1.h"
+#include "Utils/Threading/TaskGraph.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace PCL_CPP::Core::Launcher::Launch;
+using namespace PCL_CPP::Core::Launcher::Version;
+using namespace PCL_CPP::Core::Utils;
+
+namespace PCLCPPTest {
+	TEST_CLASS(LaunchPipelineTest) {
+	public:
+	std::filesystem::path testRoot = "TestPipeline";
+
+	/**
+	 * @brief 测试初始化：准备原版 1.18.2 的版本目录
+	 */
+	TEST_METHOD_INITIALIZE(Setup) {
+		if (std::filesystem::exists(testRoot)) std::filesystem::remove_all(testRoot);
+		std::filesystem::create_directories(testRoot / "versions" / "1.18.2");
+
+		std::filesystem::path assetsDir = TEST_ASSETS_DIR;
+		std::filesystem::copy_file(assetsDir / "1.18.2.json", testRoot / "versions/1.18.2/1.18.2.json");
+	}
+
+	/**
+	 * @brief 测试任务图：依赖完成后才执行，失败的任务使其所有后继被跳过，无关任务不受影响
+	 */
+	TEST_METHOD(TestTaskGraphDependencies) {
+		TaskGraph graph;
+		std::atomic<int> executed = 0;
+		auto a = graph.Add("A", [&] { executed++; return true; });
+		auto b = graph.Add("B", [&] { executed++; return true; }, { a });
+		auto c = graph.Add("C", [&]() -> bool { throw std::runtime_error("broken"); });
+		auto d = graph.Add("D", [&] { executed++; return true; }, { c });
+		auto e = graph.Add("E", [&] { executed++; return true; }, { b, d });
+
+		Assert::IsFalse(graph.Run(4));
+		Assert::AreEqual(2, executed.load());
+		Assert::IsTrue(graph.GetTask(a).Status == TaskStatus::Succeeded);
+		Assert::IsTrue(graph.GetTask(b).Status == TaskStatus::Succeeded);
+		Assert::IsTrue(graph.GetTask(b).Start >= graph.GetTask(a).End);
+		Assert::IsTrue(graph.GetTask(c).Status == TaskStatus::Failed);
+		Assert::IsTrue(graph.GetTask(c).Error != nullptr);
+		Assert::IsTrue(graph.GetTask(d).Status == TaskStatus::Skipped);
+		Assert::IsTrue(graph.GetTask(e).Status == TaskStatus::Skipped);
+
+		// 依赖只能引用已添加的任务
+		auto addInvalid = [&] { graph.Add("F", [] { return true; }, { 100 }); };
+		Assert::ExpectException<std::invalid_argument>(addInvalid);
+	}
+
+	/**
+	 * @brief 测试关键路径：回溯到最晚结束的依赖
+	 */
+	TEST_METHOD(TestTaskGraphCriticalPath) {
+		using namespace std::chrono_literals;
+		TaskGraph graph;
+		auto slow = graph.Add("Slow", [] { std::this_thread::sleep_for(50ms); return true; });
+		auto fast = graph.Add("Fast", [] { return true; });
+		auto middle = graph.Add("Middle", [] { return true; }, { fast });
+		auto sink = graph.Add("Sink", [] { return true; }, { slow, middle });
+
+		Assert::IsTrue(graph.Run(3));
+		auto path = graph.GetCriticalPath(sink);
+		Assert::AreEqual((size_t) 2, path.size());
+		Assert::AreEqual(slow, path[0]);
+		Assert::AreEqual(sink, path[1]);
+		Assert::IsTrue(graph.GetCriticalPath() == path);
+	}
+
+	/**
+	 * @brief 测试启动前流水线：依赖满足后拉起进程，缺失资源索引不阻塞启动，缺失依赖库时不拉起
+	 */
+	TEST_METHOD(TestPipelineSpawn) {
+		auto version = VersionLocator::GetVersion(testRoot / "versions", "1.18.2");
+		Assert::IsTrue(version.has_value());
+		auto compiled = CompiledVersion::Compile(*version);
+
+		LaunchContext ctx;
+		ctx.GameRoot = testRoot;
+		ctx.NativesDir = testRoot / "natives";
+
+		// 为所有依赖库创建占位文件
+		auto files = LaunchPlanner(compiled, ctx).GetLaunchFiles();
+		Assert::IsFalse(files.empty());
+		for (const auto &file : files) {
+			std::filesystem::create_directories(file.Path.parent_path());
+			std::ofstream(file.Path) << "jar";
+		}
+
+		int spawnCount = 0;
+		ProcessStartInfo spawnedInfo;
+		LaunchPipelineOptions options;
+		options.VerifyIntegrity = false; // 占位文件与声明的 SHA-1 不一致
+		options.Spawn = [&](const ProcessStartInfo &info) {
+			spawnCount++;
+			spawnedInfo = info;
+			return true;
+		};
+
+		auto result = LaunchPipeline(compiled, ctx, options).Run();
+		Assert::IsTrue(result.Spawned);
+		Assert::AreEqual(1, spawnCount);
+		Assert::IsTrue(spawnedInfo.Arguments == LaunchPlanner(compiled, ctx).Plan().Arguments);
+		Assert::IsTrue(result.MissingFiles.empty());
+		Assert::AreEqual((size_t) 5, result.Stages.size());
+		Assert::AreEqual(std::string("Spawn"), result.CriticalPath.back());
+
+		auto stage = [&](const std::string &name) {
+			return *std::find_if(result.Stages.begin(), result.Stages.end(), [&](const LaunchStage &s) { return s.Name == name; });
+		};
+		Assert::IsTrue(stage("LoadAssetIndex").Status == TaskStatus::Failed);
+
+		// 删除一个依赖库后不再拉起进程
+		std::filesystem::remove(files.front().Path);
+		result = LaunchPipeline(compiled, ctx, options).Run();
+		Assert::IsFalse(result.Spawned);
+		Assert::AreEqual(1, spawnCount);
+		Assert::AreEqual((size_t) 1, result.MissingFiles.size());
+		Assert::IsTrue(stage("Spawn").Status == TaskStatus::Skipped);
+	}
+
+	/**
+	 * @brief 测试含系统条件依赖库的版本：流水线并发执行各阶段，结果与单线程规划一致
+	 */
+	TEST_METHOD(TestPipelineConditionalLibraries) {
+		auto compiled = CompiledVersion::Compile(*VersionLocator::GetSharedVersion(testRoot / "versions", "1.18.2"));
+
+		for (const char *os : { "windows", "linux", "osx" }) {
+			LaunchContext ctx;
+			ctx.GameRoot = testRoot;
+			ctx.NativesDir = testRoot / "natives" / os;
+			ctx.Target = TargetEnvironment { os, "", "x64" };
+
+			// 1.18.2 在 macOS 上使用 LWJGL 3.2.1，其他系统使用 3.2.2
+			auto files = LaunchPlanner(compiled, ctx).GetLaunchFiles();
+			bool hasMacLwjgl = std::any_of(files.begin(), files.end(), [](const LaunchFile &file) {
+				return file.Path.generic_string().find("/lwjgl/3.2.1/") != std::string::npos;
+			});
+			Assert::AreEqual(std::string(os) == "osx", hasMacLwjgl);
+
+			for (const auto &file : files) {
+				std::filesystem::create_directories(file.Path.parent_path());
+				std::ofstream(file.Path) << "jar";
+			}
+			auto expected = LaunchPlanner(compiled, ctx).Plan();
+
+			ProcessStartInfo spawnedInfo;
+			LaunchPipelineOptions options;
+			options.MaxWorkers = 4;
+			options.VerifyIntegrity = false;
+			options.Spawn = [&](const ProcessStartInfo &info) {
+				spawnedInfo = info;
+				return true;
+			};
+
+			// 多次运行以覆盖不同的线程交错
+			for (int i = 0; i < 8; i++) {
+				auto result = LaunchPipeline(compiled, ctx, options).Run();
+				Assert::IsTrue(result.Spawned);
+				Assert::IsTrue(result.MissingFiles.empty());
+				Assert::IsTrue(spawnedInfo.Arguments == expected.Arguments);
+			}
+		}
+	}
+
+	/**
+	 * @brief 测试 SHA-1 摘要与校验值比对
+	 */
+	TEST_METHOD(TestSha1) {
+		Assert::AreEqual(std::string("da39a3ee5e6b4b0d3255bfef95601890afd80709"), Sha1::HashHex(""));
+		Assert::AreEqual(std::string("a9993e364706816aba3e25717850c26c9cd0d89d"), Sha1::HashHex("abc"));
+
+		// 跨分组的增量输入与一次性输入结果一致
+		std::string data(1000, 'x');
+		Sha1 sha;
+		sha.Update(std::string_view(data).substr(0, 70));
+		sha.Update(std::string_view(data).substr(70));
+		auto digest = sha.Finish();
+		Assert::AreEqual(Sha1::HashHex(data), Sha1::ToHex(digest));
+		std::string upper = Sha1::ToHex(digest);
+		std::transform(upper.begin(), upper.end(), upper.begin(), [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+		Assert::IsTrue(Sha1::Matches(digest, upper));
+		Assert::IsFalse(Sha1::Matches(digest, Sha1::HashHex("abc")));
+	}
+
+	/**
+	 * @brief 测试文件校验：校验记录命中时不读取内容，文件被修改后重新校验
+	 */
+	TEST_METHOD(TestFileVerifier) {
+		auto libraries = testRoot / "libraries";
+		std::filesystem::create_directories(libraries);
+
+		std::vector<LaunchFile> files;
+		for (int i = 0; i < 8; i++) {
+			std::string content = "library " + std::to_string(i);
+			auto path = libraries / ("lib" + std::to_string(i) + ".jar");
+			std::ofstream(path, std::ios::binary) << content;
+			files.push_back({ path, Sha1::HashHex(content), content.size() });
+		}
+		files.push_back({ libraries / "client.jar" }); // 未声明校验值，只检查存在性
+
+		auto cachePath = testRoot / "verified.bin";
+		auto cache = std::make_shared<VerifiedFileCache>(cachePath);
+		auto result = FileVerifier::Verify(files, cache.get(), 4);
+		Assert::AreEqual((size_t) 1, result.Failures.size());
+		Assert::IsTrue(result.Failures[0].Reason == VerifyFailureReason::Missing);
+		Assert::AreEqual((size_t) 8, result.Hashed);
+
+		std::ofstream(libraries / "client.jar") << "client";
+		Assert::IsTrue(cache->Save());
+
+		// 重新加载记录：所有声明了校验值的文件均命中
+		VerifiedFileCache reloaded(cachePath);
+		Assert::IsTrue(reloaded.Load());
+		Assert::AreEqual((size_t) 8, reloaded.Size());
+		result = FileVerifier::Verify(files, &reloaded, 4);
+		Assert::IsTrue(result.IsOk());
+		Assert::AreEqual((size_t) 8, result.CacheHits);
+		Assert::AreEqual((size_t) 0, result.Hashed);
+
+		// 内容损坏（大小不变）：签名变化后重新计算 SHA-1 并报告
+		std::ofstream(files[0].Path, std::ios::binary | std::ios::in | std::ios::out) << "L";
+		std::filesystem::last_write_time(files[0].Path, std::filesystem::last_write_time(files[0].Path) + std::chrono::seconds(5));
+		result = FileVerifier::Verify(files, &reloaded, 4);
+		Assert::AreEqual((size_t) 1, result.Hashed);
+		Assert::AreEqual((size_t) 1, result.Failures.size());
+		Assert::IsTrue(result.Failures[0].Reason == VerifyFailureReason::HashMismatch);
+		Assert::AreEqual((size_t) 7, reloaded.Size());
+
+		// 大小与声明不一致时无需读取内容
+		std::ofstream(files[1].Path, std::ios::app) << "extra";
+		result = FileVerifier::Verify(files, &reloaded, 4);
+		Assert::AreEqual((size_t) 2, result.Failures.size());
+		Assert::IsTrue(result.Failures[1].Reason == VerifyFailureReason::SizeMismatch);
+	}
+	};
+}
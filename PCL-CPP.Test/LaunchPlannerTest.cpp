@@ -1,6 +1,10 @@
 #include "pch.h"
 #include "Launcher/Launch/LaunchPlanner.h"
+#include "Launcher/Version/CompiledVersion.h"
 #include "Launcher/Version/VersionLocator.h"
+#include <fstream>
+#include <set>
+#include <sstream>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace PCL_CPP::Core::Launcher::Version;
@@ -113,5 +117,518 @@ namespace PCLCPPTest {
 		}
 		Assert::IsTrue(foundWidth, L"应包含分辨率参数");
 	}
+
+	/**
+	 * @brief 测试使用仅含头部字段的版本进行启动规划
+	 */
+	TEST_METHOD(TestPlanGeneration_HeaderOnly) {
+		auto versions = VersionLocator::ListVersions(testRoot / "versions");
+		auto it = std::find_if(versions.begin(), versions.end(), [](const VersionInfo &v) { return v.Id == "1.18.2"; });
+		Assert::IsTrue(it != versions.end());
+		Assert::IsTrue(it->IsHeaderOnly);
+
+		LaunchContext ctx;
+		ctx.GameRoot = testRoot;
+		ctx.NativesDir = testRoot / "natives";
+
+		LaunchPlanner planner(*it, ctx);
+		ProcessStartInfo info = planner.Plan();
+
+		bool foundCp = false;
+		for (const auto &arg : info.Arguments) {
+			if (arg.find("oshi-core") != std::string::npos) foundCp = true;
+		}
+		Assert::IsTrue(foundCp, L"懒加载版本在规划时应加载完整依赖库");
+	}
+
+	/**
+	 * @brief 测试仅含头部字段的版本无法加载完整配置时编译失败，而不是生成空的规划
+	 */
+	TEST_METHOD(TestPlanGeneration_HeaderOnlyMissing) {
+		auto versions = VersionLocator::ListVersions(testRoot / "versions");
+		auto it = std::find_if(versions.begin(), versions.end(), [](const VersionInfo &v) { return v.Id == "1.18.2"; });
+		Assert::IsTrue(it != versions.end());
+
+		VersionInfo missing = *it;
+		missing.RootPath = testRoot / "versions" / "missing";
+		Assert::ExpectException<std::runtime_error>([&]() { CompiledVersion::Compile(missing); });
+	}
+
+	/**
+	 * @brief 测试复用编译模型进行多次规划
+	 */
+	TEST_METHOD(TestPlanGeneration_Compiled) {
+		auto version = VersionLocator::GetVersion(testRoot / "versions", "1.18.2");
+		Assert::IsTrue(version.has_value());
+
+		auto compiled = CompiledVersion::Compile(*version);
+		Assert::AreEqual(version->RawData["libraries"].size(), compiled->Libraries.size());
+		Assert::IsTrue(compiled->HasGameArguments && compiled->HasJvmArguments);
+		Assert::IsFalse(compiled->HasLegacyArguments);
+
+		LaunchContext ctx;
+		ctx.GameRoot = testRoot;
+		ctx.NativesDir = testRoot / "natives";
+		ProcessStartInfo expected = LaunchPlanner(*version, ctx).Plan();
+
+		// 同一编译模型可用于不同的启动上下文
+		for (const char *player : { "Steve", "Alex" }) {
+			ctx.Auth.PlayerName = player;
+			ProcessStartInfo info = LaunchPlanner(compiled, ctx).Plan();
+			auto it = std::find(info.Arguments.begin(), info.Arguments.end(), "--username");
+			Assert::IsTrue(it != info.Arguments.end() && *(it + 1) == player);
+			Assert::AreEqual(expected.Arguments.size(), info.Arguments.size());
+		}
+	}
+
+	/**
+	 * @brief 测试旧版 minecraftArguments 的编译与替换
+	 */
+	TEST_METHOD(TestPlanGeneration_Legacy) {
+		std::filesystem::create_directories(testRoot / "versions" / "1.8.9");
+		nlohmann::json legacy = {
+			{"id", "1.8.9"},
+			{"mainClass", "net.minecraft.client.main.Main"},
+			{"libraries", nlohmann::json::array()},
+			{"minecraftArguments", "--username ${auth_player_name}  --version ${version_name}"}
+		};
+		std::ofstream(testRoot / "versions/1.8.9/1.8.9.json") << legacy.dump();
+
+		auto version = VersionLocator::GetVersion(testRoot / "versions", "1.8.9");
+		Assert::IsTrue(version.has_value());
+		auto compiled = CompiledVersion::Compile(*version);
+		Assert::AreEqual((size_t) 4, compiled->LegacyGameArguments.size(), L"空片段应在编译时被丢弃");
+
+		LaunchContext ctx;
+		ctx.GameRoot = testRoot;
+		ctx.Auth.PlayerName = "Herobrine";
+		ProcessStartInfo info = LaunchPlanner(compiled, ctx).Plan();
+
+		std::vector<std::string> tail(info.Arguments.end() - 4, info.Arguments.end());
+		Assert::IsTrue(tail == std::vector<std::string> { "--username", "Herobrine", "--version", "1.8.9" });
+		Assert::IsTrue(std::find(info.Arguments.begin(), info.Arguments.end(), "-cp") != info.Arguments.end(), L"旧版应注入默认 JVM 参数");
+	}
+
+	/**
+	 * @brief 测试叠加形式的继承版本与平铺后的版本生成相同的启动规划
+	 */
+	TEST_METHOD(TestPlanGeneration_Overlay) {
+		std::filesystem::create_directories(testRoot / "versions" / "1.18.2-loader");
+		nlohmann::json loader = {
+			{"id", "1.18.2-loader"},
+			{"inheritsFrom", "1.18.2"},
+			{"mainClass", "loader.Main"},
+			{"libraries", { {{"name", "org.example:loader:1.0"}} }},
+			{"arguments", { {"game", {"--loader"}}, {"jvm", {"-Dloader=true"}} }}
+		};
+		std::ofstream(testRoot / "versions/1.18.2-loader/1.18.2-loader.json") << loader.dump();
+
+		auto versions = VersionLocator::GetAllSharedVersions(testRoot / "versions");
+		auto it = std::find_if(versions.begin(), versions.end(), [](const auto &v) { return v->Id == "1.18.2-loader"; });
+		Assert::IsTrue(it != versions.end());
+		Assert::IsTrue((*it)->Parent != nullptr, L"GetAllSharedVersions 应返回叠加形式的继承版本");
+
+		auto flat = VersionLocator::GetVersion(testRoot / "versions", "1.18.2-loader");
+		Assert::IsTrue(flat.has_value());
+
+		LaunchContext ctx;
+		ctx.GameRoot = testRoot;
+		ctx.NativesDir = testRoot / "natives";
+
+		ProcessStartInfo overlayInfo = LaunchPlanner(**it, ctx).Plan();
+		ProcessStartInfo flatInfo = LaunchPlanner(*flat, ctx).Plan();
+		Assert::IsTrue(overlayInfo.Arguments == flatInfo.Arguments, L"叠加视图与平铺结果应生成相同的参数");
+		Assert::IsTrue(std::find(overlayInfo.Arguments.begin(), overlayInfo.Arguments.end(), "--loader") != overlayInfo.Arguments.end());
+	}
+
+	/**
+	 * @brief 测试为不同目标环境规划（与运行主机无关）
+	 */
+	TEST_METHOD(TestPlanForTargets) {
+		auto version = VersionLocator::GetVersion(testRoot / "versions", "1.18.2");
+		Assert::IsTrue(version.has_value());
+		auto compiled = CompiledVersion::Compile(*version);
+
+		auto makeTarget = [](std::string os, std::string osVersion, std::string arch) {
+			TargetEnvironment target;
+			target.OsName = std::move(os);
+			target.OsVersion = std::move(osVersion);
+			target.OsArch = std::move(arch);
+			return target;
+		};
+		std::vector<TargetEnvironment> targets = {
+			makeTarget("windows", "10.0", "x64"),
+			makeTarget("linux", "6.1", "x64"),
+			makeTarget("osx", "14.0", "arm64"),
+			makeTarget("windows", "6.1", "x86"),
+		};
+
+		LaunchContext ctx;
+		ctx.GameRoot = testRoot;
+		ctx.NativesDir = testRoot / "natives";
+
+		auto contains = [](const ProcessStartInfo &info, const std::string &arg) {
+			return std::find(info.Arguments.begin(), info.Arguments.end(), arg) != info.Arguments.end();
+		};
+		auto classpathOf = [](const ProcessStartInfo &info) {
+			auto it = std::find(info.Arguments.begin(), info.Arguments.end(), "-cp");
+			Assert::IsTrue(it != info.Arguments.end() && it + 1 != info.Arguments.end());
+			return *(it + 1);
+		};
+
+		std::vector<ProcessStartInfo> plans;
+		for (const auto &target : targets) {
+			ctx.Target = target;
+			plans.push_back(LaunchPlanner(compiled, ctx).Plan());
+		}
+
+		// Windows 10 x64：Windows 专属参数与分号分隔
+		Assert::IsTrue(contains(plans[0], "-Dos.name=Windows 10"));
+		Assert::IsFalse(contains(plans[0], "-XstartOnFirstThread"));
+		Assert::IsTrue(classpathOf(plans[0]).find(';') != std::string::npos);
+		Assert::IsTrue(classpathOf(plans[0]).find("lwjgl-3.2.2.jar") != std::string::npos);
+
+		// Linux：冒号分隔，不包含 Windows 参数
+		Assert::IsFalse(contains(plans[1], "-Dos.name=Windows 10"));
+		Assert::IsTrue(classpathOf(plans[1]).find(';') == std::string::npos);
+		Assert::IsTrue(classpathOf(plans[1]).find(':') != std::string::npos);
+
+		// macOS：使用 3.2.1 版本的 LWJGL 与 macOS 专属参数
+		Assert::IsTrue(contains(plans[2], "-XstartOnFirstThread"));
+		Assert::IsTrue(classpathOf(plans[2]).find("lwjgl-3.2.1.jar") != std::string::npos);
+		Assert::IsTrue(classpathOf(plans[2]).find("lwjgl-3.2.2.jar") == std::string::npos);
+
+		// Windows 7 x86：架构规则生效，版本规则不生效
+		Assert::IsTrue(contains(plans[3], "-Xss1M"));
+		Assert::IsFalse(contains(plans[3], "-Dos.name=Windows 10"));
+
+		// 批量规划与逐个规划结果一致
+		ctx.Target.reset();
+		auto batch = LaunchPlanner::PlanBatch(compiled, ctx, targets);
+		Assert::AreEqual(plans.size(), batch.size());
+		for (size_t i = 0; i < plans.size(); i++) {
+			Assert::IsTrue(plans[i].Arguments == batch[i].Arguments);
+		}
+
+		// 目标环境自带的功能开关同样生效，上下文中的自定义开关优先
+		TargetEnvironment demo = targets[0];
+		demo.Features["is_demo_user"] = true;
+		ctx.Target = demo;
+		Assert::IsTrue(contains(LaunchPlanner(compiled, ctx).Plan(), "--demo"));
+		ctx.CustomFeatures["is_demo_user"] = false;
+		Assert::IsFalse(contains(LaunchPlanner(compiled, ctx).Plan(), "--demo"));
+	}
+
+	/**
+	 * @brief 测试继承版本的 Classpath 去重
+	 */
+	TEST_METHOD(TestPlanGeneration_Dedup) {
+		// 加载器版本重新声明了原版已有的库：一个更旧的 guava 与一个完全相同的 logging
+		std::filesystem::create_directories(testRoot / "versions" / "1.18.2-loader");
+		nlohmann::json loader = {
+			{"id", "1.18.2-loader"},
+			{"inheritsFrom", "1.18.2"},
+			{"libraries", { {{"name", "com.google.guava:guava:30.0-jre"}}, {{"name", "com.mojang:logging:1.0.0"}}, {{"name", "org.example:loader:1.0"}} }}
+		};
+		std::ofstream(testRoot / "versions/1.18.2-loader/1.18.2-loader.json") << loader.dump();
+
+		auto version = VersionLocator::GetVersion(testRoot / "versions", "1.18.2-loader");
+		Assert::IsTrue(version.has_value());
+		auto compiled = CompiledVersion::Compile(*version);
+
+		LaunchContext ctx;
+		ctx.GameRoot = testRoot;
+		ctx.NativesDir = testRoot / "natives";
+		ctx.Target = TargetEnvironment { "windows", "10.0", "x64" };
+
+		auto classpathOf = [](const ProcessStartInfo &info) {
+			auto it = std::find(info.Arguments.begin(), info.Arguments.end(), "-cp");
+			Assert::IsTrue(it != info.Arguments.end() && it + 1 != info.Arguments.end());
+			std::vector<std::string> entries;
+			std::stringstream ss(*(it + 1));
+			std::string entry;
+			while (std::getline(ss, entry, ';')) entries.push_back(entry);
+			return entries;
+		};
+		auto containsEntry = [](const std::vector<std::string> &entries, const std::string &fragment) {
+			return std::any_of(entries.begin(), entries.end(), [&](const std::string &e) { return e.find(fragment) != std::string::npos; });
+		};
+
+		// 默认策略：子版本胜出，保留原版中首次出现的位置
+		LaunchPlanner planner(compiled, ctx);
+		auto childWins = classpathOf(planner.Plan());
+		Assert::AreEqual((size_t) 2, planner.GetDroppedLibraries().size());
+		Assert::IsTrue(containsEntry(childWins, "guava-30.0-jre.jar"));
+		Assert::IsFalse(containsEntry(childWins, "guava-31.0.1-jre.jar"));
+		std::set<std::string> unique(childWins.begin(), childWins.end());
+		Assert::AreEqual(unique.size(), childWins.size(), L"去重后的 Classpath 不应包含重复条目");
+
+		// 最高版本策略：保留原版的 guava 31
+		ctx.LibraryPolicy = LibraryConflictPolicy::HighestVersion;
+		auto highest = classpathOf(LaunchPlanner(compiled, ctx).Plan());
+		Assert::IsTrue(containsEntry(highest, "guava-31.0.1-jre.jar"));
+		Assert::IsFalse(containsEntry(highest, "guava-30.0-jre.jar"));
+		Assert::AreEqual(childWins.size(), highest.size());
+
+		// 不去重时两者都在，且去重结果的顺序与首次出现的顺序一致
+		ctx.LibraryPolicy = LibraryConflictPolicy::KeepAll;
+		auto all = classpathOf(LaunchPlanner(compiled, ctx).Plan());
+		Assert::AreEqual(childWins.size() + 2, all.size());
+
+		std::vector<std::string> firstSeen;
+		std::set<std::string> seen;
+		for (const auto &entry : all) {
+			if (entry.find("guava-30.0-jre.jar") != std::string::npos) continue;
+			if (seen.insert(entry).second) firstSeen.push_back(entry);
+		}
+		Assert::IsTrue(firstSeen == highest);
+	}
+
+	/**
+	 * @brief 测试规划骨架缓存：仅认证信息与分辨率变化时命中，结果与不使用缓存一致
+	 */
+	TEST_METHOD(TestPlanSkeletonCache) {
+		auto version = VersionLocator::GetVersion(testRoot / "versions", "1.18.2-OptiFine");
+		Assert::IsTrue(version.has_value());
+		auto compiled = CompiledVersion::Compile(*version);
+		Assert::AreNotEqual((uint64_t) 0, compiled->ResolvedHash);
+
+		LaunchContext ctx;
+		ctx.GameRoot = testRoot;
+		ctx.NativesDir = testRoot / "natives";
+		ctx.SkeletonCache = std::make_shared<PlanSkeletonCache>();
+		auto &cache = *ctx.SkeletonCache;
+
+		auto expectPlan = [&](const LaunchContext &c) {
+			LaunchContext uncached = c;
+			uncached.SkeletonCache = nullptr;
+			auto expected = LaunchPlanner(compiled, uncached).Plan();
+			auto actual = LaunchPlanner(compiled, c).Plan();
+			Assert::IsTrue(expected.Arguments == actual.Arguments);
+			Assert::AreEqual(expected.Executable.string(), actual.Executable.string());
+		};
+
+		expectPlan(ctx);
+		Assert::AreEqual((uint64_t) 0, cache.Hits());
+		Assert::AreEqual((uint64_t) 1, cache.Misses());
+
+		// 切换账号与分辨率：命中缓存，只重新渲染易变占位符
+		ctx.Auth.PlayerName = "Alex";
+		ctx.Auth.Uuid = "11111111-1111-1111-1111-111111111111";
+		ctx.Auth.AccessToken = "token";
+		ctx.Width = 1920;
+		ctx.Height = 1080;
+		expectPlan(ctx);
+		Assert::AreEqual((uint64_t) 1, cache.Hits());
+		auto info = LaunchPlanner(compiled, ctx).Plan();
+		auto it = std::find(info.Arguments.begin(), info.Arguments.end(), "--width");
+		Assert::IsTrue(it != info.Arguments.end() && *(it + 1) == "1920");
+
+		// 影响骨架的字段变化时未命中
+		ctx.MaxMemoryMb = 4096;
+		expectPlan(ctx);
+		ctx.CustomFeatures["is_demo_user"] = true;
+		expectPlan(ctx);
+		Assert::AreEqual((uint64_t) 2, cache.Hits());
+		Assert::AreEqual((uint64_t) 3, cache.Misses());
+		Assert::AreEqual((size_t) 3, cache.Size());
+
+		// 修改版本文件后继承链哈希变化，不会命中旧骨架
+		nlohmann::json changed = version->RawData;
+		changed["mainClass"] = "changed.Main";
+		std::ofstream(testRoot / "versions/1.18.2-OptiFine/1.18.2-OptiFine.json") << changed.dump();
+		auto reloaded = CompiledVersion::Compile(*VersionLocator::GetVersion(testRoot / "versions", "1.18.2-OptiFine"));
+		Assert::AreNotEqual(compiled->ResolvedHash, reloaded->ResolvedHash);
+		auto replanned = LaunchPlanner(reloaded, ctx).Plan();
+		Assert::IsTrue(std::find(replanned.Arguments.begin(), replanned.Arguments.end(), "changed.Main") != replanned.Arguments.end());
+	}
+
+	/**
+	 * @brief 测试平铺后的继承版本仍能命中骨架缓存，且父版本变化时不会命中旧骨架
+	 */
+	TEST_METHOD(TestPlanSkeletonCache_Inherited) {
+		std::filesystem::create_directories(testRoot / "versions" / "1.18.2-loader");
+		nlohmann::json loader = {
+			{"id", "1.18.2-loader"},
+			{"inheritsFrom", "1.18.2"},
+			{"mainClass", "loader.Main"},
+			{"libraries", { {{"name", "org.example:loader:1.0"}} }}
+		};
+		std::ofstream(testRoot / "versions/1.18.2-loader/1.18.2-loader.json") << loader.dump();
+
+		auto version = VersionLocator::GetVersion(testRoot / "versions", "1.18.2-loader");
+		Assert::IsTrue(version.has_value());
+		Assert::IsTrue(version->Parent == nullptr);
+		auto compiled = CompiledVersion::Compile(*version);
+		Assert::AreNotEqual((uint64_t) 0, compiled->ResolvedHash);
+
+		// 叠加形式与平铺形式的哈希一致
+		auto shared = VersionLocator::GetAllSharedVersions(testRoot / "versions");
+		auto it = std::find_if(shared.begin(), shared.end(), [](const auto &v) { return v->Id == "1.18.2-loader"; });
+		Assert::IsTrue(it != shared.end());
+		Assert::AreEqual(compiled->ResolvedHash, CompiledVersion::Compile(**it)->ResolvedHash);
+
+		LaunchContext ctx;
+		ctx.GameRoot = testRoot;
+		ctx.NativesDir = testRoot / "natives";
+		ctx.SkeletonCache = std::make_shared<PlanSkeletonCache>();
+		auto &cache = *ctx.SkeletonCache;
+
+		auto first = LaunchPlanner(compiled, ctx).Plan();
+		auto second = LaunchPlanner(compiled, ctx).Plan();
+		Assert::AreEqual((uint64_t) 1, cache.Hits());
+		Assert::AreEqual((uint64_t) 1, cache.Misses());
+		Assert::IsTrue(first.Arguments == second.Arguments);
+
+		// 只修改父版本：子版本的哈希随之变化
+		auto parentJson = testRoot / "versions/1.18.2/1.18.2.json";
+		auto parent = nlohmann::json::parse(std::ifstream(parentJson));
+		parent["assets"] = "changed";
+		std::ofstream(parentJson) << parent.dump();
+		auto reloaded = CompiledVersion::Compile(*VersionLocator::GetVersion(testRoot / "versions", "1.18.2-loader"));
+		Assert::AreNotEqual((uint64_t) 0, reloaded->ResolvedHash);
+		Assert::AreNotEqual(compiled->ResolvedHash, reloaded->ResolvedHash);
+		LaunchPlanner(reloaded, ctx).Plan();
+		Assert::AreEqual((uint64_t) 2, cache.Misses());
+	}
+
+	/**
+	 * @brief 测试 CDS 归档管理：首次启动生成归档，之后复用；Classpath 或 JDK 变化时得到新的归档
+	 */
+	TEST_METHOD(TestCdsArchives) {
+		// 伪造的 JDK 安装目录，运行时信息只读取 release 文件，不需要真实的 JVM
+		auto jdk = testRoot / "jdk";
+		auto writeRelease = [&](const std::string &version) {
+			std::ofstream(jdk / "release") << "IMPLEMENTOR=\"Test\"\nJAVA_VERSION=\"" << version << "\"\n";
+		};
+		std::filesystem::create_directories(jdk / "bin");
+		std::ofstream(jdk / "bin" / "javaw.exe") << "";
+		writeRelease("17.0.8");
+
+		auto compiled = CompiledVersion::Compile(*VersionLocator::GetVersion(testRoot / "versions", "1.18.2-OptiFine"));
+		LaunchContext ctx;
+		ctx.GameRoot = testRoot;
+		ctx.NativesDir = testRoot / "natives";
+		ctx.JavaPath = jdk / "bin" / "javaw.exe";
+		ctx.CdsArchives = std::make_shared<CdsArchiveCache>(testRoot / "cds");
+
+		// 首次启动：由 JVM 在退出时生成归档
+		LaunchPlanner first(compiled, ctx);
+		auto info = first.Plan();
+		auto archive = first.GetCdsDecision().ArchivePath;
+		Assert::IsTrue(first.GetCdsDecision().Mode == CdsMode::Dump);
+		Assert::AreEqual("-XX:ArchiveClassesAtExit=" + archive.string(), info.Arguments.front());
+		first.OnLaunched();
+
+		// 模拟 JVM 写出归档；新的缓存对象模拟下次运行
+		std::ofstream(archive, std::ios::binary) << std::string(1000, 'x');
+		ctx.CdsArchives = std::make_shared<CdsArchiveCache>(testRoot / "cds");
+		Assert::IsTrue(ctx.CdsArchives->Load());
+		LaunchPlanner second(compiled, ctx);
+		info = second.Plan();
+		Assert::IsTrue(second.GetCdsDecision().Mode == CdsMode::Use);
+		Assert::AreEqual("-XX:SharedArchiveFile=" + archive.string(), info.Arguments.front());
+
+		// 其余参数与不使用 CDS 时一致
+		LaunchContext plain = ctx;
+		plain.CdsArchives = nullptr;
+		auto expected = LaunchPlanner(compiled, plain).Plan();
+		Assert::IsTrue(std::vector<std::string>(info.Arguments.begin() + 1, info.Arguments.end()) == expected.Arguments);
+
+		// Classpath 变化（游戏目录迁移）：旧归档立即删除，重新生成
+		ctx.GameRoot = testRoot / "moved";
+		LaunchPlanner moved(compiled, ctx);
+		moved.Plan();
+		Assert::IsTrue(moved.GetCdsDecision().Mode == CdsMode::Dump);
+		Assert::IsFalse(std::filesystem::exists(archive));
+
+		// JDK 更新：运行时标识变化，使用新的归档
+		writeRelease("17.0.10");
+		LaunchPlanner updated(compiled, ctx);
+		updated.Plan();
+		Assert::IsTrue(updated.GetCdsDecision().Mode == CdsMode::Dump);
+		Assert::IsFalse(updated.GetCdsDecision().ArchivePath == moved.GetCdsDecision().ArchivePath);
+
+		// 不支持动态归档的 JDK 不添加任何参数
+		writeRelease("1.8.0_302");
+		LaunchPlanner legacy(compiled, ctx);
+		info = legacy.Plan();
+		Assert::IsTrue(legacy.GetCdsDecision().Mode == CdsMode::Disabled);
+		for (const auto &arg : info.Arguments) Assert::IsFalse(arg.starts_with("-XX:ArchiveClassesAtExit") || arg.starts_with("-XX:SharedArchiveFile"));
+	}
+
+	/**
+	 * @brief 测试平铺后的继承版本同样使用 CDS 归档
+	 */
+	TEST_METHOD(TestCdsArchives_Inherited) {
+		auto jdk = testRoot / "jdk";
+		std::filesystem::create_directories(jdk / "bin");
+		std::ofstream(jdk / "bin" / "javaw.exe") << "";
+		std::ofstream(jdk / "release") << "JAVA_VERSION=\"17.0.8\"\n";
+
+		std::filesystem::create_directories(testRoot / "versions" / "1.18.2-loader");
+		nlohmann::json loader = {
+			{"id", "1.18.2-loader"},
+			{"inheritsFrom", "1.18.2"},
+			{"mainClass", "loader.Main"},
+			{"libraries", { {{"name", "org.example:loader:1.0"}} }}
+		};
+		std::ofstream(testRoot / "versions/1.18.2-loader/1.18.2-loader.json") << loader.dump();
+		auto compiled = CompiledVersion::Compile(*VersionLocator::GetVersion(testRoot / "versions", "1.18.2-loader"));
+
+		LaunchContext ctx;
+		ctx.GameRoot = testRoot;
+		ctx.NativesDir = testRoot / "natives";
+		ctx.JavaPath = jdk / "bin" / "javaw.exe";
+		ctx.CdsArchives = std::make_shared<CdsArchiveCache>(testRoot / "cds");
+
+		LaunchPlanner first(compiled, ctx);
+		first.Plan();
+		Assert::IsTrue(first.GetCdsDecision().Mode == CdsMode::Dump);
+		first.OnLaunched();
+
+		std::ofstream(first.GetCdsDecision().ArchivePath, std::ios::binary) << std::string(1000, 'x');
+		LaunchPlanner second(compiled, ctx);
+		second.Plan();
+		Assert::IsTrue(second.GetCdsDecision().Mode == CdsMode::Use);
+		Assert::IsTrue(second.GetCdsDecision().ArchivePath == first.GetCdsDecision().ArchivePath);
+	}
+
+	/**
+	 * @brief 测试 CDS 归档的容量预算与生成失败后的退避
+	 */
+	TEST_METHOD(TestCdsArchiveBudget) {
+		CdsArchiveCache cache(testRoot / "cds", 1500);
+		auto produce = [&](const CdsArchiveKey &key) {
+			auto decision = cache.Acquire(key);
+			Assert::IsTrue(decision.Mode == CdsMode::Dump);
+			cache.CommitLaunch(decision);
+			std::ofstream(decision.ArchivePath, std::ios::binary) << std::string(1000, 'x');
+			Assert::IsTrue(cache.Acquire(key).Mode == CdsMode::Use);
+			return decision.ArchivePath;
+		};
+
+		auto older = produce({ 1, 1, 1 });
+		auto newer = produce({ 2, 1, 1 });
+
+		// 两个归档共 2000 字节，超出预算时淘汰最久未使用的
+		Assert::IsFalse(std::filesystem::exists(older));
+		Assert::IsTrue(std::filesystem::exists(newer));
+		Assert::AreEqual((uint64_t) 1000, cache.TotalBytes());
+
+		// 只规划不启动不计入生成尝试
+		CdsArchiveKey failing { 3, 1, 1 };
+		for (uint32_t i = 0; i < CdsArchiveCache::MaxDumpAttempts + 1; i++) {
+			Assert::IsTrue(cache.Acquire(failing).Mode == CdsMode::Dump);
+		}
+
+		// 始终无法生成归档时，启动次数超过尝试次数后不再添加参数
+		for (uint32_t i = 0; i < CdsArchiveCache::MaxDumpAttempts; i++) {
+			auto decision = cache.Acquire(failing);
+			Assert::IsTrue(decision.Mode == CdsMode::Dump);
+			cache.CommitLaunch(decision);
+		}
+		Assert::IsTrue(cache.Acquire(failing).Mode == CdsMode::Disabled);
+	}
 	};
 }
@@ -1,5 +1,13 @@
 #include "pch.h"
+#include "Launcher/Launch/NativesCache.h"
 #include "Launcher/Launch/NativesUtils.h"
+#include "Launcher/Launch/ProcessRunner.h"
+#include "Utils/Hashing/Sha1.h"
+#include "Utils/IO/BackgroundDeleter.h"
+#include "Utils/IO/ZipArchive.h"
+#include <format>
+#include <fstream>
+#include <sstream>
 
 #define MINIZ_NO_TIME
 #define MINIZ_NO_ZLIB_APIS
@@ -7,6 +15,7 @@
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace PCL_CPP::Core::Launcher::Launch;
+using namespace PCL_CPP::Core::Utils;
 
 namespace PCLCPPTest {
 	TEST_CLASS(NativesUtilsTest) {
@@ -73,5 +82,295 @@ namespace PCLCPPTest {
 		Assert::IsTrue(std::filesystem::exists(extractDir / "keep.dll"));
 		Assert::IsFalse(std::filesystem::exists(extractDir / "exclude_me.dll"));
 	}
+
+	/**
+	 * @brief 创建包含指定文件的 Jar
+	 * @param zipPath Jar 路径
+	 * @param entries 文件名与内容
+	 */
+	static void CreateJar(const std::filesystem::path &zipPath, const std::vector<std::pair<std::string, std::string>> &entries, int level = MZ_DEFAULT_COMPRESSION) {
+		mz_zip_archive zip_archive;
+		memset(&zip_archive, 0, sizeof(zip_archive));
+		Assert::IsTrue(mz_zip_writer_init_file(&zip_archive, zipPath.string().c_str(), 0), L"Failed to create zip");
+		for (const auto &[name, data] : entries) {
+			mz_zip_writer_add_mem(&zip_archive, name.c_str(), data.data(), data.size(), level);
+		}
+		mz_zip_writer_finalize_archive(&zip_archive);
+		mz_zip_writer_end(&zip_archive);
+	}
+
+	/**
+	 * @brief 读取文件的全部内容
+	 */
+	static std::string ReadText(const std::filesystem::path &path) {
+		std::ifstream file(path, std::ios::binary);
+		std::stringstream ss;
+		ss << file.rdbuf();
+		return ss.str();
+	}
+
+	/**
+	 * @brief 测试批量并行提取：同名文件的覆盖顺序与逐个提取一致，排除规则按 Jar 生效
+	 */
+	TEST_METHOD(TestExtractBatch) {
+		CreateJar(testRoot / "a.jar", { { "shared.dll", "from a" }, { "a.dll", "a" }, { "x/dup.dll", "a first" }, { "y/dup.dll", "a second" } });
+		CreateJar(testRoot / "b.jar", { { "shared.dll", "from b" }, { "skip_b.dll", "skip" }, { "b.txt", "text" } });
+		CreateJar(testRoot / "c.jar", { { "shared.dll", "from c" } });
+
+		auto batchDir = testRoot / "batch";
+		auto otherDir = testRoot / "other";
+		std::vector<NativesExtractJob> jobs = {
+			{ testRoot / "a.jar", batchDir, {} },
+			{ testRoot / "b.jar", batchDir, { "skip_" } },
+			{ testRoot / "missing.jar", batchDir, {} },
+			{ testRoot / "c.jar", otherDir, {} }
+		};
+		auto result = NativesUtils::ExtractBatch(jobs, 4);
+
+		Assert::IsFalse(result.AllSucceeded());
+		Assert::IsTrue(result.Succeeded == std::vector<bool> { true, true, false, true });
+		// a.dll、dup.dll、shared.dll（batch）与 shared.dll（other）
+		Assert::AreEqual((size_t) 4, result.Files);
+
+		Assert::AreEqual(std::string("from b"), ReadText(batchDir / "shared.dll"));
+		Assert::AreEqual(std::string("a second"), ReadText(batchDir / "dup.dll"));
+		Assert::AreEqual(std::string("a"), ReadText(batchDir / "a.dll"));
+		Assert::IsFalse(std::filesystem::exists(batchDir / "skip_b.dll"));
+		Assert::IsFalse(std::filesystem::exists(batchDir / "b.txt"));
+		// 不同目标目录互不覆盖
+		Assert::AreEqual(std::string("from c"), ReadText(otherDir / "shared.dll"));
+
+		// 与逐个提取的结果一致
+		auto serialDir = testRoot / "serial";
+		NativesUtils::Extract(testRoot / "a.jar", serialDir);
+		NativesUtils::Extract(testRoot / "b.jar", serialDir, { "skip_" });
+		for (const auto &file : std::filesystem::directory_iterator(serialDir)) {
+			Assert::AreEqual(ReadText(file.path()), ReadText(batchDir / file.path().filename()));
+		}
+
+		// 仅大小写不同的文件名在 Windows 上是同一个文件，只写入最终来源
+		CreateJar(testRoot / "upper.jar", { { "Case.dll", "upper" } });
+		CreateJar(testRoot / "lower.jar", { { "case.dll", "lower" } });
+		auto caseDir = testRoot / "case";
+		result = NativesUtils::ExtractBatch({ { testRoot / "upper.jar", caseDir, {} }, { testRoot / "lower.jar", caseDir, {} } }, 4);
+		Assert::IsTrue(result.AllSucceeded());
+		Assert::AreEqual((size_t) 1, result.Files);
+		Assert::AreEqual(std::string("lower"), ReadText(caseDir / "case.dll"));
+
+		// 单个条目损坏时其余条目照常写入，但该 Jar 记为失败
+		auto damaged = testRoot / "damaged.jar";
+		CreateJar(damaged, { { "good.dll", "good" }, { "bad.dll", "CORRUPTME" } }, MZ_NO_COMPRESSION);
+		std::string bytes = ReadText(damaged);
+		bytes[bytes.find("CORRUPTME")] = 'X';
+		std::ofstream(damaged, std::ios::binary | std::ios::trunc) << bytes;
+		result = NativesUtils::ExtractBatch({ { damaged, testRoot / "damaged", {} } });
+		Assert::IsFalse(result.AllSucceeded());
+		Assert::AreEqual((size_t) 1, result.Files);
+		Assert::AreEqual((size_t) 1, result.FailedFiles);
+		Assert::AreEqual(std::string("good"), ReadText(testRoot / "damaged" / "good.dll"));
+	}
+
+	/**
+	 * @brief 测试内容寻址的 Natives 缓存：每个 Jar 只解压一次，组合目录可直接复用
+	 */
+	TEST_METHOD(TestNativesCache) {
+		CreateJar(testRoot / "a.jar", { { "shared.dll", "from a" }, { "a.dll", "a" } });
+		CreateJar(testRoot / "b.jar", { { "shared.dll", "from b" }, { "b.dll", "b" }, { "skip_b.dll", "skip" } });
+
+		std::vector<NativesCache::NativeJar> jars = {
+			{ testRoot / "a.jar", "", {} },
+			{ testRoot / "b.jar", "", { "skip_" } }
+		};
+
+		auto cacheRoot = testRoot / "cache";
+		NativesCache cache(cacheRoot);
+		auto setDir = cache.GetSetDirectory(jars);
+		Assert::IsFalse(std::filesystem::exists(setDir));
+		Assert::IsTrue(cache.Prepare(jars));
+		Assert::AreEqual((uint64_t) 2, cache.ExtractedJars());
+
+		// 靠后的 Jar 覆盖同名文件，排除规则生效
+		Assert::AreEqual(std::string("from b"), ReadText(setDir / "shared.dll"));
+		Assert::IsTrue(std::filesystem::exists(setDir / "a.dll"));
+		Assert::IsTrue(std::filesystem::exists(setDir / "b.dll"));
+		Assert::IsFalse(std::filesystem::exists(setDir / "skip_b.dll"));
+
+		// 再次启动（新的缓存对象模拟新进程）：直接复用组合目录，不做任何解压
+		NativesCache relaunch(cacheRoot);
+		Assert::IsTrue(relaunch.GetSetDirectory(jars) == setDir);
+		Assert::IsTrue(relaunch.Prepare(jars));
+		Assert::AreEqual((uint64_t) 0, relaunch.ExtractedJars());
+		Assert::AreEqual((uint64_t) 1, relaunch.ReusedSets());
+
+		// 排除规则变化：得到新的组合目录，只有 b.jar 需要重新解压
+		jars[1].Exclude.clear();
+		auto otherDir = relaunch.GetSetDirectory(jars);
+		Assert::IsFalse(otherDir == setDir);
+		Assert::IsTrue(relaunch.Prepare(jars));
+		Assert::AreEqual((uint64_t) 1, relaunch.ExtractedJars());
+		Assert::IsTrue(std::filesystem::exists(otherDir / "skip_b.dll"));
+
+		// 缺失的 Jar 不会发布不完整的组合目录
+		jars.push_back({ testRoot / "missing.jar", "0123456789abcdef0123456789abcdef01234567", {} });
+		Assert::IsFalse(relaunch.Prepare(jars));
+		Assert::IsFalse(std::filesystem::exists(relaunch.GetSetDirectory(jars)));
+
+		// 内容与声明的 SHA-1 不一致的 Jar 不会以该 SHA-1 为键写入缓存
+		CreateJar(testRoot / "c.jar", { { "c.dll", "c" } });
+		NativesCache::NativeJar corrupt { testRoot / "c.jar", "0123456789abcdef0123456789abcdef01234567", {} };
+		Assert::IsFalse(relaunch.Prepare({ corrupt }));
+		Assert::IsFalse(std::filesystem::exists(cacheRoot / "jars" / NativesCache::GetJarKey(corrupt)));
+
+		// 声明正确时正常解压
+		std::ifstream in(testRoot / "c.jar", std::ios::binary);
+		corrupt.Sha1 = Sha1::HashHex(std::string((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>()));
+		Assert::IsTrue(relaunch.Prepare({ corrupt }));
+		Assert::IsTrue(std::filesystem::exists(relaunch.GetSetDirectory({ corrupt }) / "c.dll"));
+	}
+
+	/**
+	 * @brief 测试回收已退出实例遗留的临时目录
+	 */
+	TEST_METHOD(TestNativesCacheSweep) {
+		CreateJar(testRoot / "a.jar", { { "a.dll", "a" } });
+		auto cacheRoot = testRoot / "cache";
+
+		// Windows 的 PID 总是 4 的倍数，999 不会对应任何进程
+		auto orphanEntry = cacheRoot / "jars" / "0123.tmp-999-0";
+		auto orphanSet = cacheRoot / "sets" / "4567.tmp-999-1";
+		auto unrelated = cacheRoot / "jars" / "notes.tmp-backup";
+		for (const auto &dir : { orphanEntry, orphanSet, unrelated }) std::filesystem::create_directories(dir);
+
+		NativesCache cache(cacheRoot);
+		Assert::IsTrue(cache.Prepare({ { testRoot / "a.jar", "", {} } }));
+		Assert::IsTrue(BackgroundDeleter::Global().WaitIdle(std::chrono::seconds(10)));
+		Assert::IsFalse(std::filesystem::exists(orphanEntry));
+		Assert::IsFalse(std::filesystem::exists(orphanSet));
+		Assert::IsTrue(std::filesystem::exists(unrelated));
+		Assert::AreEqual((size_t) 0, cache.SweepStaging());
+	}
+
+	/**
+	 * @brief 测试内存映射的 Zip 读取器：存储条目零拷贝、Deflate 条目按需解压、中央目录缓存
+	 */
+	TEST_METHOD(TestZipArchive) {
+		auto zipPath = testRoot / "archive.jar";
+		std::string stored(1000, 'S');
+		std::string deflated;
+		for (int i = 0; i < 5000; i++) deflated += "hello world ";
+
+		mz_zip_archive zip_archive;
+		memset(&zip_archive, 0, sizeof(zip_archive));
+		Assert::IsTrue(mz_zip_writer_init_file(&zip_archive, zipPath.string().c_str(), 0));
+		mz_zip_writer_add_mem(&zip_archive, "stored.dll", stored.data(), stored.size(), MZ_NO_COMPRESSION);
+		mz_zip_writer_add_mem(&zip_archive, "lib/deflated.dll", deflated.data(), deflated.size(), MZ_DEFAULT_COMPRESSION);
+		mz_zip_writer_add_mem(&zip_archive, "empty.txt", "", 0, MZ_DEFAULT_COMPRESSION);
+		mz_zip_writer_finalize_archive(&zip_archive);
+		mz_zip_writer_end(&zip_archive);
+
+		ZipArchive::Cache().Clear();
+		ZipArchive archive;
+		Assert::IsTrue(archive.Open(zipPath));
+		Assert::AreEqual((size_t) 3, archive.GetEntryCount());
+		Assert::IsNull(archive.Find("missing.dll"));
+
+		// 存储条目直接指向映射区域，不使用缓冲区
+		std::vector<std::byte> buffer;
+		const ZipEntry *storedEntry = archive.Find("stored.dll");
+		Assert::IsNotNull(storedEntry);
+		Assert::IsTrue(storedEntry->Method == ZipEntry::MethodStored);
+		auto storedData = archive.Read(*storedEntry, buffer);
+		Assert::IsTrue(storedData.has_value());
+		Assert::AreEqual(stored, std::string(reinterpret_cast<const char *>(storedData->data()), storedData->size()));
+		Assert::IsTrue(buffer.empty());
+
+		// Deflate 条目解压到缓冲区
+		const ZipEntry *deflatedEntry = archive.Find("lib/deflated.dll");
+		Assert::IsNotNull(deflatedEntry);
+		Assert::IsTrue(deflatedEntry->Method == ZipEntry::MethodDeflated);
+		auto deflatedData = archive.Read(*deflatedEntry, buffer);
+		Assert::IsTrue(deflatedData.has_value());
+		Assert::AreEqual(deflated, std::string(reinterpret_cast<const char *>(deflatedData->data()), deflatedData->size()));
+		Assert::AreEqual((size_t) 0, archive.Read(*archive.Find("empty.txt"), buffer)->size());
+
+		// 再次打开未变化的压缩包直接复用条目表
+		ZipArchive reopened;
+		Assert::IsTrue(reopened.Open(zipPath));
+		Assert::AreEqual((uint64_t) 1, ZipArchive::Cache().Hits());
+		Assert::IsTrue(reopened.GetName(reopened.GetEntries()[1]) == "lib/deflated.dll");
+		archive.Close();
+		reopened.Close();
+
+		// 压缩包被替换后重新解析
+		CreateJar(zipPath, { { "replaced.dll", "new" } });
+		Assert::IsTrue(reopened.Open(zipPath));
+		Assert::AreEqual((uint64_t) 1, ZipArchive::Cache().Hits());
+		Assert::IsNotNull(reopened.Find("replaced.dll"));
+		reopened.Close();
+
+		// 非 Zip 文件无法打开
+		std::ofstream(testRoot / "broken.jar", std::ios::binary) << "not a zip file";
+		Assert::IsFalse(archive.Open(testRoot / "broken.jar"));
+	}
+
+	/**
+	 * @brief 测试异步清理：目录立即移走，旧文件与遗留墓碑在后台删除
+	 */
+	TEST_METHOD(TestCleanAsync) {
+		auto nativesDir = testRoot / "clean_natives";
+		std::filesystem::create_directories(nativesDir);
+		std::ofstream(nativesDir / "old.dll") << "old";
+
+		// 上次运行遗留的墓碑，以及名称相近但不属于该目录的目录
+		auto leftover = testRoot / "clean_natives.trash-999-0";
+		std::filesystem::create_directories(leftover);
+		std::ofstream(leftover / "stale.dll") << "stale";
+		std::filesystem::create_directories(testRoot / "clean_natives-other");
+
+		Assert::IsTrue(NativesUtils::CleanAsync(nativesDir));
+		Assert::IsFalse(std::filesystem::exists(nativesDir));
+		Assert::IsTrue(BackgroundDeleter::Global().WaitIdle(std::chrono::seconds(10)));
+
+		for (const auto &entry : std::filesystem::directory_iterator(testRoot)) {
+			Assert::IsTrue(entry.path().filename().string().find(".trash-") == std::string::npos, L"Tombstone should be deleted");
+		}
+		Assert::IsTrue(std::filesystem::exists(testRoot / "clean_natives-other"));
+
+		// 目录不存在时无需清理
+		Assert::IsTrue(NativesUtils::CleanAsync(nativesDir));
+
+		// 显式回收；仍在运行的进程（此处为当前进程）的墓碑不做处理
+		std::filesystem::create_directories(testRoot / "clean_natives.trash-999-1");
+		auto live = testRoot / std::format("clean_natives.trash-{}-0", GetCurrentProcessId());
+		std::filesystem::create_directories(live);
+		Assert::IsTrue(ProcessRunner::IsRunning(GetCurrentProcessId()));
+		Assert::AreEqual((size_t) 1, NativesUtils::SweepTombstones(nativesDir));
+		Assert::IsTrue(BackgroundDeleter::Global().WaitIdle(std::chrono::seconds(10)));
+		Assert::IsFalse(std::filesystem::exists(testRoot / "clean_natives.trash-999-1"));
+		Assert::IsTrue(std::filesystem::exists(live));
+	}
+
+	/**
+	 * @brief 测试后台删除器：队列清空后线程退出，再次入队时重新启动；`Shutdown` 后不再删除
+	 */
+	TEST_METHOD(TestBackgroundDeleter) {
+		BackgroundDeleter deleter;
+		for (int round = 0; round < 2; round++) {
+			auto dir = testRoot / std::format("delete_{}", round);
+			std::filesystem::create_directories(dir / "sub");
+			std::ofstream(dir / "sub" / "file.dll") << "data";
+			deleter.Enqueue(dir);
+			Assert::IsTrue(deleter.WaitIdle(std::chrono::seconds(10)));
+			Assert::IsFalse(std::filesystem::exists(dir));
+		}
+		Assert::AreEqual((uint64_t) 2, deleter.Deleted());
+
+		deleter.Shutdown();
+		auto kept = testRoot / "kept";
+		std::filesystem::create_directories(kept);
+		deleter.Enqueue(kept);
+		Assert::IsTrue(deleter.WaitIdle(std::chrono::seconds(1)));
+		Assert::IsTrue(std::filesystem::exists(kept));
+	}
 	};
 }
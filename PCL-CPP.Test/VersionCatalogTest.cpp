@@ -0,0 +1,113 @@
+#include "pch.h"
+#include "Launcher/Version/VersionCatalog.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace PCL_CPP::Core::Launcher::Version;
+
+namespace PCLCPPTest {
+	TEST_CLASS(VersionCatalogTest) {
+	public:
+	std::filesystem::path testRoot = "TestCatalog";
+
+	TEST_METHOD_INITIALIZE(Setup) {
+		if (std::filesystem::exists(testRoot)) std::filesystem::remove_all(testRoot);
+		std::filesystem::create_directories(testRoot);
+	}
+
+	TEST_METHOD_CLEANUP(Cleanup) {
+		std::error_code ec;
+		std::filesystem::remove_all(testRoot, ec);
+	}
+
+	void WriteVersion(const std::string &id, const std::string &mainClass, const std::string &inheritsFrom = "") {
+		nlohmann::json j = {
+			{"id", id},
+			{"mainClass", mainClass},
+			{"libraries", { {{"name", "lib." + id}} }}
+		};
+		if (!inheritsFrom.empty()) j["inheritsFrom"] = inheritsFrom;
+
+		std::filesystem::create_directories(testRoot / id);
+		std::ofstream(testRoot / id / (id + ".json")) << j.dump();
+	}
+
+	static const VersionChangeEvent *FindEvent(const std::vector<VersionChangeEvent> &events, const std::string &id) {
+		auto it = std::find_if(events.begin(), events.end(), [&](const VersionChangeEvent &e) { return e.Id == id; });
+		return it != events.end() ? &*it : nullptr;
+	}
+
+	TEST_METHOD(TestIncrementalRefresh) {
+		WriteVersion("Base", "BaseMain");
+		WriteVersion("LoaderA", "", "Base");
+		WriteVersion("LoaderB", "", "Base");
+		WriteVersion("Other", "OtherMain");
+
+		VersionCatalog catalog(testRoot);
+		auto events = catalog.Refresh();
+		Assert::AreEqual((size_t) 4, events.size());
+		for (const auto &e : events) Assert::IsTrue(e.Type == VersionChangeType::Added);
+		Assert::AreEqual(std::string("BaseMain"), catalog.Find("LoaderA")->MainClass);
+
+		auto other = catalog.Find("Other");
+
+		// 修改父版本：自身与所有子孙版本被更新，无关版本保持原实例
+		WriteVersion("Base", "BaseMainChanged");
+		events = catalog.Refresh();
+		Assert::AreEqual((size_t) 3, events.size());
+		Assert::IsTrue(FindEvent(events, "Base")->Type == VersionChangeType::Updated);
+		Assert::IsTrue(FindEvent(events, "LoaderA")->Type == VersionChangeType::Updated);
+		Assert::IsTrue(FindEvent(events, "LoaderB")->Type == VersionChangeType::Updated);
+		Assert::IsNull(FindEvent(events, "Other"));
+		Assert::IsTrue(other == catalog.Find("Other"), L"Unaffected versions should keep their instance");
+		Assert::AreEqual(std::string("BaseMainChanged"), catalog.Find("LoaderB")->MainClass);
+		Assert::IsTrue(catalog.Find("LoaderA")->Parent == catalog.Find("Base"));
+
+		// 内容未变化时不产生事件
+		Assert::IsTrue(catalog.Refresh().empty());
+
+		// 删除与新增
+		std::filesystem::remove_all(testRoot / "LoaderB");
+		WriteVersion("LoaderC", "", "Base");
+		events = catalog.Refresh({ "LoaderB", "LoaderC" });
+		Assert::AreEqual((size_t) 2, events.size());
+		Assert::IsTrue(FindEvent(events, "LoaderB")->Type == VersionChangeType::Removed);
+		Assert::IsTrue(FindEvent(events, "LoaderC")->Type == VersionChangeType::Added);
+		Assert::AreEqual((size_t) 4, catalog.GetVersions().size());
+		Assert::IsNull(catalog.Find("LoaderB").get());
+	}
+
+	TEST_METHOD(TestBackgroundWatch) {
+		WriteVersion("Base", "BaseMain");
+
+		VersionCatalog catalog(testRoot);
+		catalog.Refresh();
+
+		std::mutex mutex;
+		std::vector<VersionChangeEvent> received;
+		catalog.Subscribe([&](const std::vector<VersionChangeEvent> &events) {
+			std::lock_guard lock(mutex);
+			received.insert(received.end(), events.begin(), events.end());
+		});
+
+		Assert::IsTrue(catalog.Start(false, std::chrono::milliseconds(100)));
+		Assert::IsTrue(catalog.IsRunning());
+
+		WriteVersion("Installed", "", "Base");
+
+		bool found = false;
+		for (int i = 0; i < 100 && !found; i++) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+			std::lock_guard lock(mutex);
+			found = FindEvent(received, "Installed") != nullptr;
+		}
+
+		catalog.Stop();
+		Assert::IsFalse(catalog.IsRunning());
+		Assert::IsTrue(found, L"Watcher should report the newly installed version");
+		Assert::AreEqual(std::string("BaseMain"), catalog.Find("Installed")->MainClass);
+	}
+	};
+}
@@ -1,12 +1,25 @@
 #include "pch.h"
 #include "App/Logging/AppLogger.h"
+#include "Launcher/Version/ArgumentTemplate.h"
 #include "Launcher/Version/Arguments.h"
+#include "Launcher/Version/InternedLibrary.h"
 #include "Launcher/Version/Library.h"
+#include "Launcher/Version/LibraryResolver.h"
+#include "Launcher/Version/MavenCoordinate.h"
+#include "Launcher/Version/RuleEngine.h"
+#include "Launcher/Version/VersionCache.h"
+#include "Launcher/Version/VersionIndex.h"
+#include "Launcher/Version/VersionJsonView.h"
+#include "Launcher/Version/MultiRootCatalog.h"
 #include "Launcher/Version/VersionLocator.h"
+#include "Utils/Hashing/HashUtils.h"
+#include "Utils/Json/JsonLoader.h"
+#include "Utils/Text/StringPool.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace PCL_CPP::Core::Launcher::Version;
 using namespace PCL_CPP::Core::Logging;
+using namespace PCL_CPP::Core::Utils;
 
 namespace PCLCPPTest {
 	TEST_CLASS(VersionTest) {
@@ -43,6 +56,123 @@ namespace PCLCPPTest {
 		Assert::IsTrue(foundOptiFine, L"OptiFine version not found");
 	}
 
+	TEST_METHOD(TestParallelDiscovery) {
+		auto serial = VersionLocator::GetAllVersions(testRoot, 1);
+		auto parallel = VersionLocator::GetAllVersions(testRoot, 4);
+
+		Assert::AreEqual(serial.size(), parallel.size(), L"Parallel scan should find the same versions");
+		for (size_t i = 0; i < serial.size(); i++) {
+			Assert::AreEqual(serial[i].Id, parallel[i].Id, L"Parallel scan order should be deterministic");
+			Assert::AreEqual(serial[i].MainClass, parallel[i].MainClass);
+			Assert::IsTrue(serial[i].RawData == parallel[i].RawData, L"Parallel scan should produce identical data");
+		}
+	}
+
+	TEST_METHOD(TestVersionIndex) {
+		std::filesystem::path indexRoot = testRoot / "IndexTest";
+		std::filesystem::create_directories(indexRoot / "A");
+		std::filesystem::create_directories(indexRoot / "B");
+		std::ofstream(indexRoot / "A/A.json") << nlohmann::json({{"id", "A"}, {"mainClass", "MainA"}, {"assets", "1.18"}}).dump();
+		std::ofstream(indexRoot / "B/B.json") << nlohmann::json({{"id", "B"}, {"inheritsFrom", "A"}}).dump();
+
+		// 首次列出：建立索引
+		auto first = VersionLocator::ListVersions(indexRoot);
+		Assert::AreEqual((size_t) 2, first.size());
+		Assert::IsTrue(std::filesystem::exists(indexRoot / VersionIndex::FileName), L"Index file should be created");
+		Assert::IsTrue(first[1].IsHeaderOnly && first[1].RawData.is_null(), L"Listing should only carry header fields");
+		Assert::AreEqual(std::string("MainA"), first[1].MainClass, L"Header fields should be inherited");
+		Assert::AreEqual(std::string("1.18"), first[1].AssetsIndex);
+
+		VersionIndex index(indexRoot);
+		Assert::IsTrue(index.Load());
+		Assert::AreEqual((size_t) 2, index.Size());
+
+		// 修改 B（大小变化）后应只重建 B 的条目
+		std::ofstream(indexRoot / "B/B.json") << nlohmann::json({{"id", "B"}, {"inheritsFrom", "A"}, {"mainClass", "MainB"}}).dump();
+		auto second = VersionLocator::ListVersions(indexRoot);
+		Assert::AreEqual(std::string("MainB"), second[1].MainClass, L"Changed JSON should be re-parsed");
+
+		// 删除 A 后其条目应被移除
+		std::filesystem::remove_all(indexRoot / "A");
+		auto third = VersionLocator::ListVersions(indexRoot);
+		Assert::AreEqual((size_t) 1, third.size());
+		Assert::IsTrue(index.Load());
+		Assert::AreEqual((size_t) 1, index.Size(), L"Removed versions should be dropped from index");
+
+		// 损坏的索引文件应被忽略并重建
+		std::ofstream(indexRoot / VersionIndex::FileName, std::ios::binary | std::ios::trunc) << "garbage";
+		auto fourth = VersionLocator::ListVersions(indexRoot);
+		Assert::AreEqual((size_t) 1, fourth.size());
+		Assert::IsTrue(index.Load(), L"Corrupted index should be rebuilt");
+	}
+
+	TEST_METHOD(TestLazyMaterialize) {
+		auto listed = VersionLocator::ListVersions(testRoot);
+		Assert::AreEqual((size_t) 2, listed.size());
+
+		for (auto &info : listed) {
+			auto full = VersionLocator::GetVersion(testRoot, info.Id);
+			Assert::IsTrue(full.has_value());
+
+			// SAX 提取的头部字段应与完整解析一致
+			Assert::IsTrue(info.IsHeaderOnly);
+			Assert::AreEqual(full->Type, info.Type);
+			Assert::AreEqual(full->MainClass, info.MainClass);
+			Assert::AreEqual(full->AssetsIndex, info.AssetsIndex);
+			Assert::AreEqual(full->Jar, info.Jar);
+			Assert::AreEqual(full->ContentHash, info.ContentHash);
+
+			Assert::IsTrue(VersionLocator::Materialize(info));
+			Assert::IsFalse(info.IsHeaderOnly);
+			Assert::IsTrue(info.RawData == full->RawData, L"Materialized data should match GetVersion");
+		}
+	}
+
+	TEST_METHOD(TestVersionHeaderEarlyStop) {
+		std::filesystem::path headerRoot = testRoot / "HeaderTest";
+		std::filesystem::create_directories(headerRoot / "loader");
+		std::filesystem::create_directories(headerRoot / "vanilla");
+
+		// 继承版本在进入 libraries 时即结束解析，其后的内容（此处故意写成非法 JSON）不会被读取
+		std::ofstream(headerRoot / "loader/loader.json") << R"({"id": "loader", "inheritsFrom": "1.18.2", "type": "release", "mainClass": "Main", "libraries": [ not json)";
+		// 原版 JSON 中位于 libraries 之后的字段仍会被读取
+		std::ofstream(headerRoot / "vanilla/vanilla.json") << R"({"assets": "1.18", "id": "vanilla", "libraries": [{"name": "a:b:1"}], "mainClass": "Main", "type": "snapshot"})";
+
+		auto listed = VersionLocator::ListVersions(headerRoot);
+		Assert::AreEqual((size_t) 2, listed.size());
+
+		Assert::AreEqual(std::string("loader"), listed[0].Id);
+		Assert::AreEqual(std::string("1.18.2"), listed[0].InheritsFrom);
+		Assert::AreEqual(std::string("Main"), listed[0].MainClass);
+
+		Assert::AreEqual(std::string("vanilla"), listed[1].Id);
+		Assert::AreEqual(std::string("Main"), listed[1].MainClass);
+		Assert::AreEqual(std::string("snapshot"), listed[1].Type);
+		Assert::AreEqual(std::string("1.18"), listed[1].AssetsIndex);
+	}
+
+	TEST_METHOD(TestJsonLoader) {
+		std::filesystem::path assetsDir = TEST_ASSETS_DIR;
+		for (const char *name : {"1.18.2.json", "1.18.2-OptiFine.json"}) {
+			uint64_t hash = 0;
+			auto mapped = JsonLoader::ParseFile(assetsDir / name, &hash);
+			auto streamed = JsonLoader::ParseStream(assetsDir / name);
+			Assert::IsTrue(mapped == streamed, L"Mapped parsing should match stream parsing");
+
+			std::ifstream file(assetsDir / name, std::ios::binary);
+			std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+			Assert::AreEqual(HashUtils::Fnv1a64(content), hash, L"Content hash should cover the whole file");
+		}
+
+		// 空文件与非法内容应抛出异常，由调用方按原有方式处理
+		std::ofstream(testRoot / "empty.json").close();
+		std::ofstream(testRoot / "broken.json") << "{\"id\": ";
+		bool threwEmpty = false, threwBroken = false;
+		try { JsonLoader::ParseFile(testRoot / "empty.json"); } catch (const std::exception &) { threwEmpty = true; }
+		try { JsonLoader::ParseFile(testRoot / "broken.json"); } catch (const std::exception &) { threwBroken = true; }
+		Assert::IsTrue(threwEmpty && threwBroken);
+	}
+
 	TEST_METHOD(TestRealVersionParsing) {
 		// Test 1.18.2-OptiFine parsing
 		auto optifine = VersionLocator::GetVersion(testRoot, "1.18.2-OptiFine");
@@ -90,6 +220,219 @@ namespace PCLCPPTest {
 		Assert::AreEqual((size_t) 2, v->RawData["libraries"].size(), L"Should merge libraries");
 	}
 
+	TEST_METHOD(TestSharedParents) {
+		std::filesystem::path sharedRoot = testRoot / "SharedParentTest";
+		std::filesystem::create_directories(sharedRoot / "Base");
+		nlohmann::json base = {
+			{"id", "Base"},
+			{"mainClass", "BaseMain"},
+			{"libraries", { {{"name", "libBase"}} }}
+		};
+		std::ofstream(sharedRoot / "Base/Base.json") << base.dump();
+
+		for (int i = 0; i < 3; ++i) {
+			std::string id = "Loader" + std::to_string(i);
+			std::filesystem::create_directories(sharedRoot / id);
+			nlohmann::json child = {
+				{"id", id},
+				{"inheritsFrom", "Base"},
+				{"libraries", { {{"name", "lib" + id}} }}
+			};
+			std::ofstream(sharedRoot / id / (id + ".json")) << child.dump();
+		}
+
+		auto versions = VersionLocator::GetAllSharedVersions(sharedRoot);
+		Assert::AreEqual((size_t) 4, versions.size());
+
+		std::shared_ptr<const VersionInfo> sharedParent;
+		for (const auto &shared : versions) {
+			if (shared->Id == "Base") {
+				Assert::IsTrue(shared->Parent == nullptr, L"Root version should not have a parent");
+				continue;
+			}
+			Assert::IsTrue(shared->IsResolved);
+			Assert::IsTrue(shared->Parent != nullptr, L"Child should reference its parent");
+			if (!sharedParent) sharedParent = shared->Parent;
+			Assert::IsTrue(sharedParent.get() == shared->Parent.get(), L"Children should share one parent instance");
+			Assert::AreEqual(std::string("BaseMain"), shared->MainClass);
+			Assert::AreEqual((size_t) 1, shared->RawData["libraries"].size(), L"Child should only hold its own data");
+
+			VersionInfo v = *shared;
+			VersionLocator::Flatten(v);
+			Assert::IsTrue(v.Parent == nullptr);
+			Assert::AreEqual((size_t) 2, v.RawData["libraries"].size(), L"Flatten should merge libraries");
+		}
+		Assert::AreEqual((size_t) 1, sharedParent->RawData["libraries"].size(), L"Flatten must not modify the shared parent");
+
+		// GetAllVersions 返回平铺后的数据，可以直接读取继承的字段
+		for (const auto &v : VersionLocator::GetAllVersions(sharedRoot)) {
+			Assert::IsTrue(v.Parent == nullptr);
+			if (v.Id == "Base") continue;
+			const auto &libraries = v.RawData["libraries"];
+			Assert::AreEqual((size_t) 2, libraries.size(), L"Inherited libraries should be merged into RawData");
+			bool hasBase = std::any_of(libraries.begin(), libraries.end(), [](const nlohmann::json &lib) { return lib["name"] == "libBase"; });
+			Assert::IsTrue(hasBase);
+		}
+	}
+
+	TEST_METHOD(TestVersionCache) {
+		std::filesystem::path cacheRoot = testRoot / "CacheTest";
+		auto write = [&](const std::string &id, const nlohmann::json &j) {
+			std::filesystem::create_directories(cacheRoot / id);
+			std::ofstream(cacheRoot / id / (id + ".json")) << j.dump();
+		};
+		write("Base", {{"id", "Base"}, {"mainClass", "BaseMain"}});
+		write("Child", {{"id", "Child"}, {"inheritsFrom", "Base"}});
+		write("Other", {{"id", "Other"}, {"mainClass", "OtherMain"}});
+		write("Orphan", {{"id", "Orphan"}, {"inheritsFrom", "Missing"}});
+
+		auto &cache = VersionLocator::Cache();
+		cache.Clear();
+
+		Assert::AreEqual(std::string("BaseMain"), VersionLocator::GetVersion(cacheRoot, "Child")->MainClass);
+		Assert::AreEqual(std::string("BaseMain"), VersionLocator::GetVersion(cacheRoot, "Child")->MainClass);
+		VersionLocator::GetVersion(cacheRoot, "Other");
+		Assert::AreEqual((uint64_t) 1, cache.Hits());
+
+		// 修改父版本只会使其子版本失效
+		write("Base", {{"id", "Base"}, {"mainClass", "BaseMainChanged"}});
+		Assert::AreEqual(std::string("BaseMainChanged"), VersionLocator::GetVersion(cacheRoot, "Child")->MainClass);
+		VersionLocator::GetVersion(cacheRoot, "Other");
+		Assert::AreEqual((uint64_t) 2, cache.Hits(), L"Unrelated versions should stay cached");
+
+		// 缺失的父版本出现后，继承链断裂的条目同样失效
+		Assert::IsTrue(VersionLocator::GetVersion(cacheRoot, "Orphan")->MainClass.empty());
+		write("Missing", {{"id", "Missing"}, {"mainClass", "FoundMain"}});
+		Assert::AreEqual(std::string("FoundMain"), VersionLocator::GetVersion(cacheRoot, "Orphan")->MainClass);
+
+		// 共享访问器命中时返回缓存中的同一实例，不复制
+		auto shared = VersionLocator::GetSharedVersion(cacheRoot, "Child");
+		Assert::IsNotNull(shared.get());
+		Assert::IsTrue(shared == VersionLocator::GetSharedVersion(cacheRoot, "Child"));
+		Assert::AreEqual(shared->MainClass, VersionLocator::GetVersion(cacheRoot, "Child")->MainClass);
+		Assert::IsNull(VersionLocator::GetSharedVersion(cacheRoot, "Nonexistent").get());
+
+		// 显式失效与容量淘汰
+		Assert::AreEqual((size_t) 1, cache.Invalidate(cacheRoot / "Base" / "Base.json"));
+		cache.SetCapacity(1);
+		Assert::AreEqual((size_t) 1, cache.Size());
+		cache.SetCapacity(VersionCache::DefaultCapacity);
+		cache.Clear();
+	}
+
+	TEST_METHOD(TestMultiRootCatalog) {
+		std::filesystem::path multiRoot = testRoot / "MultiRoot";
+		nlohmann::json vanilla = {{"id", "1.20"}, {"mainClass", "VanillaMain"}, {"libraries", { {{"name", "lib.vanilla"}} }}};
+		nlohmann::json loader = {{"id", "1.20-loader"}, {"inheritsFrom", "1.20"}, {"libraries", { {{"name", "lib.loader"}} }}};
+		auto write = [&](const std::filesystem::path &root, const nlohmann::json &j) {
+			std::string id = j["id"];
+			std::filesystem::create_directories(root / id);
+			std::ofstream(root / id / (id + ".json")) << j.dump();
+		};
+
+		// 三个团队目录包含相同的原版与加载器，第三个目录额外带有一个独立版本
+		std::vector<std::filesystem::path> roots = { multiRoot / "A", multiRoot / "B", multiRoot / "C" };
+		for (const auto &root : roots) {
+			write(root, vanilla);
+			write(root, loader);
+		}
+		write(roots[2], {{"id", "custom"}, {"mainClass", "CustomMain"}});
+
+		MultiRootCatalog catalog(roots);
+		catalog.Scan(2);
+
+		const auto &stats = catalog.GetStats();
+		Assert::AreEqual((size_t) 7, stats.VersionFiles);
+		Assert::AreEqual((size_t) 3, stats.UniqueContents, L"Identical JSONs should be parsed once");
+		Assert::AreEqual((size_t) 3, stats.UniqueVersions);
+		Assert::AreEqual((size_t) 7, catalog.GetVersions().size());
+		Assert::AreEqual((size_t) 3, catalog.GetVersions(2).size());
+
+		const RootedVersion *a = catalog.Find(0, "1.20-loader");
+		const RootedVersion *b = catalog.Find(1, "1.20-loader");
+		Assert::IsTrue(a != nullptr && b != nullptr);
+		Assert::IsTrue(a->Shared == b->Shared, L"Identical chains should share one instance");
+		Assert::IsTrue(a->JsonPath != b->JsonPath, L"Root-qualified entries keep their own paths");
+		Assert::IsTrue(a->Version->RootPath == roots[0] / "1.20-loader", L"Per-root instances keep their own RootPath");
+		Assert::IsTrue(b->Version->RootPath == roots[1] / "1.20-loader");
+		Assert::IsTrue(a->Version->Parent == a->Shared);
+		Assert::AreEqual(std::string("VanillaMain"), a->Version->MainClass);
+		Assert::AreEqual((size_t) 2, VersionJsonView(*b->Version).Libraries().Size());
+		Assert::IsNull(catalog.Find(0, "custom"));
+
+		// 某个根目录中的父版本不同时，子版本不再共享
+		write(roots[1], {{"id", "1.20"}, {"mainClass", "PatchedMain"}});
+		catalog.Scan();
+		Assert::AreEqual((size_t) 1, catalog.GetStats().HashedFiles, L"Unchanged files should be hashed from the index");
+		Assert::AreEqual((size_t) 1, catalog.GetStats().ParsedFiles, L"Previously parsed contents should be reused");
+		Assert::IsTrue(catalog.Find(0, "1.20-loader")->Shared != catalog.Find(1, "1.20-loader")->Shared);
+		Assert::IsTrue(catalog.Find(0, "1.20-loader")->Shared == catalog.Find(2, "1.20-loader")->Shared);
+		Assert::AreEqual(std::string("PatchedMain"), catalog.Find(1, "1.20-loader")->Version->MainClass);
+
+		// 索引中的哈希与另一根目录的内容相同（模拟 FNV-1a 碰撞）时，逐字节比对后仍视为不同内容
+		VersionIndex forged(roots[1]);
+		Assert::IsTrue(forged.Load());
+		VersionIndexEntry entry;
+		entry.Stamp = *FileStamp::Read(roots[1] / "1.20/1.20.json");
+		entry.ContentHash = catalog.Find(0, "1.20")->Shared->ContentHash;
+		entry.Id = "1.20";
+		entry.MainClass = "PatchedMain";
+		forged.Update("1.20", std::move(entry));
+		Assert::IsTrue(forged.Save());
+
+		catalog.Scan();
+		Assert::AreEqual((size_t) 1, catalog.GetStats().ParsedFiles);
+		Assert::IsTrue(catalog.Find(0, "1.20")->Shared != catalog.Find(1, "1.20")->Shared);
+		Assert::AreEqual(std::string("VanillaMain"), catalog.Find(0, "1.20")->Version->MainClass);
+		Assert::AreEqual(std::string("PatchedMain"), catalog.Find(1, "1.20")->Version->MainClass);
+	}
+
+	TEST_METHOD(TestOverlayMergeSemantics) {
+		nlohmann::json root = {
+			{"id", "root"},
+			{"mainClass", "RootMain"},
+			{"libraries", { {{"name", "a"}} }},
+			{"arguments", { {"game", {"--a"}}, {"jvm", "-Dnot-an-array"}, {"extra", 1} }}
+		};
+		nlohmann::json middle = {
+			{"id", "middle"},
+			{"libraries", { {{"name", "b"}} }},
+			{"arguments", { {"game", {"--b"}}, {"jvm", {"-Db"}}, {"ignored", true} }},
+			{"minecraftArguments", "--legacy"}
+		};
+		nlohmann::json leaf = {
+			{"id", "leaf"},
+			{"libraries", { {{"name", "c"}}, {{"name", "d"}} }},
+			{"arguments", { {"game", {"--c"}} }}
+		};
+
+		VersionJsonView view({ &root, &middle, &leaf });
+		Assert::AreEqual((size_t) 4, view.Libraries().Size());
+		Assert::AreEqual((size_t) 3, view.Libraries().Segments().size(), L"Libraries should reference each layer instead of copying");
+		Assert::AreEqual((size_t) 3, view.GameArguments().Size());
+		Assert::AreEqual((size_t) 1, view.JvmArguments().Size(), L"Non-array jvm should be replaced, not appended");
+		Assert::AreEqual(std::string("leaf"), view.Find("id")->get<std::string>());
+		Assert::AreEqual(std::string("--legacy"), view.Find("minecraftArguments")->get<std::string>());
+
+		nlohmann::json expected = {
+			{"id", "leaf"},
+			{"mainClass", "RootMain"},
+			{"minecraftArguments", "--legacy"},
+			{"libraries", { {{"name", "a"}}, {{"name", "b"}}, {{"name", "c"}}, {{"name", "d"}} }},
+			{"arguments", { {"game", {"--a", "--b", "--c"}}, {"jvm", {"-Db"}}, {"extra", 1} }}
+		};
+		Assert::IsTrue(view.Flatten() == expected, L"Flattened overlay should match the sequential merge result");
+
+		// 子版本用非对象值覆盖 arguments 时整体替换
+		nlohmann::json overrideArgs = { {"arguments", "none"}, {"libraries", "none"} };
+		VersionJsonView replaced({ &root, &overrideArgs });
+		Assert::IsFalse(replaced.HasArgumentsObject());
+		Assert::IsFalse(replaced.GameArguments().Exists());
+		Assert::IsFalse(replaced.Libraries().IsArray());
+		Assert::IsTrue(replaced.Flatten()["arguments"] == "none");
+		Assert::IsTrue(replaced.Flatten()["libraries"] == "none");
+	}
+
 	TEST_METHOD(TestLibraryFiltering) {
 		auto optifine = VersionLocator::GetVersion(testRoot, "1.18.2-OptiFine");
 		Assert::IsTrue(optifine.has_value());
@@ -120,6 +463,243 @@ namespace PCLCPPTest {
 		Assert::IsTrue(foundWindowsNative, L"Should find windows natives");
 	}
 
+	TEST_METHOD(TestLibraryResolver) {
+		Assert::IsTrue(LibraryResolver::CompareVersions("31.0.1-jre", "30.1-jre") > 0);
+		Assert::IsTrue(LibraryResolver::CompareVersions("9.10", "9.9") > 0);
+		Assert::IsTrue(LibraryResolver::CompareVersions("1.0.1", "1.0") > 0);
+		Assert::IsTrue(LibraryResolver::CompareVersions("1.0-beta", "1.0") < 0);
+		Assert::IsTrue(LibraryResolver::CompareVersions("1.8.0-beta4", "1.8.0-beta2") > 0);
+		Assert::AreEqual(0, LibraryResolver::CompareVersions("2.17.0", "2.17.0"));
+
+		Assert::AreEqual(std::string("com.google.guava:guava"), LibraryResolver::GetKey("com.google.guava:guava:31.0.1-jre"));
+		Assert::AreEqual(std::string("org.lwjgl:lwjgl:natives-windows"), LibraryResolver::GetKey("org.lwjgl:lwjgl:3.2.2:natives-windows"));
+		Assert::AreEqual(std::string("net.minecraftforge:forge:universal@zip"), LibraryResolver::GetKey("net.minecraftforge:forge:40.1.0:universal@zip"));
+		Assert::AreEqual(std::string("invalid"), LibraryResolver::GetKey("invalid"));
+
+		// 父版本在前、子版本在后，与继承链合并后的顺序一致
+		std::vector<Library> libs;
+		for (const char *name : { "com.google.guava:guava:31.0.1-jre", "org.ow2.asm:asm:9.1", "org.lwjgl:lwjgl:3.2.2:natives-windows",
+								  "com.google.guava:guava:30.0-jre", "org.ow2.asm:asm:9.3", "org.lwjgl:lwjgl:3.2.2", "org.example:mod:1.0" }) {
+			libs.push_back(Library::Parse({ {"name", name} }));
+		}
+		auto namesOf = [](const LibraryResolver &resolver) {
+			std::vector<std::string> names;
+			for (const auto *lib : resolver.GetLibraries()) names.push_back(lib->Name);
+			return names;
+		};
+
+		LibraryResolver childWins(LibraryConflictPolicy::ChildWins);
+		for (const auto &lib : libs) childWins.Add(lib);
+		Assert::IsTrue(namesOf(childWins) == std::vector<std::string> {
+			"com.google.guava:guava:30.0-jre", "org.ow2.asm:asm:9.3", "org.lwjgl:lwjgl:3.2.2:natives-windows", "org.lwjgl:lwjgl:3.2.2", "org.example:mod:1.0" });
+		Assert::AreEqual((size_t) 2, childWins.GetDropped().size());
+		Assert::AreEqual(std::string("com.google.guava:guava:31.0.1-jre"), childWins.GetDropped()[0].Name);
+		Assert::AreEqual(std::string("com.google.guava:guava:30.0-jre"), childWins.GetDropped()[0].KeptName);
+
+		LibraryResolver highest(LibraryConflictPolicy::HighestVersion);
+		for (const auto &lib : libs) highest.Add(lib);
+		Assert::IsTrue(namesOf(highest) == std::vector<std::string> {
+			"com.google.guava:guava:31.0.1-jre", "org.ow2.asm:asm:9.3", "org.lwjgl:lwjgl:3.2.2:natives-windows", "org.lwjgl:lwjgl:3.2.2", "org.example:mod:1.0" });
+		Assert::AreEqual(std::string("com.google.guava:guava:30.0-jre"), highest.GetDropped()[0].Name);
+
+		LibraryResolver keepAll(LibraryConflictPolicy::KeepAll);
+		for (const auto &lib : libs) keepAll.Add(lib);
+		Assert::AreEqual(libs.size(), keepAll.GetLibraries().size());
+		Assert::IsTrue(keepAll.GetDropped().empty());
+	}
+
+	TEST_METHOD(TestMavenCoordinate) {
+		auto guava = MavenCoordinate::Parse("com.google.guava:guava:31.0.1-jre");
+		Assert::IsTrue(guava.has_value());
+		Assert::IsTrue(guava->Group == "com.google.guava" && guava->Artifact == "guava" && guava->Version == "31.0.1-jre");
+		Assert::IsTrue(guava->Classifier.empty() && guava->Extension == "jar");
+		Assert::AreEqual(std::string("com/google/guava/guava/31.0.1-jre/guava-31.0.1-jre.jar"), guava->GetPath());
+		Assert::AreEqual(guava->GetPath().size(), guava->GetPathLength());
+
+		auto forge = MavenCoordinate::Parse("net.minecraftforge:forge:40.1.0:universal@zip");
+		Assert::IsTrue(forge.has_value());
+		Assert::IsTrue(forge->Classifier == "universal" && forge->Extension == "zip");
+		Assert::AreEqual(std::string("net/minecraftforge/forge/40.1.0/forge-40.1.0-universal.zip"), forge->GetPath());
+		Assert::AreEqual(forge->GetPath().size(), forge->GetPathLength());
+
+		Assert::IsFalse(MavenCoordinate::Parse("invalid").has_value());
+		Assert::IsFalse(MavenCoordinate::Parse("a:b").has_value());
+		Assert::IsFalse(MavenCoordinate::Parse("a::1.0").has_value());
+		Assert::IsFalse(MavenCoordinate::Parse("a:b:1.0:c:d").has_value());
+		Assert::IsFalse(MavenCoordinate::Parse("a:b:1.0@").has_value());
+
+		// 批量解析：路径连续存放，无效坐标对应空路径
+		std::vector<std::string_view> names = { "com.google.guava:guava:31.0.1-jre", "invalid", "org.lwjgl:lwjgl:3.2.2:natives-windows" };
+		auto arena = LibraryPathArena::Resolve("libraries", names);
+		Assert::AreEqual(names.size(), arena.Size());
+		auto separator = static_cast<char>(std::filesystem::path::preferred_separator);
+		Assert::AreEqual(std::string("libraries") + separator + "com/google/guava/guava/31.0.1-jre/guava-31.0.1-jre.jar", std::string(arena[0]));
+		Assert::IsTrue(arena[1].empty());
+		Assert::AreEqual(std::string("libraries") + separator + "org/lwjgl/lwjgl/3.2.2/lwjgl-3.2.2-natives-windows.jar", std::string(arena[2]));
+
+		LibraryPathArena relative;
+		relative.AddPath("a/b.jar");
+		Assert::AreEqual(std::string("a/b.jar"), std::string(relative[0]));
+	}
+
+	TEST_METHOD(TestRulePredicate) {
+		// 覆盖系统名称、架构、版本正则（含无效正则）、功能开关与动作覆盖顺序
+		std::vector<nlohmann::json> ruleLists = {
+			nlohmann::json::array(),
+			{ {{"action", "allow"}} },
+			{ {{"action", "allow"}}, {{"action", "disallow"}, {"os", {{"name", "osx"}}}} },
+			{ {{"action", "allow"}, {"os", {{"name", "windows"}}}} },
+			{ {{"action", "allow"}, {"os", {{"name", "windows"}, {"version", "^10\\."}}}} },
+			{ {{"action", "allow"}, {"os", {{"version", "[invalid"}}}} },
+			{ {{"action", "allow"}, {"os", {{"arch", "x86"}}}} },
+			{ {{"action", "allow"}, {"features", {{"is_demo_user", true}}}} },
+			{ {{"action", "allow"}, {"features", {{"has_custom_resolution", true}, {"is_quick_play_multiplayer", false}}}} },
+			{ {{"action", "allow"}}, {{"action", "disallow"}, {"features", {{"is_demo_user", true}}}} },
+		};
+		std::vector<std::map<std::string, bool>> featureSets = {
+			{},
+			{ {"is_demo_user", true} },
+			{ {"has_custom_resolution", true} },
+			{ {"has_custom_resolution", true}, {"is_quick_play_multiplayer", true} },
+			{ {"is_demo_user", false}, {"has_custom_resolution", false} },
+		};
+
+		for (const auto &features : featureSets) {
+			auto environment = RuleEnvironment::Current(features);
+			for (const auto &rules : ruleLists) {
+				Library lib = Library::Parse({ {"name", "test:rules:1.0"}, {"rules", rules} });
+				Assert::AreEqual(lib.IsActive(features), lib.IsActive(environment));
+
+				ArgumentPart part = ArgumentPart::Parse({ {"value", "--flag"}, {"rules", rules} });
+				Assert::AreEqual(part.IsActive(features), part.IsActive(environment));
+			}
+		}
+
+		// 解析后修改规则需显式重新编译，规则数量不变的修改同样生效
+		auto windows = RuleEnvironment::From(TargetEnvironment { "windows", "10.0", "x64" });
+		Library lib = Library::Parse({ {"name", "test:rules:1.0"} });
+		lib.Rules.push_back(Rule::Parse({ {"action", "allow"}, {"os", {{"name", "osx"}}} }));
+		lib.CompileRules();
+		Assert::IsFalse(lib.IsActive(windows));
+		lib.Rules[0] = Rule::Parse({ {"action", "allow"}, {"os", {{"name", "windows"}}} });
+		lib.CompileRules();
+		Assert::IsTrue(lib.IsActive(windows));
+
+		// 相同的系统条件共享同一实例
+		Rule a = Rule::Parse({ {"os", {{"name", "windows"}, {"version", "^10\\."}}} });
+		Rule b = Rule::Parse({ {"action", "disallow"}, {"os", {{"version", "^10\\."}, {"name", "windows"}}} });
+		Assert::IsTrue(OsCondition::Get(a) == OsCondition::Get(b));
+		Assert::IsNull(OsCondition::Get(Rule::Parse({ {"action", "allow"} })));
+	}
+
+	TEST_METHOD(TestInternedLibrary) {
+		StringPool pool;
+		auto a = pool.Intern("org.lwjgl:lwjgl:3.3.1");
+		auto b = pool.Intern(std::string("org.lwjgl:") + "lwjgl:3.3.1");
+		Assert::IsTrue(a == b);
+		Assert::IsTrue(a != pool.Intern("org.lwjgl:lwjgl:3.3.2"));
+		Assert::IsTrue(pool.Intern("") == InternedString());
+		Assert::AreEqual((size_t) 2, pool.Size());
+		Assert::IsTrue(pool.Find("org.lwjgl:lwjgl:3.3.1").has_value());
+		Assert::IsFalse(pool.Find("missing").has_value());
+		Assert::AreEqual(std::string("org.lwjgl:lwjgl:3.3.1"), a.Str());
+
+		auto optifine = VersionLocator::GetVersion(testRoot, "1.18.2-OptiFine");
+		Assert::IsTrue(optifine.has_value());
+
+		// 驻留形式在各目标环境下与原始形式行为一致（与运行主机无关）
+		std::vector<TargetEnvironment> targets = {
+			{ "windows", "10.0", "x64", { { "is_demo_user", false } } },
+			{ "windows", "6.1", "x86", {} },
+			{ "linux", "", "x64", {} },
+			{ "osx", "14.0", "arm64", { { "is_demo_user", true } } },
+		};
+		for (const auto &target : targets) {
+			auto environment = RuleEnvironment::From(target);
+
+			for (const auto &libJson : optifine->RawData["libraries"]) {
+				Library lib = Library::Parse(libJson);
+				InternedLibrary interned = InternedLibrary::From(lib);
+
+				Assert::AreEqual(lib.IsActive(target), interned.IsActive(environment));
+				Assert::AreEqual(lib.IsNative(target.OsName), interned.IsNative(environment.OsName));
+				auto file = lib.GetApplicableFile(target);
+				auto internedFile = interned.GetApplicableFile(environment);
+				Assert::AreEqual(file.has_value(), internedFile.has_value());
+				if (file) {
+					Assert::AreEqual(file->Path, internedFile->Path.Str());
+					Assert::AreEqual(file->Url, internedFile->Url());
+				}
+
+				// 可无损转换回去，且同一个库再次驻留得到完全相同的句柄
+				Assert::IsTrue(InternedLibrary::From(interned.ToLibrary()) == interned);
+				Assert::IsTrue(InternedLibrary::From(Library::Parse(libJson)).Name == interned.Name);
+			}
+		}
+
+		// 版本正则按目标环境匹配
+		InternedRule versionRule = InternedRule::From(Rule::Parse({ {"action", "allow"}, {"os", {{"name", "windows"}, {"version", "^10\\."}}} }));
+		Assert::IsTrue(versionRule.IsMatch(RuleEnvironment::From(targets[0])));
+		Assert::IsFalse(versionRule.IsMatch(RuleEnvironment::From(targets[1])));
+
+		FileInfo info { "org/lwjgl/lwjgl/3.3.1/lwjgl-3.3.1.jar", "abc", 1, "https://libraries.minecraft.net/org/lwjgl/lwjgl/3.3.1/lwjgl-3.3.1.jar" };
+		auto internedInfo = InternedFileInfo::From(info);
+		Assert::IsTrue(internedInfo.UrlTail == internedInfo.Path);
+		Assert::AreEqual(std::string("https://libraries.minecraft.net/"), internedInfo.UrlBase.Str());
+		Assert::AreEqual(info.Url, internedInfo.Url());
+	}
+
+	TEST_METHOD(TestArgumentTemplate) {
+		auto tmpl = ArgumentTemplate::Compile("-Dlog=${game_directory}/logs/${version_name}.log");
+		Assert::IsFalse(tmpl.IsLiteral());
+		Assert::AreEqual((size_t) 5, tmpl.GetSegments().size());
+		Assert::IsTrue(tmpl.GetSegments()[1].IsPlaceholder);
+		Assert::IsTrue(tmpl.GetSegments()[1].Key == Placeholder::GameDirectory);
+		Assert::IsTrue(tmpl.GetSegments()[1].Name.View() == "game_directory");
+		static_assert(GetPlaceholder("classpath") == Placeholder::Classpath);
+		static_assert(GetPlaceholder("clientid") == Placeholder::Custom);
+
+		SubstitutionTable subs;
+		subs.Set("game_directory", "C:/mc");
+		subs.Set("version_name", "1.18.2");
+		Assert::AreEqual(std::string("-Dlog=C:/mc/logs/1.18.2.log"), tmpl.Render(subs));
+
+		// 替换值中的占位符不会被再次展开
+		subs.Set("version_name", "${game_directory}");
+		Assert::AreEqual(std::string("-Dlog=C:/mc/logs/${game_directory}.log"), tmpl.Render(subs));
+
+		// 自定义占位符写入溢出表；按枚举写入与按名称写入等价
+		auto custom = ArgumentTemplate::Compile("${clientid}:${classpath}");
+		Assert::IsTrue(custom.GetSegments()[0].Key == Placeholder::Custom);
+		subs.Set("clientid", "abc");
+		subs.Set(Placeholder::Classpath, "a.jar");
+		Assert::AreEqual(std::string("abc:a.jar"), custom.Render(subs));
+		subs.Set("classpath", "");
+		Assert::AreEqual(std::string("abc:"), custom.Render(subs), L"空值与未设置应区分");
+
+		// 未知占位符保留原文并被报告
+		std::vector<std::string> unknown;
+		auto quickPlay = ArgumentTemplate::Compile("--quickPlayPath=${quickPlayPath}");
+		Assert::AreEqual(std::string("--quickPlayPath=${quickPlayPath}"), quickPlay.Render(subs, &unknown));
+		Assert::IsTrue(unknown == std::vector<std::string> { "quickPlayPath" });
+
+		// 未闭合的 ${ 视为字面量
+		auto unclosed = ArgumentTemplate::Compile("a${b");
+		Assert::IsTrue(unclosed.IsLiteral());
+		Assert::AreEqual(std::string("a${b"), unclosed.Render(subs));
+		auto trailing = ArgumentTemplate::Compile("${version_name}${x");
+		Assert::AreEqual((size_t) 2, trailing.GetSegments().size());
+		Assert::AreEqual(std::string("${game_directory}${x"), trailing.Render(subs));
+
+		// 解析后修改参数值需显式重新编译，长度不变的修改同样生效
+		Arguments args;
+		args.Game.push_back(ArgumentPart::Parse("--before"));
+		auto environment = RuleEnvironment::Current();
+		args.Game[0].Values[0] = "--after";
+		args.Game[0].CompileTemplates();
+		Assert::IsTrue(args.GetGameArgs(subs, environment) == std::vector<std::string> { "--after" });
+	}
+
 	TEST_METHOD(TestArgumentParsing) {
 		auto optifine = VersionLocator::GetVersion(testRoot, "1.18.2-OptiFine");
 		Assert::IsTrue(optifine.has_value());